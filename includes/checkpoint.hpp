@@ -0,0 +1,304 @@
+#pragma once
+/**
+ * @file checkpoint.hpp
+ *
+ * @brief periodic checkpoints of a run of monte_carlo_runner, written in
+ * the background, and resuming a run from one
+ *
+ * The random stream of a chunk of run_ordered() is seeded from the chunk
+ * alone, so the point a run reached is the number of complete chunks and
+ * their merged accumulator; the generator states need not be saved. A
+ * checkpoint file is a 128-byte header followed by the accumulator, in
+ * the byte order of the machine that wrote it:
+ *
+ * @code
+ * checkpoint_writer writer("run.ckpt");
+ * auto result = run_checkpointed(runner, N, "integration_231/sfmt", &writer, chrono::seconds(60));
+ * // after a pre-emption
+ * checkpoint_resume(runner, "run.ckpt", "integration_231/sfmt");
+ * @endcode
+ *
+ * The run stops at the end of a segment of chunks to take a snapshot,
+ * which costs a copy of the accumulator; a writer thread saves the last
+ * snapshot to a temporary file that it renames over the checkpoint, so
+ * the sampling threads never wait for the disk and a file is always
+ * complete.
+ */
+#ifndef CHECKPOINT_HPP
+#define CHECKPOINT_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+#include "monte_carlo.hpp"
+
+struct checkpoint_header {
+    static const uint32_t current_version = 1;
+    static const uint32_t byte_order_mark = 0x01020304;
+
+    char magic[8];        // "MMCCKPT"
+    uint32_t version;     // current_version
+    uint32_t byte_order;  // byte_order_mark as written
+    uint64_t chunk_size;  // samples of a chunk
+    uint64_t chunks;      // complete chunks
+    uint64_t target;      // samples the run was going to
+    uint64_t state_size;  // bytes of the accumulator
+    uint64_t checksum;    // checkpoint_checksum of the accumulator
+    char tag[72];         // the run, nul terminated
+};
+
+static_assert(sizeof(checkpoint_header) == 128, "the accumulator starts at byte 128");
+
+static const char checkpoint_magic[8] = "MMCCKPT";
+
+/**
+ * FNV-1a over the bytes of the accumulator
+ */
+inline uint64_t checkpoint_checksum(const char* data, size_t size) {
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ uint8_t(data[i])) * 0x100000001b3ull;
+    }
+    return hash;
+}
+
+template <class Accumulator>
+struct checkpoint {
+    std::string tag;   // what the run computes, a resume needs the same
+    size_t chunk_size; // samples of a chunk
+    size_t chunks;     // complete chunks, the samples [0, chunks * chunk_size)
+    size_t target;     // samples the run was going to
+    Accumulator result;
+
+    size_t samples() const {
+        return chunks * chunk_size;
+    }
+};
+
+template <class Accumulator>
+std::vector<char> checkpoint_encode(const checkpoint<Accumulator>& c) {
+    static_assert(std::is_trivially_copyable<Accumulator>::value, "the accumulator is saved as bytes");
+    if (c.tag.size() >= sizeof(checkpoint_header::tag)) {
+        throw std::invalid_argument("checkpoint: tag too long: " + c.tag);
+    }
+    checkpoint_header h;
+    std::memset(&h, 0, sizeof(h));
+    std::memcpy(h.magic, checkpoint_magic, sizeof(h.magic));
+    h.version = checkpoint_header::current_version;
+    h.byte_order = checkpoint_header::byte_order_mark;
+    h.chunk_size = c.chunk_size;
+    h.chunks = c.chunks;
+    h.target = c.target;
+    h.state_size = sizeof(Accumulator);
+    h.checksum = checkpoint_checksum(reinterpret_cast<const char*>(&c.result), sizeof(Accumulator));
+    std::memcpy(h.tag, c.tag.data(), c.tag.size());
+
+    std::vector<char> bytes(sizeof(h) + sizeof(Accumulator));
+    std::memcpy(bytes.data(), &h, sizeof(h));
+    std::memcpy(bytes.data() + sizeof(h), &c.result, sizeof(Accumulator));
+    return bytes;
+}
+
+/**
+ * reads a checkpoint of the run tag, throws std::runtime_error if the file
+ * is not one
+ */
+template <class Accumulator>
+checkpoint<Accumulator> checkpoint_read(const std::string& path, const std::string& tag) {
+    static_assert(std::is_trivially_copyable<Accumulator>::value, "the accumulator is saved as bytes");
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        throw std::runtime_error("checkpoint: cannot open " + path);
+    }
+    std::vector<char> bytes{ std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>() };
+
+    checkpoint_header h;
+    if (bytes.size() != sizeof(h) + sizeof(Accumulator)) {
+        throw std::runtime_error("checkpoint: " + path + " is not a checkpoint of this program");
+    }
+    std::memcpy(&h, bytes.data(), sizeof(h));
+    h.tag[sizeof(h.tag) - 1] = '\0';
+    const char* state = bytes.data() + sizeof(h);
+    if (std::memcmp(h.magic, checkpoint_magic, sizeof(h.magic)) != 0 ||
+        h.version != checkpoint_header::current_version ||
+        h.byte_order != checkpoint_header::byte_order_mark ||
+        h.state_size != sizeof(Accumulator)) {
+        throw std::runtime_error("checkpoint: " + path + " is not a checkpoint of this program");
+    }
+    if (h.checksum != checkpoint_checksum(state, sizeof(Accumulator))) {
+        throw std::runtime_error("checkpoint: " + path + ": bad checksum");
+    }
+    if (tag != h.tag) {
+        throw std::runtime_error("checkpoint: " + path + " is of the run " + h.tag + ", not " + tag);
+    }
+
+    checkpoint<Accumulator> c{ h.tag, h.chunk_size, h.chunks, h.target, Accumulator() };
+    std::memcpy(&c.result, state, sizeof(Accumulator));
+    return c;
+}
+
+class checkpoint_writer {
+public:
+    explicit checkpoint_writer(std::string path)
+        : path(std::move(path)),
+          pending(false),
+          stop(false),
+          written(0) {
+        writer = std::thread([this] { write_loop(); });
+    }
+
+    checkpoint_writer(const checkpoint_writer&) = delete;
+    checkpoint_writer& operator=(const checkpoint_writer&) = delete;
+
+    /**
+     * writes the last snapshot submitted and stops
+     */
+    ~checkpoint_writer() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        wakeup.notify_one();
+        writer.join();
+    }
+
+    /**
+     * queues a snapshot, replacing one not yet written; returns at once
+     */
+    void submit(std::vector<char> bytes) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            snapshot.swap(bytes);
+            pending = true;
+        }
+        wakeup.notify_one();
+    }
+
+    /** checkpoints written so far */
+    uint64_t write_count() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return written;
+    }
+
+private:
+    void write_loop() {
+        std::vector<char> bytes;
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wakeup.wait(lock, [this] { return stop || pending; });
+                if (!pending) {
+                    return;
+                }
+                bytes.swap(snapshot);
+                pending = false;
+            }
+            bool ok = write_file(bytes);
+            std::lock_guard<std::mutex> lock(mutex);
+            if (ok) {
+                ++written;
+            } else {
+                std::cerr << "checkpoint: cannot write " << path << std::endl;
+            }
+        }
+    }
+
+    // to a temporary file renamed over path, so that path is always whole
+    bool write_file(const std::vector<char>& bytes) const {
+        std::string tmp = path + ".tmp";
+        int fd = ::open(tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) {
+            return false;
+        }
+        size_t done = 0;
+        while (done < bytes.size()) {
+            ssize_t n = ::write(fd, bytes.data() + done, bytes.size() - done);
+            if (n <= 0) {
+                ::close(fd);
+                return false;
+            }
+            done += n;
+        }
+        bool ok = ::fsync(fd) == 0;
+        ok = ::close(fd) == 0 && ok;
+        return ok && std::rename(tmp.c_str(), path.c_str()) == 0;
+    }
+
+    const std::string path;
+    mutable std::mutex mutex;
+    std::condition_variable wakeup;
+    std::vector<char> snapshot;
+    bool pending;
+    bool stop;
+    uint64_t written;
+    std::thread writer;
+};
+
+/**
+ * continues the run of runner from the checkpoint at path, returned
+ */
+template <class Kernel, class Accumulator>
+checkpoint<Accumulator> checkpoint_resume(monte_carlo_runner<Kernel, Accumulator>& runner,
+                                          const std::string& path, const std::string& tag) {
+    auto saved = checkpoint_read<Accumulator>(path, tag);
+    if (saved.chunk_size != runner.ordered_chunk()) {
+        throw std::runtime_error("checkpoint: " + path + " has chunks of " + std::to_string(saved.chunk_size) +
+                                 " samples, not " + std::to_string(runner.ordered_chunk()));
+    }
+    runner.resume_ordered(saved.chunks, saved.result);
+    return saved;
+}
+
+/**
+ * runner.extend_ordered(N) in segments of 64 chunks per worker; after a
+ * segment, if interval has passed since the last one, a checkpoint of the
+ * run tag goes to writer. The last checkpoint is of the whole run.
+ */
+template <class Kernel, class Accumulator>
+Accumulator run_checkpointed(monte_carlo_runner<Kernel, Accumulator>& runner, size_t N,
+                             const std::string& tag, checkpoint_writer* writer,
+                             std::chrono::steady_clock::duration interval) {
+    if (!writer) {
+        return runner.extend_ordered(N);
+    }
+    auto save = [&] {
+        writer->submit(checkpoint_encode(checkpoint<Accumulator>{
+            tag, runner.ordered_chunk(), runner.extended_count(), N, runner.extended_result() }));
+    };
+
+    const size_t chunk = runner.ordered_chunk();
+    const size_t segment = 64 * runner.num_workers() * chunk;
+    auto last = std::chrono::steady_clock::now();
+    Accumulator result;
+    for (;;) {
+        size_t next = std::min(N, runner.extended_count() * chunk + segment);
+        result = runner.extend_ordered(next);
+        if (next == N) {
+            break;
+        }
+        auto now = std::chrono::steady_clock::now();
+        if (now - last >= interval) {
+            save();
+            last = now;
+        }
+    }
+    save();
+    return result;
+}
+
+#endif // CHECKPOINT_HPP
@@ -0,0 +1,55 @@
+#pragma once
+/**
+ * @file cone_integrand.hpp
+ *
+ * @brief the integrand K of integration_261 and va_simulation_411, a cone
+ * of height 8 over the circle of center (0.5, 0.5) and radius 0.4, and
+ * the uniform points of that circle
+ *
+ * integration_261 samples K at uniform points of the unit square;
+ * va_simulation_411 samples it at uniform points of the circle only, which
+ * circle_point() builds from a radius with density 2r on [0,1] and a
+ * direction given by two independent normal numbers.
+ */
+#ifndef CONE_INTEGRAND_HPP
+#define CONE_INTEGRAND_HPP
+
+#include <array>
+#include <cmath>
+
+typedef std::array<double, 2> Vector2;
+
+static const Vector2 center{ {0.5, 0.5} };
+static const double radius = 0.4;
+static const double sqradius = radius * radius;
+static const double height = 8.0;
+
+static inline double K_fn(const Vector2& point) {
+    double dist_sq = std::pow(point[0] - center[0], 2) +
+                     std::pow(point[1] - center[1], 2);
+
+    // valid only if it is inside the circle
+    if (dist_sq <= sqradius) {
+        // apply the height function
+        return height - height / radius * std::sqrt(dist_sq);
+    }
+
+    // outside the circle: return 0
+    return 0;
+}
+
+/**
+ * the point of the circle at r times the radius from the center, in the
+ * direction of (z1, z2)
+ */
+static inline Vector2 circle_point(double r, double z1, double z2) {
+    auto norm = std::sqrt(z1*z1 + z2*z2);
+    auto x1 = r*z1 / norm;
+    auto x2 = r*z2 / norm;
+    // transform x1 and x2 to fit the circle of center (0.5, 0.5) and radius 0.4
+    x1 = 0.5 + x1*radius;
+    x2 = 0.5 + x2*radius;
+    return Vector2{{x1, x2}};
+}
+
+#endif // CONE_INTEGRAND_HPP
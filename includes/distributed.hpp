@@ -0,0 +1,417 @@
+#pragma once
+/**
+ * @file distributed.hpp
+ *
+ * @brief one run_ordered() of monte_carlo_runner spread over several
+ * processes, on one host or many, by a coordinator that hands out ranges
+ * of chunks to workers over Unix or TCP sockets
+ *
+ * The random stream of a chunk is seeded from the chunk alone, so any
+ * process can compute any chunk; the coordinator merges the accumulators
+ * of the chunks in chunk order and gets the result of run_ordered(N), to
+ * the last bit, whatever processes took part:
+ *
+ * @code
+ * // coordinator
+ * distributed_coordinator<hit_count> coordinator("unix:/tmp/run.sock", "integration_231/sfmt", chunk);
+ * auto result = coordinator.run(N);
+ *
+ * // each worker, with the same kernel
+ * distributed_work(runner, "unix:/tmp/run.sock", "integration_231/sfmt");
+ * @endcode
+ *
+ * An address is unix:<path> or <host>:<port>. The protocol, in the byte
+ * order of the hosts, which must agree:
+ *
+ * - worker: a distributed_hello, with the run tag and its thread count
+ * - coordinator: a distributed_assignment of the samples [begin, end),
+ *   whole chunks but the last of the run; an empty one ends the work
+ * - worker: a distributed_result_header and the accumulators of the
+ *   chunks, then waits for the next assignment
+ *
+ * A worker gets 16 chunks per thread at a time. A worker that closes its
+ * connection, dies, or takes longer than the timeout for an assignment is
+ * dropped and its chunks go to the next worker that asks. Workers may
+ * join at any time, also from other hosts.
+ */
+#ifndef DISTRIBUTED_HPP
+#define DISTRIBUTED_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "monte_carlo.hpp"
+#include "qrng_socket.hpp"
+
+struct distributed_hello {
+    static const uint32_t current_version = 1;
+    static const uint32_t byte_order_mark = 0x01020304;
+
+    char magic[8];        // "MMCDIST"
+    uint32_t version;     // current_version
+    uint32_t byte_order;  // byte_order_mark as written
+    uint64_t chunk_size;  // samples of a chunk
+    uint64_t state_size;  // bytes of the accumulator
+    uint64_t threads;     // of the worker
+    char tag[72];         // the run, nul terminated
+};
+
+struct distributed_assignment {
+    uint64_t begin; // samples, begin == end to stop
+    uint64_t end;
+};
+
+struct distributed_result_header {
+    uint64_t first_chunk;
+    uint64_t chunks; // accumulators that follow
+};
+
+static const char distributed_magic[8] = "MMCDIST";
+
+/**
+ * a socket bound to address, listening, or connected to it; throws
+ * std::runtime_error
+ */
+inline int distributed_socket(const std::string& address, bool listen) {
+    const std::string what = listen ? "cannot listen on " : "cannot connect to ";
+    if (address.rfind("unix:", 0) == 0) {
+        sockaddr_un a{};
+        a.sun_family = AF_UNIX;
+        std::string path = address.substr(5);
+        if (path.empty() || path.size() >= sizeof(a.sun_path)) {
+            throw std::runtime_error("distributed: bad address " + address);
+        }
+        std::memcpy(a.sun_path, path.c_str(), path.size() + 1);
+        int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (listen) {
+            ::unlink(path.c_str());
+        }
+        if (fd < 0 ||
+            (listen ? ::bind(fd, reinterpret_cast<sockaddr*>(&a), sizeof(a)) != 0 || ::listen(fd, 64) != 0
+                    : ::connect(fd, reinterpret_cast<sockaddr*>(&a), sizeof(a)) != 0)) {
+            if (fd >= 0) {
+                ::close(fd);
+            }
+            throw std::runtime_error("distributed: " + what + address);
+        }
+        return fd;
+    }
+
+    auto colon = address.rfind(':');
+    if (colon == std::string::npos) {
+        throw std::runtime_error("distributed: bad address " + address);
+    }
+    std::string host = address.substr(0, colon);
+    addrinfo hints;
+    std::memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags = listen ? AI_PASSIVE : 0;
+    addrinfo* addresses = nullptr;
+    if (::getaddrinfo(host.empty() ? nullptr : host.c_str(), address.substr(colon + 1).c_str(), &hints, &addresses) != 0) {
+        throw std::runtime_error("distributed: unknown host " + host);
+    }
+    int fd = -1;
+    for (addrinfo* a = addresses; a && fd < 0; a = a->ai_next) {
+        fd = ::socket(a->ai_family, a->ai_socktype, a->ai_protocol);
+        if (fd < 0) {
+            continue;
+        }
+        int one = 1;
+        bool ok;
+        if (listen) {
+            ::setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+            ok = ::bind(fd, a->ai_addr, a->ai_addrlen) == 0 && ::listen(fd, 64) == 0;
+        } else {
+            ok = ::connect(fd, a->ai_addr, a->ai_addrlen) == 0;
+            ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        }
+        if (!ok) {
+            ::close(fd);
+            fd = -1;
+        }
+    }
+    ::freeaddrinfo(addresses);
+    if (fd < 0) {
+        throw std::runtime_error("distributed: " + what + address);
+    }
+    return fd;
+}
+
+template <class Accumulator>
+class distributed_coordinator {
+    static_assert(std::is_trivially_copyable<Accumulator>::value, "accumulators are sent as bytes");
+
+public:
+    /**
+     * listens on address for the workers of the run tag
+     */
+    distributed_coordinator(const std::string& address, std::string tag, size_t chunk_size,
+                            std::chrono::steady_clock::duration timeout = std::chrono::minutes(10))
+        : tag(std::move(tag)),
+          chunk_size(chunk_size),
+          timeout(timeout),
+          listener(distributed_socket(address, true)),
+          workers_seen(0),
+          dropped(0) {
+        if (this->tag.size() >= sizeof(distributed_hello::tag)) {
+            throw std::invalid_argument("distributed: tag too long: " + this->tag);
+        }
+    }
+
+    distributed_coordinator(const distributed_coordinator&) = delete;
+    distributed_coordinator& operator=(const distributed_coordinator&) = delete;
+
+    ~distributed_coordinator() {
+        for (auto& w : workers) {
+            ::close(w.fd);
+        }
+        ::close(listener);
+    }
+
+    /**
+     * the result of run_ordered(N), computed by the workers that connect;
+     * returns when all the chunks are in, and ends the work of the workers
+     */
+    Accumulator run(size_t N) {
+        const size_t total = (N + chunk_size - 1) / chunk_size;
+        std::vector<Accumulator> results(total);
+        std::vector<bool> received(total, false);
+        size_t complete = 0;
+        pending.clear();
+        pending.emplace_back(0, total);
+        samples = N;
+
+        while (complete < total) {
+            std::vector<pollfd> fds(1 + workers.size());
+            fds[0] = pollfd{ listener, POLLIN, 0 };
+            for (size_t i = 0; i < workers.size(); ++i) {
+                fds[i + 1] = pollfd{ workers[i].fd, POLLIN, 0 };
+            }
+            ::poll(fds.data(), fds.size(), 1000);
+
+            // the workers, new ones are polled the next time round
+            std::vector<size_t> lost;
+            for (size_t i = 0; i < workers.size(); ++i) {
+                auto& w = workers[i];
+                if (fds[i + 1].revents) {
+                    bool ok = w.greeted ? receive(w, results, received, complete) : greet(w);
+                    if (!ok) {
+                        lost.push_back(i);
+                        continue;
+                    }
+                }
+                if (w.busy && std::chrono::steady_clock::now() > w.deadline) {
+                    lost.push_back(i);
+                }
+            }
+            for (auto i = lost.rbegin(); i != lost.rend(); ++i) {
+                drop(*i);
+            }
+
+            if (fds[0].revents & POLLIN) {
+                int fd = ::accept(listener, nullptr, nullptr);
+                if (fd >= 0) {
+                    // a worker that stops in the middle of a message is lost
+                    timeval tv{ 30, 0 };
+                    ::setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+                    worker w;
+                    w.fd = fd;
+                    workers.push_back(w);
+                }
+            }
+
+            for (size_t i = workers.size(); i-- > 0;) {
+                auto& w = workers[i];
+                if (w.greeted && !w.busy && !pending.empty() && !assign(w)) {
+                    drop(i);
+                }
+            }
+        }
+
+        distributed_assignment stop{ 0, 0 };
+        for (auto& w : workers) {
+            qrng_socket_send_all(w.fd, &stop, sizeof(stop));
+            ::close(w.fd);
+        }
+        workers.clear();
+
+        Accumulator result;
+        for (auto& r : results) {
+            result.merge(r);
+        }
+        return result;
+    }
+
+    /** workers that joined the run */
+    size_t worker_count() const {
+        return workers_seen;
+    }
+
+    /** workers dropped with chunks, which went to others */
+    size_t dropped_count() const {
+        return dropped;
+    }
+
+private:
+    struct worker {
+        int fd;
+        bool greeted = false;
+        size_t threads = 1;
+        bool busy = false;
+        size_t first = 0; // the chunks [first, last) assigned
+        size_t last = 0;
+        std::chrono::steady_clock::time_point deadline;
+    };
+
+    bool greet(worker& w) {
+        distributed_hello h;
+        if (!qrng_socket_recv_all(w.fd, &h, sizeof(h))) {
+            return false;
+        }
+        h.tag[sizeof(h.tag) - 1] = '\0';
+        if (std::memcmp(h.magic, distributed_magic, sizeof(h.magic)) != 0 ||
+            h.version != distributed_hello::current_version ||
+            h.byte_order != distributed_hello::byte_order_mark ||
+            h.chunk_size != chunk_size ||
+            h.state_size != sizeof(Accumulator) ||
+            tag != h.tag) {
+            return false;
+        }
+        w.greeted = true;
+        w.threads = std::max<uint64_t>(h.threads, 1);
+        ++workers_seen;
+        return true;
+    }
+
+    // the next chunks of pending, 16 per thread of w
+    bool assign(worker& w) {
+        auto& range = pending.front();
+        size_t count = std::min(range.second - range.first, 16 * w.threads);
+        w.first = range.first;
+        w.last = range.first + count;
+        range.first += count;
+        if (range.first == range.second) {
+            pending.pop_front();
+        }
+        w.busy = true;
+        w.deadline = std::chrono::steady_clock::now() + timeout;
+        distributed_assignment a{ w.first * chunk_size, std::min<uint64_t>(w.last * chunk_size, samples) };
+        return qrng_socket_send_all(w.fd, &a, sizeof(a));
+    }
+
+    bool receive(worker& w, std::vector<Accumulator>& results, std::vector<bool>& received, size_t& complete) {
+        distributed_result_header h;
+        if (!w.busy ||
+            !qrng_socket_recv_all(w.fd, &h, sizeof(h)) ||
+            h.first_chunk != w.first || h.chunks != w.last - w.first) {
+            return false;
+        }
+        std::vector<Accumulator> chunks(h.chunks);
+        if (!qrng_socket_recv_all(w.fd, chunks.data(), chunks.size() * sizeof(Accumulator))) {
+            return false;
+        }
+        for (size_t c = 0; c < chunks.size(); ++c) {
+            size_t id = w.first + c;
+            if (!received[id]) {
+                results[id] = chunks[c];
+                received[id] = true;
+                ++complete;
+            }
+        }
+        w.busy = false;
+        return true;
+    }
+
+    // closes the connection of worker i, its chunks go back first
+    void drop(size_t i) {
+        auto& w = workers[i];
+        if (w.busy) {
+            pending.emplace_front(w.first, w.last);
+            ++dropped;
+        }
+        ::close(w.fd);
+        workers.erase(workers.begin() + i);
+    }
+
+    const std::string tag;
+    const size_t chunk_size;
+    const std::chrono::steady_clock::duration timeout;
+    int listener;
+
+    std::vector<worker> workers;
+    std::deque<std::pair<size_t, size_t>> pending; // ranges of chunks not assigned
+    size_t samples = 0;
+    size_t workers_seen;
+    size_t dropped;
+};
+
+/**
+ * computes the assignments of the coordinator at address for the run tag
+ * with runner, until the coordinator ends the work; connecting is tried
+ * for up to wait. Throws std::runtime_error if the coordinator cannot be
+ * reached or drops the worker.
+ */
+template <class Kernel, class Accumulator>
+void distributed_work(monte_carlo_runner<Kernel, Accumulator>& runner, const std::string& address,
+                      const std::string& tag, std::chrono::steady_clock::duration wait = std::chrono::seconds(30)) {
+    static_assert(std::is_trivially_copyable<Accumulator>::value, "accumulators are sent as bytes");
+    if (tag.size() >= sizeof(distributed_hello::tag)) {
+        throw std::invalid_argument("distributed: tag too long: " + tag);
+    }
+
+    // the coordinator may not be listening yet
+    auto give_up = std::chrono::steady_clock::now() + wait;
+    int fd = -1;
+    while (fd < 0) {
+        try {
+            fd = distributed_socket(address, false);
+        } catch (std::runtime_error&) {
+            if (std::chrono::steady_clock::now() > give_up) {
+                throw;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+    }
+
+    distributed_hello h;
+    std::memset(&h, 0, sizeof(h));
+    std::memcpy(h.magic, distributed_magic, sizeof(h.magic));
+    h.version = distributed_hello::current_version;
+    h.byte_order = distributed_hello::byte_order_mark;
+    h.chunk_size = runner.ordered_chunk();
+    h.state_size = sizeof(Accumulator);
+    h.threads = runner.num_workers();
+    std::memcpy(h.tag, tag.data(), tag.size());
+
+    bool ok = qrng_socket_send_all(fd, &h, sizeof(h));
+    distributed_assignment a;
+    while (ok && (ok = qrng_socket_recv_all(fd, &a, sizeof(a))) && a.begin < a.end) {
+        auto chunks = runner.run_ordered_chunks(a.begin, a.end);
+        distributed_result_header r{ a.begin / runner.ordered_chunk(), chunks.size() };
+        ok = qrng_socket_send_all(fd, &r, sizeof(r)) &&
+             qrng_socket_send_all(fd, chunks.data(), chunks.size() * sizeof(Accumulator));
+    }
+    ::close(fd);
+    if (!ok) {
+        throw std::runtime_error("distributed: lost the coordinator at " + address);
+    }
+}
+
+#endif // DISTRIBUTED_HPP
@@ -0,0 +1,122 @@
+#pragma once
+/**
+ * @file hypersphere.hpp
+ *
+ * @brief the region R of integration_231 and randomgen_481: the points of
+ * [0,1]^6 inside a hypersphere and, with the extra restrictions, in three
+ * half-spaces
+ *
+ * λ(R) is the fraction of the unit hypercube taken by R, so the
+ * simulations count the uniform points for which in_region() holds;
+ * kernel_bench times it against a plain reference.
+ *
+ * count_in_region() counts a block of points kept as six coordinate
+ * arrays, 8 (AVX-512) or 4 (AVX2) points per instruction and without
+ * branches. The sums are done in the order of in_region(), so the count is
+ * the same with and without the vectors.
+ */
+#ifndef HYPERSPHERE_HPP
+#define HYPERSPHERE_HPP
+
+#include <array>
+#include <cstddef>
+#include <numeric>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+typedef std::array<double, 6> M_Vector;
+
+static const M_Vector hs_center{ {0.45, 0.5, 0.6, 0.6, 0.5, 0.45} };
+static const double hs_radius = 0.35;
+static const double hs_sqradius = hs_radius * hs_radius;
+
+/**
+ * whether the point of coordinates coords[0] ... coords[5] is in R
+ */
+static inline bool in_region(const double* coords, const bool extra_restrictions) {
+    M_Vector point{ {coords[0], coords[1], coords[2], coords[3], coords[4], coords[5]} };
+    M_Vector distance_vector{ {point[0] - hs_center[0],
+                              point[1] - hs_center[1],
+                              point[2] - hs_center[2],
+                              point[3] - hs_center[3],
+                              point[4] - hs_center[4],
+                              point[5] - hs_center[5]} };
+    auto sq_distance = std::inner_product(distance_vector.begin(), distance_vector.end(), distance_vector.begin(), 0.0);
+
+    return sq_distance <= hs_sqradius &&
+        (!extra_restrictions || (3 * point[0] + 7 * point[3] <= 5 &&
+            point[2] + point[3] <= 1 &&
+            point[0] - point[1] - point[4] + point[5] >= 0));
+}
+
+#if defined(__AVX512F__)
+// the points j ... j + 7 of x[d * stride + j], as a mask of the ones in R
+static inline __mmask8 in_region8(const double* x, const size_t stride, const bool extra_restrictions) {
+    __m512d p[6];
+    __m512d sq_distance = _mm512_setzero_pd();
+    for (size_t d = 0; d < 6; ++d) {
+        p[d] = _mm512_loadu_pd(x + d * stride);
+        __m512d diff = _mm512_sub_pd(p[d], _mm512_set1_pd(hs_center[d]));
+        sq_distance = _mm512_add_pd(sq_distance, _mm512_mul_pd(diff, diff));
+    }
+    __mmask8 in = _mm512_cmp_pd_mask(sq_distance, _mm512_set1_pd(hs_sqradius), _CMP_LE_OQ);
+    if (extra_restrictions) {
+        __m512d c1 = _mm512_add_pd(_mm512_mul_pd(_mm512_set1_pd(3), p[0]), _mm512_mul_pd(_mm512_set1_pd(7), p[3]));
+        __m512d c2 = _mm512_add_pd(p[2], p[3]);
+        __m512d c3 = _mm512_add_pd(_mm512_sub_pd(_mm512_sub_pd(p[0], p[1]), p[4]), p[5]);
+        in &= _mm512_cmp_pd_mask(c1, _mm512_set1_pd(5), _CMP_LE_OQ);
+        in &= _mm512_cmp_pd_mask(c2, _mm512_set1_pd(1), _CMP_LE_OQ);
+        in &= _mm512_cmp_pd_mask(c3, _mm512_setzero_pd(), _CMP_GE_OQ);
+    }
+    return in;
+}
+#elif defined(__AVX2__)
+// the points j ... j + 3 of x[d * stride + j], as a mask of the ones in R
+static inline int in_region4(const double* x, const size_t stride, const bool extra_restrictions) {
+    __m256d p[6];
+    __m256d sq_distance = _mm256_setzero_pd();
+    for (size_t d = 0; d < 6; ++d) {
+        p[d] = _mm256_loadu_pd(x + d * stride);
+        __m256d diff = _mm256_sub_pd(p[d], _mm256_set1_pd(hs_center[d]));
+        sq_distance = _mm256_add_pd(sq_distance, _mm256_mul_pd(diff, diff));
+    }
+    __m256d in = _mm256_cmp_pd(sq_distance, _mm256_set1_pd(hs_sqradius), _CMP_LE_OQ);
+    if (extra_restrictions) {
+        __m256d c1 = _mm256_add_pd(_mm256_mul_pd(_mm256_set1_pd(3), p[0]), _mm256_mul_pd(_mm256_set1_pd(7), p[3]));
+        __m256d c2 = _mm256_add_pd(p[2], p[3]);
+        __m256d c3 = _mm256_add_pd(_mm256_sub_pd(_mm256_sub_pd(p[0], p[1]), p[4]), p[5]);
+        in = _mm256_and_pd(in, _mm256_cmp_pd(c1, _mm256_set1_pd(5), _CMP_LE_OQ));
+        in = _mm256_and_pd(in, _mm256_cmp_pd(c2, _mm256_set1_pd(1), _CMP_LE_OQ));
+        in = _mm256_and_pd(in, _mm256_cmp_pd(c3, _mm256_setzero_pd(), _CMP_GE_OQ));
+    }
+    return _mm256_movemask_pd(in);
+}
+#endif
+
+/**
+ * how many of the points 0 ... count - 1 are in R, with coordinate d of point
+ * j in x[d * stride + j]
+ */
+static inline size_t count_in_region(const double* x, const size_t stride, const size_t count,
+                                     const bool extra_restrictions) {
+    size_t hits = 0;
+    size_t j = 0;
+#if defined(__AVX512F__)
+    for (; j + 8 <= count; j += 8) {
+        hits += __builtin_popcount(in_region8(x + j, stride, extra_restrictions));
+    }
+#elif defined(__AVX2__)
+    for (; j + 4 <= count; j += 4) {
+        hits += __builtin_popcount(in_region4(x + j, stride, extra_restrictions));
+    }
+#endif
+    for (; j < count; ++j) {
+        double coords[] = { x[j], x[stride + j], x[2 * stride + j], x[3 * stride + j], x[4 * stride + j], x[5 * stride + j] };
+        hits += in_region(coords, extra_restrictions);
+    }
+    return hits;
+}
+
+#endif // HYPERSPHERE_HPP
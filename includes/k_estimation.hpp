@@ -0,0 +1,233 @@
+#pragma once
+/**
+ * @file k_estimation.hpp
+ *
+ * @brief the estimation of ζ(R) shared by integration_261 and
+ * va_simulation_411: a pilot run, then either the samples its variance
+ * asks for or batches added to it until the confidence interval is narrow
+ * enough
+ *
+ * Kernel is a kernel of monte_carlo_runner with a running_moments
+ * accumulator of the samples of K; a program gives its kernel and the
+ * area of the region its points are drawn from to k_estimation_main().
+ */
+#ifndef K_ESTIMATION_HPP
+#define K_ESTIMATION_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <boost/math/distributions/normal.hpp>
+#include "monte_carlo.hpp"
+#include "perf_counters.hpp"
+#include "running_moments.hpp"
+
+// moments of the samples of K, computed in chunks on the threads of a pool
+// so that a run can be extended, with the same result for any number of
+// threads
+template <class Kernel>
+struct k_estimator {
+    monte_carlo_runner<Kernel, running_moments> runner;
+    running_moments moments;
+    double area;
+
+    k_estimator(Kernel kernel, work_stealing_pool& pool, double area)
+        : runner(std::move(kernel), pool),
+          area(area) {
+    }
+
+    // draws count more samples
+    void add(size_t count) {
+        moments = runner.extend_ordered(moments.count() + count);
+    }
+
+    size_t count() const {
+        return moments.count();
+    }
+
+    double z_hat() const {
+        return moments.mean() * area;
+    }
+
+    double sigma_sq() const {
+        return moments.variance() * area;
+    }
+
+    // half-width of the confidence interval of level 1 - delta
+    double error(double delta) const {
+        boost::math::normal ndist;
+        return boost::math::quantile(ndist, 1 - delta/2) * std::pow(sigma_sq()/count(), 0.5);
+    }
+};
+
+template <class Kernel, class Duration>
+static void print_estimate(const k_estimator<Kernel>& estimator, const double delta, const Duration duration) {
+    typedef std::chrono::duration<long double, std::milli> float_milliseconds;
+
+    auto N = estimator.count();
+    auto sigma_sq = estimator.sigma_sq();
+    auto var_of_z = sigma_sq / N;
+
+    std::cout << "samples    : " << N << " (10^" << std::log10(N) << ")" << std::endl;
+    std::cout << "ζ̈(R)       : " << std::scientific << std::setprecision(5) << estimator.z_hat() << std::endl;
+    std::cout << "Var(K)     : " << std::scientific << std::setprecision(5) << sigma_sq << std::endl;
+    std::cout << "Var(ζ̈)     : " << std::scientific << std::setprecision(5) << var_of_z << std::endl;
+    std::cout << "Error (" << std::fixed << std::setprecision(0) << 100 * (1 - delta) << "%): "
+              << std::scientific << std::setprecision(5) << estimator.error(delta) << std::endl;
+    std::cout << "Time       : " << std::fixed << std::setprecision(3)
+              << std::chrono::duration_cast<float_milliseconds>(duration).count() << " ms" << std::endl;
+}
+
+// counters of the kernel calls of estimator, if count_perf, until reset
+template <class Kernel>
+static std::unique_ptr<perf_counters> count_kernel(k_estimator<Kernel>& estimator, const bool count_perf) {
+    std::unique_ptr<perf_counters> counters;
+    if (count_perf) {
+        counters.reset(new perf_counters(estimator.runner.num_workers()));
+    }
+    estimator.runner.set_perf_counters(counters.get());
+    return counters;
+}
+
+// extends the run of estimator to N samples
+template <class Kernel>
+static void run_simulation(k_estimator<Kernel>& estimator, const size_t N, const double delta, const bool count_perf) {
+    auto counters = count_kernel(estimator, count_perf);
+    auto begin_tp = std::chrono::steady_clock::now();
+    estimator.add(N - std::min(N, estimator.count()));
+    auto duration = std::chrono::steady_clock::now() - begin_tp;
+    estimator.runner.set_perf_counters(nullptr);
+
+    print_estimate(estimator, delta, duration);
+    if (counters) {
+        counters->print(std::cout);
+    }
+}
+
+// samples of the first batch of run_adaptive, and the least of the others
+static const size_t min_batch = 10000;
+
+// extends the pilot run in batches until the confidence interval of level
+// 1 - delta is narrower than 2 epsilon; each batch is half of the samples
+// still needed according to the variance so far
+template <class Kernel>
+static void run_adaptive(k_estimator<Kernel>& estimator, const double delta, const double epsilon, const bool count_perf) {
+    boost::math::normal normdist{};
+    auto z = boost::math::quantile(normdist, 1 - delta/2);
+
+    auto counters = count_kernel(estimator, count_perf);
+    auto begin_tp = std::chrono::steady_clock::now();
+    size_t batches = 0;
+    if (estimator.count() < 2) {
+        estimator.add(min_batch);
+        ++batches;
+    }
+    while (estimator.error(delta) > epsilon) {
+        size_t needed = std::ceil(z * z * estimator.sigma_sq() / (epsilon * epsilon));
+        estimator.add(std::max(min_batch, (needed - std::min(needed, estimator.count())) / 2));
+        ++batches;
+    }
+    auto duration = std::chrono::steady_clock::now() - begin_tp;
+    estimator.runner.set_perf_counters(nullptr);
+
+    std::cout << "batches    : " << batches << std::endl;
+    print_estimate(estimator, delta, duration);
+    if (counters) {
+        counters->print(std::cout);
+    }
+}
+
+/**
+ * the main of a program estimating ζ(R) with the samples of kernel, K
+ * averaged over a region of the given area:
+ *
+ * @verbatim
+ <program> <N> [<threads>] [--adaptive] [--delta=<δ>] [--epsilon=<ε>] [--perf-counters]
+@endverbatim
+ *
+ * runs a pilot of N samples, then the samples its variance asks for, or,
+ * with --adaptive, batches added to the pilot.
+ */
+template <class Kernel>
+static int k_estimation_main(int argc, char* argv[], const Kernel& kernel, const double area) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <N> [<threads>] [--adaptive] [--delta=<δ>] [--epsilon=<ε>] [--perf-counters]" << std::endl;
+        return 1;
+    }
+
+    size_t N;
+    try {
+        N = std::stoll(argv[1]);
+    } catch (std::invalid_argument& e) {
+        std::cerr << "Invalid argument: " << argv[1] << std::endl;
+        return 1;
+    }
+
+    auto DELTA = 0.05;
+    auto EPSILON = 0.001;
+    bool adaptive = false;
+    bool count_perf = false;
+    size_t threads = std::thread::hardware_concurrency();
+    for (int i = 2; i < argc; ++i) {
+        std::string arg{ argv[i] };
+        try {
+            if (i == 2 && arg.rfind("--", 0) != 0) {
+                auto value = std::stoll(arg);
+                if (value < 1) {
+                    throw std::invalid_argument(arg);
+                }
+                threads = value;
+            } else if (arg == "--adaptive") {
+                adaptive = true;
+            } else if (arg.rfind("--delta=", 0) == 0) {
+                DELTA = std::stod(arg.substr(8));
+            } else if (arg.rfind("--epsilon=", 0) == 0) {
+                EPSILON = std::stod(arg.substr(10));
+            } else if (arg == "--perf-counters") {
+                count_perf = true;
+            } else {
+                throw std::invalid_argument(arg);
+            }
+        } catch (std::invalid_argument& e) {
+            std::cerr << "Invalid argument: " << arg << std::endl;
+            return 1;
+        }
+        if (!(DELTA > 0 && DELTA < 1 && EPSILON > 0)) {
+            std::cerr << "Invalid argument: " << arg << std::endl;
+            return 1;
+        }
+    }
+
+    // the same samples, and the same result, with any number of threads
+    work_stealing_pool pool(threads);
+    std::cout << pool.size() << " threads" << std::endl;
+
+    k_estimator<Kernel> pilot(kernel, pool, area);
+    run_simulation(pilot, N, DELTA, count_perf);
+    auto sigma_sq = pilot.sigma_sq();
+
+    // parte B
+    boost::math::normal normdist{};
+    size_t nN = std::ceil(std::pow(boost::math::quantile(normdist, 1 - DELTA/2), 2) * sigma_sq / std::pow(EPSILON, 2));
+
+    std::cout << "-----------------" << std::endl;
+    std::cout << "nN = " << nN << std::endl;
+    if (adaptive) {
+        // keeps the samples of the pilot run
+        run_adaptive(pilot, DELTA, EPSILON, count_perf);
+    } else {
+        k_estimator<Kernel> estimator(kernel, pool, area);
+        run_simulation(estimator, nN, DELTA, count_perf);
+    }
+
+    return 0;
+}
+
+#endif // K_ESTIMATION_HPP
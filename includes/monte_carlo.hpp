@@ -0,0 +1,489 @@
+#pragma once
+/**
+ * @file monte_carlo.hpp
+ *
+ * @brief parallel Monte Carlo runs on a persistent work-stealing pool
+ *
+ * monte_carlo_runner splits the samples [0, N) of a run in chunks and
+ * runs them on the threads of a work_stealing_pool, which live as long as
+ * the program, so no run pays for thread creation. Each worker starts
+ * with a contiguous share of the chunks and, once done with it, steals
+ * half of the chunks left to another, so faster cores do more of a run.
+ *
+ * The kernel gives the per-worker state, usually a random number stream,
+ * and computes ranges of samples into an accumulator:
+ *
+ * @code
+ * struct kernel {
+ *     typedef sfmt_t state_type;
+ *     // called once per worker, on the worker thread
+ *     state_type make_state(size_t worker) const;
+ *     // samples [begin, end)
+ *     void operator()(state_type& state, size_t begin, size_t end, accumulator& acc) const;
+ * };
+ *
+ * struct accumulator {
+ *     void merge(const accumulator& other);
+ * };
+ *
+ * monte_carlo_runner<kernel, accumulator> runner(kernel{});
+ * accumulator result = runner.run(N);
+ * @endcode
+ *
+ * Each worker adds its chunks to its own accumulator, and the
+ * accumulators of the workers are merged pairwise in a tree at the end of
+ * the run. The states are kept from one run to the next.
+ *
+ * The result of run() depends on the number of workers, which share out
+ * the random streams. run_ordered() gives the same result, to the last
+ * bit, with any number of workers: chunks have a fixed size, the kernel
+ * seeds the state for each chunk from the chunk alone, and the
+ * accumulators of the chunks are merged in chunk order. extend_ordered()
+ * grows such a run from N samples to more, computing only the new chunks.
+ *
+ * @code
+ * struct kernel {
+ *     ...
+ *     // before the samples [chunk * chunk_size, (chunk + 1) * chunk_size)
+ *     void seed_chunk(state_type& state, size_t chunk) const;
+ * };
+ * @endcode
+ */
+#ifndef MONTE_CARLO_HPP
+#define MONTE_CARLO_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "perf_counters.hpp"
+#include "progress.hpp"
+#include "running_moments.hpp"
+
+class work_stealing_pool {
+public:
+    typedef std::function<void(size_t worker, size_t item)> task_function;
+
+    explicit work_stealing_pool(size_t num_threads = std::thread::hardware_concurrency())
+        : queues(std::max<size_t>(num_threads, 1)),
+          task(nullptr),
+          generation(0),
+          active(0),
+          stop(false) {
+        for (size_t w = 0; w < queues.size(); ++w) {
+            threads.emplace_back([this, w] { work(w); });
+        }
+    }
+
+    work_stealing_pool(const work_stealing_pool&) = delete;
+    work_stealing_pool& operator=(const work_stealing_pool&) = delete;
+
+    ~work_stealing_pool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        wakeup.notify_all();
+        for (auto& t : threads) {
+            t.join();
+        }
+    }
+
+    /**
+     * the pool of the process, hardware_concurrency() threads started on
+     * the first call
+     */
+    static work_stealing_pool& shared() {
+        static work_stealing_pool pool;
+        return pool;
+    }
+
+    size_t size() const {
+        return queues.size();
+    }
+
+    /**
+     * calls task(worker, item) for each item of [0, count) on the threads
+     * of the pool and returns when all are done, rethrowing the first
+     * exception of a task. Worker w starts with the items [w * count /
+     * size(), (w + 1) * count / size()); runs must not overlap.
+     */
+    void run(size_t count, const task_function& fn) {
+        if (count == 0) {
+            return;
+        }
+        std::unique_lock<std::mutex> lock(mutex);
+        for (size_t w = 0; w < queues.size(); ++w) {
+            std::lock_guard<std::mutex> queue_lock(queues[w].mutex);
+            queues[w].begin = w * count / queues.size();
+            queues[w].end = (w + 1) * count / queues.size();
+        }
+        task = &fn;
+        error = nullptr;
+        error_set = false;
+        active = queues.size();
+        ++generation;
+        wakeup.notify_all();
+        done.wait(lock, [this] { return active == 0; });
+        task = nullptr;
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+private:
+    // items [begin, end) not yet claimed; the owner takes from the front,
+    // thieves from the back
+    struct alignas(64) queue {
+        std::mutex mutex;
+        size_t begin = 0;
+        size_t end = 0;
+    };
+
+    bool pop(size_t w, size_t& item) {
+        std::lock_guard<std::mutex> lock(queues[w].mutex);
+        if (queues[w].begin == queues[w].end) {
+            return false;
+        }
+        item = queues[w].begin++;
+        return true;
+    }
+
+    // moves the back half of the items of a victim to the queue of w
+    bool steal(size_t w) {
+        for (size_t k = 1; k < queues.size(); ++k) {
+            auto& victim = queues[(w + k) % queues.size()];
+            size_t begin, end;
+            {
+                std::lock_guard<std::mutex> lock(victim.mutex);
+                size_t available = victim.end - victim.begin;
+                if (available == 0) {
+                    continue;
+                }
+                end = victim.end;
+                begin = end - (available + 1) / 2;
+                victim.end = begin;
+            }
+            std::lock_guard<std::mutex> lock(queues[w].mutex);
+            queues[w].begin = begin;
+            queues[w].end = end;
+            return true;
+        }
+        return false;
+    }
+
+    void work(size_t w) {
+        uint64_t seen = 0;
+        for (;;) {
+            const task_function* fn;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wakeup.wait(lock, [&] { return stop || generation != seen; });
+                if (stop) {
+                    return;
+                }
+                seen = generation;
+                fn = task;
+            }
+
+            size_t item;
+            for (;;) {
+                if (!pop(w, item)) {
+                    if (steal(w)) {
+                        continue;
+                    }
+                    break; // all the items are taken
+                }
+                try {
+                    if (!error_set.load()) {
+                        (*fn)(w, item);
+                    }
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (!error) {
+                        error = std::current_exception();
+                        error_set = true;
+                    }
+                }
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--active == 0) {
+                done.notify_one();
+            }
+        }
+    }
+
+    std::vector<queue> queues;
+    std::vector<std::thread> threads;
+
+    std::mutex mutex;
+    std::condition_variable wakeup;
+    std::condition_variable done;
+    const task_function* task;
+    uint64_t generation;
+    size_t active;
+    std::atomic<bool> error_set{false};
+    std::exception_ptr error;
+    bool stop;
+};
+
+template <class Kernel, class Accumulator>
+class monte_carlo_runner {
+public:
+    typedef typename Kernel::state_type state_type;
+    typedef std::function<running_moments(const Accumulator& acc, size_t samples)> summary_function;
+
+    /** samples of a chunk of run_ordered() when chunk_size is 0 */
+    static const size_t ordered_chunk_size = 1 << 16;
+
+    /**
+     * chunk_size is the number of samples of a chunk, 0 to have about 16
+     * chunks per worker in run() and ordered_chunk_size in run_ordered()
+     */
+    explicit monte_carlo_runner(Kernel kernel,
+                                work_stealing_pool& pool = work_stealing_pool::shared(),
+                                size_t chunk_size = 0)
+        : kernel(std::move(kernel)),
+          pool(pool),
+          chunk_size(chunk_size),
+          workers(pool.size()),
+          monitor(nullptr),
+          counters(nullptr) {
+    }
+
+    /**
+     * reports each chunk to monitor, which needs a slot per worker, with
+     * the moments of the estimate given by summary from the accumulator
+     * of the chunk; nullptr to stop reporting
+     */
+    void set_progress(progress_monitor* monitor, summary_function summary = nullptr) {
+        if (monitor && monitor->size() < workers.size()) {
+            throw std::invalid_argument("monte_carlo_runner: the progress monitor has too few slots");
+        }
+        this->monitor = monitor;
+        this->summary = std::move(summary);
+    }
+
+    /**
+     * counts the kernel calls of each worker with counters, which needs a
+     * group per worker; nullptr to stop counting
+     */
+    void set_perf_counters(perf_counters* counters) {
+        if (counters && counters->size() < workers.size()) {
+            throw std::invalid_argument("monte_carlo_runner: the perf counters have too few groups");
+        }
+        this->counters = counters;
+    }
+
+    const Kernel& get_kernel() const {
+        return kernel;
+    }
+
+    size_t num_workers() const {
+        return workers.size();
+    }
+
+    /** samples of a chunk of run_ordered() */
+    size_t ordered_chunk() const {
+        return chunk_size ? chunk_size : ordered_chunk_size;
+    }
+
+    /** complete chunks merged by extend_ordered() so far */
+    size_t extended_count() const {
+        return extended_chunks;
+    }
+
+    /** the result of the complete chunks of extend_ordered() */
+    const Accumulator& extended_result() const {
+        return extended;
+    }
+
+    /**
+     * computes the samples [begin, end)
+     */
+    Accumulator run(size_t begin, size_t end) {
+        size_t n = end - begin;
+        size_t chunk = chunk_size ? chunk_size : std::max<size_t>(n / (16 * workers.size()), 1);
+        size_t chunks = (n + chunk - 1) / chunk;
+
+        for (auto& w : workers) {
+            w.acc = Accumulator();
+        }
+        pool.run(chunks, [&](size_t w, size_t c) {
+            auto& worker = workers[w];
+            if (!worker.state) {
+                worker.state.emplace(kernel.make_state(w));
+            }
+            size_t first = begin + c * chunk;
+            size_t last = std::min(first + chunk, end);
+            if (monitor) {
+                Accumulator acc;
+                compute(w, first, last, acc);
+                report(w, acc, last - first);
+                worker.acc.merge(acc);
+            } else {
+                compute(w, first, last, worker.acc);
+            }
+        });
+
+        // pairwise, so that each value takes part in log2(workers) merges
+        for (size_t stride = 1; stride < workers.size(); stride *= 2) {
+            for (size_t w = 0; w + stride < workers.size(); w += 2 * stride) {
+                workers[w].acc.merge(workers[w + stride].acc);
+            }
+        }
+        return workers[0].acc;
+    }
+
+    Accumulator run(size_t N) {
+        return run(0, N);
+    }
+
+    /**
+     * computes the samples [begin, end) with the result of a single
+     * thread; chunk c holds the samples [c * chunk, (c + 1) * chunk), so
+     * begin should be a multiple of the chunk size
+     */
+    Accumulator run_ordered(size_t begin, size_t end) {
+        Accumulator result;
+        for (auto& r : run_ordered_chunks(begin, end)) {
+            result.merge(r);
+        }
+        return result;
+    }
+
+    Accumulator run_ordered(size_t N) {
+        return run_ordered(0, N);
+    }
+
+    /**
+     * the result of run_ordered(N), computing only the chunks the previous
+     * call did not: the complete chunks are kept merged, and the last one,
+     * if partial, is computed again in full, with only its samples past the
+     * previous N reported to the monitor. A smaller N starts over.
+     */
+    Accumulator extend_ordered(size_t N) {
+        size_t chunk = ordered_chunk();
+        if (N < extended_chunks * chunk) {
+            extended = Accumulator();
+            extended_chunks = 0;
+            partial_samples = 0;
+        }
+        auto results = run_chunks(extended_chunks * chunk, N, partial_samples);
+        size_t complete = N / chunk - extended_chunks;
+        for (size_t c = 0; c < complete; ++c) {
+            extended.merge(results[c]);
+        }
+        extended_chunks += complete;
+
+        Accumulator result = extended;
+        partial_samples = 0;
+        for (size_t c = complete; c < results.size(); ++c) {
+            result.merge(results[c]);
+            partial = results[c];
+            partial_samples = N - extended_chunks * chunk;
+        }
+        return result;
+    }
+
+    /**
+     * continues extend_ordered() after the first chunks of a previous run,
+     * given their result, as from extended_count() and extended_result()
+     */
+    void resume_ordered(size_t chunks, const Accumulator& result) {
+        extended_chunks = chunks;
+        extended = result;
+        partial_samples = 0;
+    }
+
+    /**
+     * the accumulators of the chunks of the samples [begin, end) of
+     * run_ordered(), in chunk order, each of the samples of its chunk in
+     * [begin, end)
+     */
+    std::vector<Accumulator> run_ordered_chunks(size_t begin, size_t end) {
+        return run_chunks(begin, end, 0);
+    }
+
+private:
+    // run_ordered_chunks(), where the first `reported` samples of the first
+    // chunk went to the monitor before, as the partial chunk of
+    // extend_ordered()
+    std::vector<Accumulator> run_chunks(size_t begin, size_t end, size_t reported) {
+        size_t chunk = ordered_chunk();
+        size_t first_chunk = begin / chunk;
+        size_t chunks = end > begin ? (end - 1) / chunk + 1 - first_chunk : 0;
+
+        std::vector<Accumulator> results(chunks);
+        pool.run(chunks, [&](size_t w, size_t c) {
+            auto& worker = workers[w];
+            if (!worker.state) {
+                worker.state.emplace(kernel.make_state(w));
+            }
+            size_t id = first_chunk + c;
+            kernel.seed_chunk(*worker.state, id);
+            // into the accumulator of the worker, so that workers do not
+            // write to the same cache lines
+            worker.acc = Accumulator();
+            size_t first = std::max(begin, id * chunk);
+            size_t last = std::min((id + 1) * chunk, end);
+            compute(w, first, last, worker.acc);
+            if (monitor && reported && c == 0) {
+                auto moments = summary ? summary(worker.acc, last - first) : running_moments();
+                moments.remove(summary ? summary(partial, reported) : running_moments());
+                monitor->add(w, last - first - std::min(reported, last - first), moments);
+            } else if (monitor) {
+                report(w, worker.acc, last - first);
+            }
+            results[c] = std::move(worker.acc);
+        });
+        return results;
+    }
+
+    // the samples [first, last) on worker w, counted if there are counters
+    void compute(size_t w, size_t first, size_t last, Accumulator& acc) {
+        if (counters) {
+            counters->start(w);
+            kernel(*workers[w].state, first, last, acc);
+            counters->stop(w, last - first);
+        } else {
+            kernel(*workers[w].state, first, last, acc);
+        }
+    }
+
+    void report(size_t w, const Accumulator& acc, size_t samples) {
+        monitor->add(w, samples, summary ? summary(acc, samples) : running_moments());
+    }
+
+    struct alignas(64) worker_slot {
+        std::optional<state_type> state;
+        Accumulator acc;
+    };
+
+    Kernel kernel;
+    work_stealing_pool& pool;
+    size_t chunk_size;
+    std::vector<worker_slot> workers;
+
+    progress_monitor* monitor;
+    summary_function summary;
+    perf_counters* counters;
+
+    // merged complete chunks of extend_ordered()
+    Accumulator extended;
+    size_t extended_chunks = 0;
+    // the last chunk of extend_ordered() if partial, and its samples
+    Accumulator partial;
+    size_t partial_samples = 0;
+};
+
+#endif // MONTE_CARLO_HPP
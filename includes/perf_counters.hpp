@@ -0,0 +1,311 @@
+#pragma once
+/**
+ * @file perf_counters.hpp
+ *
+ * @brief hardware performance counters of the sampling threads, from
+ * perf_event_open(2), to tell whether a kernel is bound by computation,
+ * branches or memory
+ *
+ * Each worker opens, on its own thread and the first time it computes, a
+ * group of counters of that thread alone and of user space only: the task
+ * clock, which the kernel always provides, leads the group; cycles,
+ * instructions, L1D read misses, last level cache read misses and branch
+ * misses are added when the PMU has them. The group counts only while a
+ * kernel computes samples, so waiting and merging do not show up:
+ *
+ * @code
+ * perf_counters counters(runner.num_workers());
+ * runner.set_perf_counters(&counters);
+ * runner.run(N);
+ * counters.print(std::cout);
+ * @endcode
+ *
+ * gives the IPC and the cycles, instructions and misses per sample. The
+ * counters are read once at the end, scaled by time enabled over time
+ * running if the PMU was multiplexed. Counting costs two ioctl(2) per
+ * chunk. On hosts without a PMU, such as most virtual machines, or with a
+ * perf_event_paranoid above 2, the events missing are reported as such.
+ */
+#ifndef PERF_COUNTERS_HPP
+#define PERF_COUNTERS_HPP
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+class perf_counters {
+public:
+    enum event {
+        task_clock, // ns, the leader of the group
+        cycles,
+        instructions,
+        l1d_misses,
+        llc_misses,
+        branch_misses,
+        num_events
+    };
+
+    explicit perf_counters(size_t num_workers)
+        : slots(num_workers) {
+    }
+
+    perf_counters(const perf_counters&) = delete;
+    perf_counters& operator=(const perf_counters&) = delete;
+
+    ~perf_counters() {
+        for (auto& s : slots) {
+            for (int fd : s.fd) {
+                if (fd >= 0) {
+                    ::close(fd);
+                }
+            }
+        }
+    }
+
+    size_t size() const {
+        return slots.size();
+    }
+
+    /**
+     * from worker, on its thread, before computing samples
+     */
+    void start(size_t worker) {
+        auto& s = slots[worker];
+        if (!s.opened) {
+            open(s);
+        }
+        if (s.fd[task_clock] >= 0) {
+            ::ioctl(s.fd[task_clock], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        }
+    }
+
+    /**
+     * from worker, after computing samples more
+     */
+    void stop(size_t worker, uint64_t samples) {
+        auto& s = slots[worker];
+        if (s.fd[task_clock] >= 0) {
+            ::ioctl(s.fd[task_clock], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+        }
+        s.samples += samples;
+    }
+
+    /**
+     * the counts of a worker, or of all of them if worker is size(), when
+     * no worker computes; a negative count is an event not available
+     */
+    std::vector<double> counts(size_t worker) const {
+        std::vector<double> total(num_events, 0.0);
+        for (size_t w = 0; w < slots.size(); ++w) {
+            if (worker != slots.size() && w != worker) {
+                continue;
+            }
+            auto values = read(slots[w]);
+            for (size_t e = 0; e < num_events; ++e) {
+                if (values[e] < 0 || total[e] < 0) {
+                    total[e] = -1;
+                } else {
+                    total[e] += values[e];
+                }
+            }
+        }
+        return total;
+    }
+
+    uint64_t samples(size_t worker) const {
+        uint64_t total = 0;
+        for (size_t w = 0; w < slots.size(); ++w) {
+            if (worker == slots.size() || w == worker) {
+                total += slots[w].samples;
+            }
+        }
+        return total;
+    }
+
+    /**
+     * time, IPC and counts per sample of all the workers, and the IPC and
+     * cycles per sample of each
+     */
+    void print(std::ostream& out) const {
+        auto total = counts(slots.size());
+        double n = samples(slots.size());
+        std::string missing = error();
+
+        auto ratio = [](double a, double b) { return a < 0 || b <= 0 ? -1.0 : a / b; };
+        auto put = [&out](const char* label, double value, int precision) {
+            out << label;
+            if (value < 0) {
+                out << "n/a" << std::endl;
+            } else {
+                out << std::fixed << std::setprecision(precision) << value << std::endl;
+            }
+        };
+
+        out << "perf counters, " << slots.size() << " threads";
+        if (!missing.empty()) {
+            out << " (" << missing << ")";
+        }
+        out << std::endl;
+        put("  ns/sample           : ", ratio(total[task_clock], n), 3);
+        put("  IPC                 : ", ratio(total[instructions], total[cycles]), 3);
+        put("  cycles/sample       : ", ratio(total[cycles], n), 3);
+        put("  instructions/sample : ", ratio(total[instructions], n), 3);
+        put("  L1D misses/sample   : ", ratio(total[l1d_misses], n), 5);
+        put("  LLC misses/sample   : ", ratio(total[llc_misses], n), 5);
+        put("  branch misses/sample: ", ratio(total[branch_misses], n), 5);
+        if (slots.size() > 1 && total[cycles] >= 0) {
+            out << "  per thread (IPC, cycles/sample):";
+            for (size_t w = 0; w < slots.size(); ++w) {
+                auto c = counts(w);
+                double ws = samples(w);
+                if (ws == 0) {
+                    out << " -";
+                    continue;
+                }
+                out << " " << std::fixed << std::setprecision(2) << ratio(c[instructions], c[cycles])
+                    << "/" << std::setprecision(1) << ratio(c[cycles], ws);
+            }
+            out << std::endl;
+        }
+    }
+
+    /**
+     * why events are not counted, empty if all are
+     */
+    std::string error() const {
+        for (auto& s : slots) {
+            if (!s.opened || !s.error) {
+                continue;
+            }
+            std::string reason = std::strerror(s.error);
+            if (s.error == ENOENT || s.error == EOPNOTSUPP) {
+                reason = "not supported by this host";
+            } else if (s.error == EACCES || s.error == EPERM) {
+                reason = "not permitted, see /proc/sys/kernel/perf_event_paranoid";
+            }
+            return std::string(event_name(s.error_event)) + ": " + reason;
+        }
+        return "";
+    }
+
+private:
+    struct alignas(64) slot {
+        bool opened = false;
+        int fd[num_events] = {-1, -1, -1, -1, -1, -1};
+        uint64_t samples = 0;
+        int error = 0;         // errno of the first event that failed to open
+        event error_event = task_clock;
+    };
+
+    static const char* event_name(event e) {
+        static const char* names[] = {
+            "task-clock", "cycles", "instructions", "L1-dcache-load-misses", "LLC-load-misses", "branch-misses"
+        };
+        return names[e];
+    }
+
+    static perf_event_attr attributes(event e) {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        auto cache_miss = [](uint64_t cache) {
+            return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        };
+        switch (e) {
+        case task_clock:
+            attr.type = PERF_TYPE_SOFTWARE;
+            attr.config = PERF_COUNT_SW_TASK_CLOCK;
+            attr.disabled = 1;
+            attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            break;
+        case cycles:
+            attr.config = PERF_COUNT_HW_CPU_CYCLES;
+            break;
+        case instructions:
+            attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+            break;
+        case l1d_misses:
+            attr.type = PERF_TYPE_HW_CACHE;
+            attr.config = cache_miss(PERF_COUNT_HW_CACHE_L1D);
+            break;
+        case llc_misses:
+            attr.type = PERF_TYPE_HW_CACHE;
+            attr.config = cache_miss(PERF_COUNT_HW_CACHE_LL);
+            break;
+        default:
+            attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+            break;
+        }
+        return attr;
+    }
+
+    // the group of the calling thread, in the order of event
+    static void open(slot& s) {
+        s.opened = true;
+        for (int e = 0; e < num_events; ++e) {
+            auto attr = attributes(event(e));
+            int group = e == task_clock ? -1 : s.fd[task_clock];
+            int fd = ::syscall(SYS_perf_event_open, &attr, 0, -1, group, 0);
+            if (fd < 0) {
+                if (!s.error) {
+                    s.error = errno;
+                    s.error_event = event(e);
+                }
+                if (e == task_clock) {
+                    return;
+                }
+                continue;
+            }
+            s.fd[e] = fd;
+        }
+    }
+
+    // the counts of the group of s, scaled if the PMU was multiplexed
+    static std::vector<double> read(const slot& s) {
+        std::vector<double> values(num_events, -1.0);
+        if (s.fd[task_clock] < 0) {
+            if (!s.opened) {
+                // the worker computed nothing
+                std::fill(values.begin(), values.end(), 0.0);
+            }
+            return values;
+        }
+        // nr, time enabled, time running and a value per open event
+        uint64_t data[3 + num_events];
+        if (::read(s.fd[task_clock], data, sizeof(data)) < ssize_t(3 * sizeof(uint64_t))) {
+            return values;
+        }
+        if (data[2] == 0) {
+            // enabled but never scheduled on the PMU
+            if (data[1] == 0) {
+                std::fill(values.begin(), values.end(), 0.0);
+            }
+            return values;
+        }
+        double scale = double(data[1]) / data[2];
+        size_t k = 3;
+        for (size_t e = 0; e < num_events && k < 3 + data[0]; ++e) {
+            if (s.fd[e] >= 0) {
+                values[e] = data[k++] * scale;
+            }
+        }
+        return values;
+    }
+
+    std::vector<slot> slots;
+};
+
+#endif // PERF_COUNTERS_HPP
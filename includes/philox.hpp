@@ -0,0 +1,175 @@
+#pragma once
+/**
+ * @file philox.hpp
+ *
+ * @brief Philox4x32-10 counter-based pseudorandom number generator.
+ *
+ * J. K. Salmon, M. A. Moraes, R. O. Dror and D. E. Shaw, "Parallel random
+ * numbers: as easy as 1, 2, 3", SC'11.
+ *
+ * Philox is a keyed bijection of a 128-bit counter: block n of a stream
+ * is philox4x32_10({n_lo, n_hi, stream_lo, stream_hi}, {seed_lo, seed_hi}).
+ * There is no state, so any thread can compute any block directly and the
+ * numbers a computation draws do not depend on how it is split in threads.
+ *
+ * The fill functions compute 8 blocks per iteration with AVX2 when it is
+ * available; the output is the same with and without it.
+ */
+#ifndef PHILOX_HPP
+#define PHILOX_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+typedef std::array<uint32_t, 4> philox4x32_ctr;
+typedef std::array<uint32_t, 2> philox4x32_key;
+
+static const uint32_t PHILOX_M0 = 0xD2511F53;
+static const uint32_t PHILOX_M1 = 0xCD9E8D57;
+static const uint32_t PHILOX_W0 = 0x9E3779B9;
+static const uint32_t PHILOX_W1 = 0xBB67AE85;
+static const int PHILOX_ROUNDS = 10;
+
+/**
+ * computes one block, four 32-bit numbers
+ */
+inline philox4x32_ctr philox4x32_10(philox4x32_ctr ctr, philox4x32_key key) {
+    for (int round = 0; round < PHILOX_ROUNDS; ++round) {
+        uint64_t prod0 = uint64_t(PHILOX_M0) * ctr[0];
+        uint64_t prod1 = uint64_t(PHILOX_M1) * ctr[2];
+        ctr = {{uint32_t(prod1 >> 32) ^ ctr[1] ^ key[0],
+                uint32_t(prod1),
+                uint32_t(prod0 >> 32) ^ ctr[3] ^ key[1],
+                uint32_t(prod0)}};
+        key[0] += PHILOX_W0;
+        key[1] += PHILOX_W1;
+    }
+    return ctr;
+}
+
+inline philox4x32_key philox4x32_make_key(uint64_t seed) {
+    return {{uint32_t(seed), uint32_t(seed >> 32)}};
+}
+
+inline philox4x32_ctr philox4x32_make_ctr(uint64_t stream, uint64_t block) {
+    return {{uint32_t(block), uint32_t(block >> 32), uint32_t(stream), uint32_t(stream >> 32)}};
+}
+
+#if defined(__AVX2__)
+/**
+ * lo and hi halves of the 32x32 bit products of 8 lanes
+ */
+inline void philox_mulhilo8(__m256i a, __m256i m, __m256i& lo, __m256i& hi) {
+    __m256i even = _mm256_mul_epu32(a, m);
+    __m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), m);
+    lo = _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xAA);
+    hi = _mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0xAA);
+}
+
+/**
+ * computes blocks first_block ... first_block + 7 into out[0] ... out[31]
+ */
+inline void philox4x32_10_x8(uint64_t stream, uint64_t first_block, philox4x32_key key, uint32_t* out) {
+    alignas(32) uint32_t lo_words[8];
+    alignas(32) uint32_t hi_words[8];
+    for (int lane = 0; lane < 8; ++lane) {
+        lo_words[lane] = uint32_t(first_block + lane);
+        hi_words[lane] = uint32_t((first_block + lane) >> 32);
+    }
+    __m256i c0 = _mm256_load_si256((const __m256i*)lo_words);
+    __m256i c1 = _mm256_load_si256((const __m256i*)hi_words);
+    __m256i c2 = _mm256_set1_epi32(int(uint32_t(stream)));
+    __m256i c3 = _mm256_set1_epi32(int(uint32_t(stream >> 32)));
+    const __m256i m0 = _mm256_set1_epi32(int(PHILOX_M0));
+    const __m256i m1 = _mm256_set1_epi32(int(PHILOX_M1));
+
+    for (int round = 0; round < PHILOX_ROUNDS; ++round) {
+        __m256i lo0, hi0, lo1, hi1;
+        philox_mulhilo8(c0, m0, lo0, hi0);
+        philox_mulhilo8(c2, m1, lo1, hi1);
+        __m256i k0 = _mm256_set1_epi32(int(key[0]));
+        __m256i k1 = _mm256_set1_epi32(int(key[1]));
+        c0 = _mm256_xor_si256(_mm256_xor_si256(hi1, c1), k0);
+        c1 = lo1;
+        c2 = _mm256_xor_si256(_mm256_xor_si256(hi0, c3), k1);
+        c3 = lo0;
+        key[0] += PHILOX_W0;
+        key[1] += PHILOX_W1;
+    }
+
+    // transpose the four words of the eight lanes into eight blocks
+    __m256i t0 = _mm256_unpacklo_epi32(c0, c1);
+    __m256i t1 = _mm256_unpackhi_epi32(c0, c1);
+    __m256i t2 = _mm256_unpacklo_epi32(c2, c3);
+    __m256i t3 = _mm256_unpackhi_epi32(c2, c3);
+    __m256i u0 = _mm256_unpacklo_epi64(t0, t2);
+    __m256i u1 = _mm256_unpackhi_epi64(t0, t2);
+    __m256i u2 = _mm256_unpacklo_epi64(t1, t3);
+    __m256i u3 = _mm256_unpackhi_epi64(t1, t3);
+    _mm256_storeu_si256((__m256i*)(out), _mm256_permute2x128_si256(u0, u1, 0x20));
+    _mm256_storeu_si256((__m256i*)(out + 8), _mm256_permute2x128_si256(u2, u3, 0x20));
+    _mm256_storeu_si256((__m256i*)(out + 16), _mm256_permute2x128_si256(u0, u1, 0x31));
+    _mm256_storeu_si256((__m256i*)(out + 24), _mm256_permute2x128_si256(u2, u3, 0x31));
+}
+#endif
+
+/**
+ * fills out with blocks first_block ... first_block + blocks - 1 of a
+ * stream, that is, 4 * blocks 32-bit numbers
+ */
+inline void philox4x32_fill(uint64_t seed, uint64_t stream, uint64_t first_block, uint32_t* out, size_t blocks) {
+    auto key = philox4x32_make_key(seed);
+    size_t i = 0;
+#if defined(__AVX2__)
+    for (; i + 8 <= blocks; i += 8) {
+        philox4x32_10_x8(stream, first_block + i, key, out + 4 * i);
+    }
+#endif
+    for (; i < blocks; ++i) {
+        auto r = philox4x32_10(philox4x32_make_ctr(stream, first_block + i), key);
+        out[4 * i] = r[0];
+        out[4 * i + 1] = r[1];
+        out[4 * i + 2] = r[2];
+        out[4 * i + 3] = r[3];
+    }
+}
+
+static const size_t PHILOX_CHUNK_BLOCKS = 64;
+
+/**
+ * same as philox4x32_fill, as doubles on [0,1] computed like sfmt_to_real1
+ */
+inline void philox4x32_fill_real1(uint64_t seed, uint64_t stream, uint64_t first_block, double* out, size_t blocks) {
+    uint32_t ints[4 * PHILOX_CHUNK_BLOCKS];
+    for (size_t done = 0; done < blocks; done += PHILOX_CHUNK_BLOCKS) {
+        size_t count = std::min(PHILOX_CHUNK_BLOCKS, blocks - done);
+        philox4x32_fill(seed, stream, first_block + done, ints, count);
+        for (size_t i = 0; i < 4 * count; ++i) {
+            out[4 * done + i] = ints[i] * (1.0 / 4294967295.0);
+        }
+    }
+}
+
+/**
+ * same as philox4x32_fill, as doubles on [0,1) with 53-bit resolution,
+ * two per block, computed like sfmt_to_res53
+ */
+inline void philox4x32_fill_res53(uint64_t seed, uint64_t stream, uint64_t first_block, double* out, size_t blocks) {
+    uint32_t ints[4 * PHILOX_CHUNK_BLOCKS];
+    for (size_t done = 0; done < blocks; done += PHILOX_CHUNK_BLOCKS) {
+        size_t count = std::min(PHILOX_CHUNK_BLOCKS, blocks - done);
+        philox4x32_fill(seed, stream, first_block + done, ints, count);
+        for (size_t i = 0; i < 2 * count; ++i) {
+            uint64_t v = ints[2 * i] | (uint64_t(ints[2 * i + 1]) << 32);
+            out[2 * done + i] = (v >> 11) * (1.0 / 9007199254740992.0);
+        }
+    }
+}
+
+#endif // PHILOX_HPP
@@ -0,0 +1,226 @@
+#pragma once
+/**
+ * @file progress.hpp
+ *
+ * @brief live throughput and estimate of a running simulation, as JSON
+ * lines written by a reporter thread
+ *
+ * Each worker publishes its samples and the moments of its estimate in
+ * its own cache line, once per chunk, with relaxed stores behind a
+ * sequence counter; nothing is shared between workers and the sampling
+ * loops are not touched. Every interval the reporter writes a line like
+ *
+ * @verbatim
+ {"time":12.001,"samples":1258291200,"target":10000000000,"rate":1.048e+08,
+  "eta":107.4,"thread_rates":[2.62e+07,2.61e+07,2.63e+07,2.62e+07],
+  "mean":168.565,"ci":0.00214}
+@endverbatim
+ *
+ * (on one line), where rate is in samples per second, eta in seconds and
+ * ci the half-width of the confidence interval of level 1 - delta of the
+ * mean. monte_carlo_runner::set_progress() connects a runner.
+ */
+#ifndef PROGRESS_HPP
+#define PROGRESS_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include <boost/math/distributions/normal.hpp>
+#include "running_moments.hpp"
+
+class progress_monitor {
+public:
+    /**
+     * reports to path, appending, or to stderr if path is empty
+     */
+    progress_monitor(size_t num_workers, const std::string& path,
+                     std::chrono::steady_clock::duration interval = std::chrono::seconds(10),
+                     double delta = 0.05)
+        : slots(num_workers),
+          interval(interval),
+          z(boost::math::quantile(boost::math::normal(), 1 - delta / 2)),
+          target(0),
+          base_samples(0),
+          stop(false),
+          start_tp(std::chrono::steady_clock::now()) {
+        if (!path.empty()) {
+            file.reset(new std::ofstream(path, std::ios::app));
+            if (!*file) {
+                throw std::runtime_error("progress_monitor: cannot open " + path);
+            }
+        }
+        reporter = std::thread([this] { report_loop(); });
+    }
+
+    progress_monitor(const progress_monitor&) = delete;
+    progress_monitor& operator=(const progress_monitor&) = delete;
+
+    /**
+     * writes a last line and stops the reporter
+     */
+    ~progress_monitor() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        wakeup.notify_one();
+        reporter.join();
+    }
+
+    size_t size() const {
+        return slots.size();
+    }
+
+    /**
+     * samples done before the workers started, as by a resumed run, with
+     * the moments of their estimate, and the samples the run goes to, for
+     * the ETA
+     */
+    void set_base(uint64_t samples, const running_moments& moments = running_moments()) {
+        std::lock_guard<std::mutex> lock(mutex);
+        base_samples = samples;
+        base_moments = moments;
+    }
+
+    void set_target(uint64_t samples) {
+        target = samples;
+    }
+
+    /**
+     * from worker, after computing samples more with the given moments
+     */
+    void add(size_t worker, uint64_t samples, const running_moments& moments) {
+        auto& s = slots[worker];
+        s.own_samples += samples;
+        s.own_moments.merge(moments);
+
+        uint64_t v = s.version.load(std::memory_order_relaxed);
+        s.version.store(v + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        s.samples.store(s.own_samples, std::memory_order_relaxed);
+        s.count.store(s.own_moments.count(), std::memory_order_relaxed);
+        s.mean.store(s.own_moments.mean(), std::memory_order_relaxed);
+        s.sum_sq.store(s.own_moments.sum_sq(), std::memory_order_relaxed);
+        s.version.store(v + 2, std::memory_order_release);
+    }
+
+private:
+    struct alignas(64) slot {
+        // published, written by the worker only
+        std::atomic<uint64_t> version{0}; // odd while the worker writes
+        std::atomic<uint64_t> samples{0};
+        std::atomic<uint64_t> count{0};
+        std::atomic<double> mean{0.0};
+        std::atomic<double> sum_sq{0.0};
+        // seen by the worker only
+        uint64_t own_samples = 0;
+        running_moments own_moments;
+    };
+
+    // a consistent copy of what a worker published
+    void read(const slot& s, uint64_t& samples, running_moments& moments) const {
+        for (;;) {
+            uint64_t v = s.version.load(std::memory_order_acquire);
+            if (v & 1) {
+                std::this_thread::yield();
+                continue;
+            }
+            samples = s.samples.load(std::memory_order_relaxed);
+            uint64_t count = s.count.load(std::memory_order_relaxed);
+            double mean = s.mean.load(std::memory_order_relaxed);
+            double sum_sq = s.sum_sq.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (s.version.load(std::memory_order_relaxed) == v) {
+                moments = running_moments(count, mean, sum_sq);
+                return;
+            }
+        }
+    }
+
+    void report_loop() {
+        std::vector<uint64_t> last(slots.size(), 0);
+        auto last_tp = start_tp;
+        bool done = false;
+        while (!done) {
+            uint64_t total;
+            running_moments moments;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                done = wakeup.wait_for(lock, interval, [this] { return stop; });
+                total = base_samples;
+                moments = base_moments;
+            }
+            auto now = std::chrono::steady_clock::now();
+            double elapsed = std::chrono::duration<double>(now - last_tp).count();
+            last_tp = now;
+
+            std::vector<double> rates(slots.size());
+            double rate = 0;
+            for (size_t w = 0; w < slots.size(); ++w) {
+                uint64_t samples;
+                running_moments m;
+                read(slots[w], samples, m);
+                rates[w] = elapsed > 0 ? (samples - last[w]) / elapsed : 0.0;
+                rate += rates[w];
+                last[w] = samples;
+                total += samples;
+                moments.merge(m);
+            }
+
+            std::ostringstream line;
+            line.precision(6);
+            line << "{\"time\":" << std::chrono::duration<double>(now - start_tp).count()
+                 << ",\"samples\":" << total
+                 << ",\"target\":" << target.load()
+                 << ",\"rate\":" << rate;
+            if (rate > 0 && target.load() > total) {
+                line << ",\"eta\":" << (target.load() - total) / rate;
+            } else {
+                line << ",\"eta\":0";
+            }
+            line << ",\"thread_rates\":[";
+            for (size_t w = 0; w < rates.size(); ++w) {
+                line << (w ? "," : "") << rates[w];
+            }
+            line << "]";
+            if (moments.count() > 1) {
+                line << ",\"mean\":" << moments.mean()
+                     << ",\"ci\":" << z * std::sqrt(moments.variance() / moments.count());
+            }
+            line << "}\n";
+
+            std::ostream& out = file ? *file : std::cerr;
+            out << line.str();
+            out.flush();
+        }
+    }
+
+    std::vector<slot> slots;
+    const std::chrono::steady_clock::duration interval;
+    const double z;
+    std::atomic<uint64_t> target;
+
+    std::unique_ptr<std::ofstream> file;
+    std::mutex mutex; // for the base and stop
+    uint64_t base_samples;
+    running_moments base_moments;
+    std::condition_variable wakeup;
+    bool stop;
+    const std::chrono::steady_clock::time_point start_tp;
+    std::thread reporter;
+};
+
+#endif // PROGRESS_HPP
@@ -0,0 +1,94 @@
+#pragma once
+#ifndef QMC_SOBOL_PARAMS_H
+#define QMC_SOBOL_PARAMS_H
+
+/* generated by calc-sobol, do not edit */
+
+#define SOBOL_MAX_DIMENSION 64
+#define SOBOL_MAX_DEGREE 9
+
+/* degree s, coefficients a_1 ... a_(s-1) of the primitive polynomial
+   (a_1 is the highest bit) and initial direction numbers m_1 ... m_s;
+   dimension 1 is the van der Corput sequence */
+static const unsigned sobol_degree[SOBOL_MAX_DIMENSION] = {
+    1, 1, 2, 3, 3, 4, 4, 5, 5, 5, 5, 5, 5, 6, 6, 6,
+    6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+};
+
+static const unsigned sobol_a[SOBOL_MAX_DIMENSION] = {
+    0, 0, 1, 1, 2, 1, 4, 2, 4, 7, 11, 13, 14, 1, 13, 16,
+    19, 22, 25, 1, 4, 7, 8, 14, 19, 21, 28, 31, 32, 37, 41, 42,
+    50, 55, 56, 59, 62, 14, 21, 22, 38, 47, 49, 50, 52, 56, 67, 70,
+    84, 97, 103, 115, 122, 8, 13, 16, 22, 25, 44, 47, 52, 55, 59, 62,
+};
+
+static const unsigned sobol_m[SOBOL_MAX_DIMENSION][SOBOL_MAX_DEGREE] = {
+    {1},
+    {1},
+    {1, 3},
+    {1, 3, 1},
+    {1, 1, 5},
+    {1, 1, 5, 5},
+    {1, 1, 3, 7},
+    {1, 1, 7, 9, 19},
+    {1, 3, 1, 5, 1},
+    {1, 3, 7, 7, 17},
+    {1, 1, 1, 13, 15},
+    {1, 1, 3, 3, 15},
+    {1, 3, 3, 15, 3},
+    {1, 1, 5, 13, 1, 5},
+    {1, 1, 7, 15, 13, 47},
+    {1, 1, 3, 9, 19, 13},
+    {1, 1, 3, 7, 29, 13},
+    {1, 1, 5, 7, 19, 17},
+    {1, 3, 5, 11, 11, 43},
+    {1, 3, 1, 1, 3, 7, 79},
+    {1, 1, 7, 7, 7, 33, 41},
+    {1, 3, 5, 3, 31, 37, 9},
+    {1, 3, 5, 7, 9, 9, 103},
+    {1, 3, 1, 9, 13, 31, 89},
+    {1, 3, 3, 9, 21, 35, 77},
+    {1, 3, 5, 3, 25, 31, 91},
+    {1, 3, 3, 3, 11, 43, 15},
+    {1, 1, 3, 11, 29, 3, 1},
+    {1, 1, 3, 9, 3, 31, 99},
+    {1, 3, 3, 1, 31, 15, 57},
+    {1, 3, 5, 13, 21, 1, 49},
+    {1, 1, 1, 3, 3, 37, 17},
+    {1, 1, 1, 5, 5, 19, 109},
+    {1, 3, 5, 1, 3, 15, 5},
+    {1, 3, 7, 7, 25, 19, 27},
+    {1, 1, 7, 9, 19, 15, 37},
+    {1, 3, 5, 9, 23, 31, 99},
+    {1, 3, 7, 5, 9, 63, 87, 247},
+    {1, 1, 7, 11, 3, 7, 3, 85},
+    {1, 1, 5, 7, 9, 17, 65, 197},
+    {1, 1, 5, 13, 19, 51, 67, 73},
+    {1, 1, 1, 11, 3, 29, 23, 229},
+    {1, 3, 1, 11, 19, 3, 55, 215},
+    {1, 3, 7, 13, 17, 25, 51, 119},
+    {1, 1, 5, 5, 27, 45, 79, 75},
+    {1, 3, 1, 9, 13, 31, 97, 157},
+    {1, 1, 1, 1, 27, 51, 93, 17},
+    {1, 1, 7, 9, 5, 35, 25, 171},
+    {1, 3, 7, 7, 27, 37, 103, 125},
+    {1, 3, 1, 5, 29, 29, 49, 133},
+    {1, 1, 1, 3, 27, 61, 59, 185},
+    {1, 1, 1, 1, 1, 3, 9, 169},
+    {1, 3, 7, 11, 5, 19, 51, 253},
+    {1, 3, 3, 7, 19, 45, 3, 109, 325},
+    {1, 1, 7, 3, 21, 53, 1, 7, 335},
+    {1, 1, 7, 9, 5, 3, 121, 9, 101},
+    {1, 1, 1, 5, 19, 31, 49, 143, 35},
+    {1, 1, 7, 13, 21, 17, 85, 213, 435},
+    {1, 3, 1, 3, 13, 9, 91, 139, 303},
+    {1, 3, 1, 11, 21, 45, 117, 101, 467},
+    {1, 3, 3, 7, 13, 53, 87, 97, 109},
+    {1, 3, 7, 13, 13, 63, 101, 237, 385},
+    {1, 3, 1, 5, 25, 17, 85, 17, 51},
+    {1, 1, 1, 9, 27, 39, 85, 177, 213},
+};
+
+#endif /* QMC_SOBOL_PARAMS_H */
@@ -0,0 +1,323 @@
+#pragma once
+/**
+ * @file qmc.hpp
+ *
+ * @brief randomized quasi-Monte Carlo point sets: scrambled Sobol and
+ * Halton sequences in up to 64 dimensions
+ *
+ * A sequence is built from a seed, and different seeds give independent
+ * randomizations (replicates) of the same low-discrepancy points. Each
+ * point of a randomized sequence is uniform on [0,1)^D, so the mean of a
+ * replicate is an unbiased estimate and the spread of the means of
+ * independent replicates gives its variance.
+ *
+ * Points are computed from their index, so threads can share a replicate
+ * by seeking each one to its own index range:
+ *
+ * @code
+ * sobol_sequence seq(6, sobol_sequence::owen, replicate);
+ * seq.seek(begin);
+ * seq.fill(points, end - begin); // 6 coordinates per point
+ * @endcode
+ *
+ * Sobol direction numbers are those of qmc-sobol-params.h, see
+ * src/qmc/calc-sobol.cpp. The Owen scrambling is the hash-based nested
+ * uniform scrambling of B. Burley, "Practical Hash-based Owen
+ * Scrambling", JCGT 9(4), 2020.
+ */
+#ifndef QMC_HPP
+#define QMC_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "qmc-sobol-params.h"
+
+/**
+ * splitmix64 finalizer, derives independent seeds and bits from a seed
+ */
+inline uint64_t qmc_hash(uint64_t x) {
+    x += 0x9E3779B97F4A7C15ull;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+    return x ^ (x >> 31);
+}
+
+class sobol_sequence {
+public:
+    enum scrambling {
+        none,          // the plain sequence, deterministic
+        digital_shift, // xor of a random 53-bit shift per dimension
+        owen           // nested uniform scrambling of each dimension
+    };
+
+    static const unsigned max_dimension = SOBOL_MAX_DIMENSION;
+    /** the sequence has 2^32 points */
+    static const uint64_t max_points = uint64_t(1) << 32;
+
+    sobol_sequence(unsigned dimension, scrambling scramble, uint64_t seed)
+        : dimension(dimension),
+          scramble(scramble),
+          directions(dimension * bits),
+          seeds(dimension),
+          shifts(dimension),
+          x(dimension) {
+        if (dimension == 0 || dimension > max_dimension) {
+            throw std::invalid_argument("sobol_sequence: unsupported dimension");
+        }
+        for (unsigned d = 0; d < dimension; ++d) {
+            uint32_t* v = &directions[d * bits];
+            unsigned s = sobol_degree[d];
+            for (unsigned k = 0; k < bits; ++k) {
+                if (d == 0) {
+                    v[k] = uint32_t(1) << (bits - 1 - k);
+                } else if (k < s) {
+                    v[k] = sobol_m[d][k] << (bits - 1 - k);
+                } else {
+                    v[k] = v[k - s] ^ (v[k - s] >> s);
+                    for (unsigned j = 1; j < s; ++j) {
+                        if ((sobol_a[d] >> (s - 1 - j)) & 1) {
+                            v[k] ^= v[k - j];
+                        }
+                    }
+                }
+            }
+            seeds[d] = qmc_hash(seed * max_dimension + d);
+            shifts[d] = qmc_hash(seeds[d]) >> 11;
+        }
+        seek(0);
+    }
+
+    /**
+     * the next point is the one of the given index
+     */
+    void seek(uint64_t index) {
+        if (index >= max_points) {
+            throw std::out_of_range("sobol_sequence: index out of range");
+        }
+        next_index = index;
+        // points are in gray code order, x = xor of the directions of the bits of index ^ (index >> 1)
+        uint64_t gray = index ^ (index >> 1);
+        for (unsigned d = 0; d < dimension; ++d) {
+            x[d] = 0;
+            for (unsigned k = 0; k < bits; ++k) {
+                if ((gray >> k) & 1) {
+                    x[d] ^= directions[d * bits + k];
+                }
+            }
+        }
+    }
+
+    uint64_t index() const {
+        return next_index;
+    }
+
+    /**
+     * writes the coordinates of the next point
+     */
+    void next(double* point) {
+        fill(point, 1);
+    }
+
+    /**
+     * writes the next count points, dimension coordinates each
+     */
+    void fill(double* points, size_t count) {
+        if (count > max_points - next_index) {
+            throw std::out_of_range("sobol_sequence: no more points");
+        }
+        switch (scramble) {
+        case digital_shift:
+            fill_points<digital_shift>(points, count);
+            break;
+        case owen:
+            fill_points<owen>(points, count);
+            break;
+        default:
+            fill_points<none>(points, count);
+            break;
+        }
+    }
+
+private:
+    static const unsigned bits = 32;
+
+    template <scrambling Scramble>
+    void fill_points(double* points, size_t count) {
+        for (size_t i = 0; i < count; ++i, points += dimension) {
+            for (unsigned d = 0; d < dimension; ++d) {
+                points[d] = coordinate<Scramble>(d);
+            }
+            // the next gray code differs in the lowest zero bit of index
+            ++next_index;
+            if (next_index < max_points) {
+                const uint32_t* v = &directions[__builtin_ctzll(next_index)];
+                for (unsigned d = 0; d < dimension; ++d) {
+                    x[d] ^= v[d * bits];
+                }
+            }
+        }
+    }
+
+    template <scrambling Scramble>
+    double coordinate(unsigned d) const {
+        // 32 bits from the sequence, the 21 lower bits of the 53-bit double are random
+        uint64_t value;
+        if (Scramble == digital_shift) {
+            value = (uint64_t(x[d]) << 21) ^ shifts[d];
+        } else if (Scramble == owen) {
+            value = (uint64_t(nested_uniform_scramble(x[d], uint32_t(seeds[d]))) << 21)
+                  | (qmc_hash(seeds[d] ^ next_index) >> 43);
+        } else {
+            value = uint64_t(x[d]) << 21;
+        }
+        return value * (1.0 / 9007199254740992.0);
+    }
+
+    static uint32_t reverse_bits(uint32_t v) {
+        v = ((v >> 1) & 0x55555555u) | ((v & 0x55555555u) << 1);
+        v = ((v >> 2) & 0x33333333u) | ((v & 0x33333333u) << 2);
+        v = ((v >> 4) & 0x0F0F0F0Fu) | ((v & 0x0F0F0F0Fu) << 4);
+        v = ((v >> 8) & 0x00FF00FFu) | ((v & 0x00FF00FFu) << 8);
+        return (v >> 16) | (v << 16);
+    }
+
+    /**
+     * a hash whose output bits only depend on the same and lower input
+     * bits, so that applied to the reversed value it flips each digit
+     * depending on the higher digits only, as Owen's scrambling
+     */
+    static uint32_t laine_karras_permutation(uint32_t v, uint32_t seed) {
+        v += seed;
+        v ^= v * 0x6c50b47cu;
+        v ^= v * 0xb82f1e52u;
+        v ^= v * 0xc7afe638u;
+        v ^= v * 0x8d22f6e6u;
+        return v;
+    }
+
+    static uint32_t nested_uniform_scramble(uint32_t v, uint32_t seed) {
+        return reverse_bits(laine_karras_permutation(reverse_bits(v), seed));
+    }
+
+    unsigned dimension;
+    scrambling scramble;
+    std::vector<uint32_t> directions;
+    std::vector<uint64_t> seeds;
+    std::vector<uint64_t> shifts;
+    std::vector<uint32_t> x;
+    uint64_t next_index;
+};
+
+/**
+ * Halton sequence, scrambled with a random permutation of the digits of
+ * each digit position of each dimension (random digit scrambling)
+ */
+class halton_sequence {
+public:
+    static const unsigned max_dimension = 64;
+
+    halton_sequence(unsigned dimension, bool scrambled, uint64_t seed)
+        : dimension(dimension),
+          next_index(0) {
+        static const unsigned primes[max_dimension] = {
+            2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53,
+            59, 61, 67, 71, 73, 79, 83, 89, 97, 101, 103, 107, 109, 113, 127, 131,
+            137, 139, 149, 151, 157, 163, 167, 173, 179, 181, 191, 193, 197, 199, 211, 223,
+            227, 229, 233, 239, 241, 251, 257, 263, 269, 271, 277, 281, 283, 293, 307, 311,
+        };
+        if (dimension == 0 || dimension > max_dimension) {
+            throw std::invalid_argument("halton_sequence: unsupported dimension");
+        }
+        uint64_t state = seed;
+        for (unsigned d = 0; d < dimension; ++d) {
+            base_info info;
+            info.base = primes[d];
+            // enough digits for the 53 bits of a double
+            info.digits = 0;
+            for (double scale = 1.0; scale > 0x1p-53; scale /= info.base) {
+                ++info.digits;
+            }
+            info.offset = permutations.size();
+            info.tails = tails.size();
+            for (unsigned k = 0; k < info.digits; ++k) {
+                size_t first = permutations.size();
+                for (unsigned b = 0; b < info.base; ++b) {
+                    permutations.push_back(uint16_t(b));
+                }
+                if (scrambled) {
+                    // Fisher-Yates
+                    for (unsigned b = info.base - 1; b > 0; --b) {
+                        state = qmc_hash(state);
+                        unsigned j = unsigned((unsigned __int128)state * (b + 1) >> 64);
+                        std::swap(permutations[first + b], permutations[first + j]);
+                    }
+                }
+            }
+            // tails[k], the value of the permuted zero digits k, k+1, ...
+            tails.resize(tails.size() + info.digits + 1);
+            double* tail = &tails[info.tails];
+            tail[info.digits] = 0.0;
+            for (unsigned k = info.digits; k-- > 0;) {
+                tail[k] = (permutations[info.offset + k * info.base] + tail[k + 1]) / info.base;
+            }
+            bases.push_back(info);
+        }
+    }
+
+    void seek(uint64_t index) {
+        next_index = index;
+    }
+
+    uint64_t index() const {
+        return next_index;
+    }
+
+    void next(double* point) {
+        for (unsigned d = 0; d < dimension; ++d) {
+            point[d] = radical_inverse(bases[d], next_index);
+        }
+        ++next_index;
+    }
+
+    void fill(double* points, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            next(points + i * dimension);
+        }
+    }
+
+private:
+    struct base_info {
+        unsigned base;
+        unsigned digits;
+        size_t offset;
+        size_t tails;
+    };
+
+    double radical_inverse(const base_info& info, uint64_t index) const {
+        const uint16_t* perm = &permutations[info.offset];
+        double inverse_base = 1.0 / info.base;
+        double scale = inverse_base;
+        double value = 0.0;
+        unsigned k = 0;
+        for (; index != 0 && k < info.digits; ++k) {
+            value += perm[index % info.base] * scale;
+            index /= info.base;
+            scale *= inverse_base;
+            perm += info.base;
+        }
+        // the digits past the last digit of index are zeros, also permuted
+        value += tails[info.tails + k] * scale * info.base;
+        return value < 1.0 ? value : 0x1.fffffffffffffp-1;
+    }
+
+    unsigned dimension;
+    std::vector<base_info> bases;
+    std::vector<uint16_t> permutations;
+    std::vector<double> tails;
+    uint64_t next_index;
+};
+
+#endif // QMC_HPP
@@ -0,0 +1,121 @@
+#pragma once
+/**
+ * @file qrng_socket.hpp
+ *
+ * @brief client of a random number server over TCP, the stand-in QRNG of
+ * src/qrng/qrng-server.cpp
+ *
+ * The protocol has one message each way, repeated on the same
+ * connection:
+ *
+ * - request: uint32 count, the numbers wanted, at most max_request
+ * - response: uint32 n <= count, then n doubles in [0,1)
+ *
+ * Integers and doubles are in the byte order of the hosts, which must
+ * agree. A client is a fetch function of random_prefetcher:
+ *
+ * @code
+ * auto server = std::make_shared<qrng_socket_source>("localhost", 5489);
+ * random_prefetcher pool([server](double* out, size_t count) { return (*server)(out, count); });
+ * @endcode
+ */
+#ifndef QRNG_SOCKET_HPP
+#define QRNG_SOCKET_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+static const uint32_t QRNG_SOCKET_MAX_REQUEST = 1 << 20;
+
+/**
+ * sends or receives size bytes, false if the connection closed or failed
+ */
+inline bool qrng_socket_send_all(int fd, const void* data, size_t size) {
+    const char* p = static_cast<const char*>(data);
+    while (size > 0) {
+        ssize_t n = ::send(fd, p, size, MSG_NOSIGNAL);
+        if (n <= 0) {
+            return false;
+        }
+        p += n;
+        size -= n;
+    }
+    return true;
+}
+
+inline bool qrng_socket_recv_all(int fd, void* data, size_t size) {
+    char* p = static_cast<char*>(data);
+    while (size > 0) {
+        ssize_t n = ::recv(fd, p, size, 0);
+        if (n <= 0) {
+            return false;
+        }
+        p += n;
+        size -= n;
+    }
+    return true;
+}
+
+class qrng_socket_source {
+public:
+    qrng_socket_source(const std::string& host, uint16_t port)
+        : fd(-1) {
+        addrinfo hints;
+        std::memset(&hints, 0, sizeof(hints));
+        hints.ai_family = AF_UNSPEC;
+        hints.ai_socktype = SOCK_STREAM;
+        addrinfo* addresses = nullptr;
+        if (::getaddrinfo(host.c_str(), std::to_string(port).c_str(), &hints, &addresses) != 0) {
+            throw std::runtime_error("qrng_socket_source: unknown host " + host);
+        }
+        for (addrinfo* a = addresses; a && fd < 0; a = a->ai_next) {
+            fd = ::socket(a->ai_family, a->ai_socktype, a->ai_protocol);
+            if (fd >= 0 && ::connect(fd, a->ai_addr, a->ai_addrlen) != 0) {
+                ::close(fd);
+                fd = -1;
+            }
+        }
+        ::freeaddrinfo(addresses);
+        if (fd < 0) {
+            throw std::runtime_error("qrng_socket_source: cannot connect to " + host + ":" + std::to_string(port));
+        }
+        int one = 1;
+        ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    }
+
+    qrng_socket_source(const qrng_socket_source&) = delete;
+    qrng_socket_source& operator=(const qrng_socket_source&) = delete;
+
+    ~qrng_socket_source() {
+        ::close(fd);
+    }
+
+    /**
+     * writes at most count numbers to out and returns how many
+     */
+    size_t operator()(double* out, size_t count) {
+        uint32_t request = uint32_t(std::min<size_t>(count, QRNG_SOCKET_MAX_REQUEST));
+        uint32_t n;
+        if (!qrng_socket_send_all(fd, &request, sizeof(request)) ||
+            !qrng_socket_recv_all(fd, &n, sizeof(n)) ||
+            n > request ||
+            !qrng_socket_recv_all(fd, out, n * sizeof(double))) {
+            throw std::runtime_error("qrng_socket_source: connection lost");
+        }
+        return n;
+    }
+
+private:
+    int fd;
+};
+
+#endif // QRNG_SOCKET_HPP
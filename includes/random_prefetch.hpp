@@ -0,0 +1,243 @@
+#pragma once
+/**
+ * @file random_prefetch.hpp
+ *
+ * @brief keeps buffers of numbers from a slow source, like a remote QRNG,
+ * ready before the threads of a simulation need them
+ *
+ * A producer thread calls the fetch function until high_watermark buffers
+ * are ready and sleeps until consumers take them down to low_watermark.
+ * Each simulation thread reads through its own consumer, which takes one
+ * whole buffer at a time with a compare-and-swap and reads it without any
+ * synchronization; it only blocks when no buffer is ready, a stall.
+ *
+ * @code
+ * random_prefetcher pool([](double* out, size_t count) { return fetch(out, count); });
+ * // in each thread
+ * random_prefetcher::consumer rnd(pool);
+ * double x = rnd();
+ * @endcode
+ *
+ * The fetch function returns the number of values it wrote, at most
+ * count, and reports errors with exceptions, which consumers rethrow
+ * once the ready buffers are exhausted.
+ */
+#ifndef RANDOM_PREFETCH_HPP
+#define RANDOM_PREFETCH_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+class random_prefetcher {
+public:
+    typedef std::function<size_t(double* out, size_t count)> fetch_function;
+    typedef std::vector<double> buffer;
+
+    random_prefetcher(fetch_function fetch, size_t buffer_size = 10000,
+                      size_t low_watermark = 2, size_t high_watermark = 8)
+        : fetch(std::move(fetch)),
+          buffer_size(buffer_size),
+          low_watermark(low_watermark),
+          high_watermark(high_watermark),
+          slots(high_watermark),
+          head(0),
+          tail(0),
+          producer_sleeping(false),
+          waiting_consumers(0),
+          stop(false),
+          failed(false),
+          fetches(0),
+          stalls(0),
+          stall_nanoseconds(0) {
+        if (buffer_size == 0 || high_watermark == 0 || low_watermark >= high_watermark) {
+            throw std::invalid_argument("random_prefetcher: needs buffer_size > 0 and low_watermark < high_watermark");
+        }
+        producer = std::thread([this] { produce(); });
+    }
+
+    random_prefetcher(const random_prefetcher&) = delete;
+    random_prefetcher& operator=(const random_prefetcher&) = delete;
+
+    ~random_prefetcher() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        producer_wakeup.notify_all();
+        consumer_wakeup.notify_all();
+        producer.join();
+        for (uint64_t i = head; i < tail; ++i) {
+            delete slots[i % slots.size()].load();
+        }
+    }
+
+    /**
+     * takes the next ready buffer, waiting for the producer if there is none
+     */
+    std::unique_ptr<buffer> acquire() {
+        std::unique_lock<std::mutex> unlocked(mutex, std::defer_lock);
+        buffer* taken = try_acquire(unlocked);
+        if (!taken) {
+            auto begin_tp = std::chrono::steady_clock::now();
+            std::unique_lock<std::mutex> lock(mutex);
+            ++waiting_consumers;
+            while (!(taken = try_acquire(lock))) {
+                if (failed || stop) {
+                    --waiting_consumers;
+                    if (failed) {
+                        std::rethrow_exception(error);
+                    }
+                    throw std::runtime_error("random_prefetcher: stopped");
+                }
+                consumer_wakeup.wait(lock);
+            }
+            --waiting_consumers;
+            ++stalls;
+            stall_nanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - begin_tp).count();
+        }
+        return std::unique_ptr<buffer>(taken);
+    }
+
+    /**
+     * buffers ready to be taken
+     */
+    size_t ready() const {
+        return tail.load() - head.load();
+    }
+
+    /** buffers the source has filled so far */
+    uint64_t fetch_count() const { return fetches; }
+    /** times a consumer found no buffer ready */
+    uint64_t stall_count() const { return stalls; }
+    /** total time consumers waited for buffers */
+    std::chrono::nanoseconds stall_time() const { return std::chrono::nanoseconds(stall_nanoseconds.load()); }
+
+    /**
+     * the numbers of a prefetcher for one thread
+     */
+    class consumer {
+    public:
+        explicit consumer(random_prefetcher& pool)
+            : pool(pool),
+              pos(0) {
+        }
+
+        double operator()() {
+            if (!current || pos == current->size()) {
+                current = pool.acquire();
+                pos = 0;
+            }
+            return (*current)[pos++];
+        }
+
+    private:
+        random_prefetcher& pool;
+        std::unique_ptr<buffer> current;
+        size_t pos;
+    };
+
+private:
+    // single producer, many consumers: the producer only writes the slot
+    // of tail once head has passed it, consumers own a slot once they move
+    // head past it. lock is the mutex, owned or not, to wake the producer
+    buffer* try_acquire(std::unique_lock<std::mutex>& lock) {
+        uint64_t h = head.load();
+        for (;;) {
+            if (h == tail.load()) {
+                return nullptr;
+            }
+            // may be stale, then the compare-and-swap fails
+            buffer* taken = slots[h % slots.size()].load(std::memory_order_relaxed);
+            if (head.compare_exchange_weak(h, h + 1)) {
+                if (tail.load() - (h + 1) <= low_watermark && producer_sleeping.load()) {
+                    if (lock.owns_lock()) {
+                        producer_wakeup.notify_one();
+                    } else {
+                        std::lock_guard<std::mutex> guard(mutex);
+                        producer_wakeup.notify_one();
+                    }
+                }
+                return taken;
+            }
+        }
+    }
+
+    void produce() {
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                if (ready() >= high_watermark) {
+                    producer_sleeping = true;
+                    producer_wakeup.wait(lock, [this] { return stop || ready() <= low_watermark; });
+                    producer_sleeping = false;
+                }
+                if (stop) {
+                    return;
+                }
+            }
+
+            std::unique_ptr<buffer> filled(new buffer(buffer_size));
+            try {
+                size_t count = 0;
+                while (count == 0 && !stop) {
+                    count = fetch(filled->data(), filled->size());
+                }
+                filled->resize(count);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex);
+                error = std::current_exception();
+                failed = true;
+                consumer_wakeup.notify_all();
+                return;
+            }
+            if (filled->empty()) {
+                continue;
+            }
+
+            slots[tail.load() % slots.size()].store(filled.release(), std::memory_order_relaxed);
+            ++tail;
+            ++fetches;
+            if (waiting_consumers.load() > 0) {
+                std::lock_guard<std::mutex> lock(mutex);
+                consumer_wakeup.notify_all();
+            }
+        }
+    }
+
+    fetch_function fetch;
+    const size_t buffer_size;
+    const size_t low_watermark;
+    const size_t high_watermark;
+
+    std::vector<std::atomic<buffer*>> slots;
+    std::atomic<uint64_t> head; // next buffer to take
+    std::atomic<uint64_t> tail; // next buffer to fill
+
+    std::mutex mutex;
+    std::condition_variable producer_wakeup;
+    std::condition_variable consumer_wakeup;
+    std::atomic<bool> producer_sleeping;
+    std::atomic<size_t> waiting_consumers;
+    std::atomic<bool> stop;
+    bool failed;
+    std::exception_ptr error;
+
+    std::atomic<uint64_t> fetches;
+    std::atomic<uint64_t> stalls;
+    std::atomic<uint64_t> stall_nanoseconds;
+
+    std::thread producer;
+};
+
+#endif // RANDOM_PREFETCH_HPP
@@ -0,0 +1,316 @@
+#pragma once
+/**
+ * @file random_table.hpp
+ *
+ * @brief binary tables of random numbers, mapped read-only in memory
+ *
+ * A table file is a 128-byte header followed by the values, doubles in
+ * [0,1) in the byte order of the machine that wrote it:
+ *
+ * @code
+ * random_table table("qrng.tbl"); // throws std::runtime_error
+ * const double* values = table.data();
+ * @endcode
+ *
+ * Loading maps the file instead of reading it, so it takes no time and
+ * no memory of its own, and the processes that load the same table share
+ * its pages in the page cache. Threads read their own slices of a table
+ * with random_table_slice, which can also reuse a table many times with
+ * a fresh randomization each time. Tables are written with
+ * random_table::write or converted from text files of numbers with
+ * src/table/rnd-table.cpp.
+ */
+#ifndef RANDOM_TABLE_HPP
+#define RANDOM_TABLE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "philox.hpp"
+#include "sfmt/SFMT.h"
+
+struct random_table_header {
+    static const uint32_t current_version = 1;
+    static const uint32_t byte_order_mark = 0x01020304;
+
+    enum type : uint32_t {
+        float64 = 1 // double in [0,1)
+    };
+
+    char magic[8];       // "MMCRTBL"
+    uint32_t version;    // current_version
+    uint32_t byte_order; // byte_order_mark as written
+    uint32_t value_type; // type of the values
+    uint32_t reserved;
+    uint64_t count;      // number of values
+    uint64_t checksum;   // random_table_checksum of the values
+    char source[88];     // where the numbers come from, nul terminated
+};
+
+static_assert(sizeof(random_table_header) == 128, "the values start at byte 128");
+
+static const char random_table_magic[8] = "MMCRTBL";
+
+/**
+ * FNV-1a over the 64-bit words of the values
+ */
+inline uint64_t random_table_checksum(const double* values, size_t count) {
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (size_t i = 0; i < count; ++i) {
+        uint64_t word;
+        std::memcpy(&word, &values[i], sizeof(word));
+        hash = (hash ^ word) * 0x100000001b3ull;
+    }
+    return hash;
+}
+
+class random_table {
+public:
+    explicit random_table(const std::string& path)
+        : mapping(MAP_FAILED),
+          mapping_size(0) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("random_table: cannot open " + path);
+        }
+        struct stat st;
+        if (::fstat(fd, &st) != 0 || size_t(st.st_size) < sizeof(random_table_header)) {
+            ::close(fd);
+            throw std::runtime_error("random_table: " + path + " is not a random table");
+        }
+        mapping_size = st.st_size;
+        mapping = ::mmap(nullptr, mapping_size, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (mapping == MAP_FAILED) {
+            throw std::runtime_error("random_table: cannot map " + path);
+        }
+
+        const char* error = validate();
+        if (error) {
+            ::munmap(mapping, mapping_size);
+            throw std::runtime_error("random_table: " + path + ": " + error);
+        }
+    }
+
+    random_table(const random_table&) = delete;
+    random_table& operator=(const random_table&) = delete;
+
+    ~random_table() {
+        ::munmap(mapping, mapping_size);
+    }
+
+    const random_table_header& header() const {
+        return *static_cast<const random_table_header*>(mapping);
+    }
+
+    const double* data() const {
+        return reinterpret_cast<const double*>(static_cast<const char*>(mapping) + sizeof(random_table_header));
+    }
+
+    size_t size() const {
+        return header().count;
+    }
+
+    double operator[](size_t i) const {
+        return data()[i];
+    }
+
+    std::string source() const {
+        return std::string(header().source, strnlen(header().source, sizeof(header().source)));
+    }
+
+    /**
+     * compares the checksum of the header with the values, which reads all
+     * of them
+     */
+    bool verify() const {
+        return random_table_checksum(data(), size()) == header().checksum;
+    }
+
+    /**
+     * writes a table file, replacing path
+     */
+    static void write(const std::string& path, const double* values, size_t count, const std::string& source) {
+        random_table_header h;
+        std::memset(&h, 0, sizeof(h));
+        std::memcpy(h.magic, random_table_magic, sizeof(h.magic));
+        h.version = random_table_header::current_version;
+        h.byte_order = random_table_header::byte_order_mark;
+        h.value_type = random_table_header::float64;
+        h.count = count;
+        h.checksum = random_table_checksum(values, count);
+        std::strncpy(h.source, source.c_str(), sizeof(h.source) - 1);
+
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char*>(&h), sizeof(h));
+        out.write(reinterpret_cast<const char*>(values), count * sizeof(double));
+        out.close();
+        if (!out) {
+            throw std::runtime_error("random_table: cannot write " + path);
+        }
+    }
+
+private:
+    const char* validate() const {
+        const random_table_header& h = header();
+        if (std::memcmp(h.magic, random_table_magic, sizeof(h.magic)) != 0) {
+            return "not a random table";
+        }
+        if (h.version != random_table_header::current_version) {
+            return "unsupported version";
+        }
+        if (h.byte_order != random_table_header::byte_order_mark) {
+            return "written with another byte order";
+        }
+        if (h.value_type != random_table_header::float64) {
+            return "unsupported value type";
+        }
+        if ((mapping_size - sizeof(random_table_header)) / sizeof(double) != h.count ||
+            (mapping_size - sizeof(random_table_header)) % sizeof(double) != 0) {
+            return "size does not match the count";
+        }
+        return nullptr;
+    }
+
+    void* mapping;
+    size_t mapping_size;
+};
+
+/**
+ * the samples [begin, end) of a computation drawing dimension values per
+ * sample from a table: sample j reads the values [j * dimension,
+ * (j + 1) * dimension), so the numbers of a sample do not depend on the
+ * thread that draws it and threads with disjoint sample ranges share the
+ * table without synchronization
+ *
+ * The samples past the end of the table fail, std::out_of_range from the
+ * constructor, or come from the Philox stream of the seed, sample j from
+ * the blocks j * blocks_per_sample ..., which is also deterministic.
+ *
+ * The reuse policies instead read the table again and again: sample j is
+ * sample j mod S of the table in pass j / S, S the samples of the table,
+ * and every pass, the first one too, is randomized with its own vector of
+ * dimension numbers drawn from SFMT, either a shift modulo 1
+ * (Cranley-Patterson rotation) or a xor of the 53 bits of each value.
+ * Each pass is then uniform and, given the table, the passes are
+ * independent replicates, whose spread estimates the error.
+ */
+class random_table_slice {
+public:
+    enum overflow_policy {
+        fail,
+        philox_fallback,
+        rotate,      // shift modulo 1 of each pass
+        xor_scramble // digital xor of each pass
+    };
+
+    random_table_slice(const random_table& table, size_t dimension, size_t begin, size_t end,
+                       overflow_policy overflow = fail, uint64_t seed = 0)
+        : values(table.data()),
+          dimension(dimension),
+          table_samples(table.size() / dimension),
+          next_sample(begin),
+          end_sample(end),
+          overflow(overflow),
+          seed(seed),
+          pass(~size_t(0)),
+          randomization(dimension),
+          buffer(std::max(dimension, 2 * blocks_per_sample())) {
+        if (table_samples == 0 && overflow != philox_fallback) {
+            throw std::out_of_range("random_table_slice: the table has no samples");
+        }
+        if (overflow == fail && end > table_samples) {
+            throw std::out_of_range("random_table_slice: the table has " + std::to_string(table_samples) +
+                                    " samples, " + std::to_string(end) + " needed");
+        }
+    }
+
+    /**
+     * samples left in the slice
+     */
+    size_t remaining() const {
+        return end_sample - next_sample;
+    }
+
+    /**
+     * the dimension values of the next sample, valid until the next call
+     */
+    const double* next() {
+        size_t j = next_sample++;
+        if (overflow == rotate || overflow == xor_scramble) {
+            return reused(j);
+        }
+        if (j < table_samples) {
+            return values + j * dimension;
+        }
+        philox4x32_fill_res53(seed, 0, j * blocks_per_sample(), buffer.data(), blocks_per_sample());
+        return buffer.data();
+    }
+
+    /**
+     * samples of [begin, end) past the end of a table of table_size values
+     */
+    static size_t fallback_samples(size_t table_size, size_t dimension, size_t begin, size_t end) {
+        size_t table_samples = table_size / dimension;
+        return end > table_samples ? end - std::max(begin, table_samples) : 0;
+    }
+
+    /**
+     * the shifts, or the xor masks as doubles, of a pass
+     */
+    static void pass_randomization(uint64_t seed, size_t pass, double* out, size_t dimension) {
+        uint32_t key[4] = {uint32_t(seed), uint32_t(seed >> 32), uint32_t(pass), uint32_t(uint64_t(pass) >> 32)};
+        sfmt_t state;
+        sfmt_init_by_array(&state, key, 4);
+        for (size_t d = 0; d < dimension; ++d) {
+            out[d] = sfmt_genrand_res53(&state);
+        }
+    }
+
+private:
+    // two 53-bit doubles per block
+    size_t blocks_per_sample() const {
+        return (dimension + 1) / 2;
+    }
+
+    const double* reused(size_t j) {
+        size_t p = j / table_samples;
+        if (p != pass) {
+            pass = p;
+            pass_randomization(seed, pass, randomization.data(), dimension);
+        }
+        const double* x = values + (j - p * table_samples) * dimension;
+        for (size_t d = 0; d < dimension; ++d) {
+            if (overflow == rotate) {
+                double shifted = x[d] + randomization[d];
+                buffer[d] = shifted < 1.0 ? shifted : shifted - 1.0;
+            } else {
+                uint64_t bits = uint64_t(x[d] * 0x1p53) ^ uint64_t(randomization[d] * 0x1p53);
+                buffer[d] = bits * 0x1p-53;
+            }
+        }
+        return buffer.data();
+    }
+
+    const double* values;
+    size_t dimension;
+    size_t table_samples;
+    size_t next_sample;
+    size_t end_sample;
+    overflow_policy overflow;
+    uint64_t seed;
+    size_t pass;
+    std::vector<double> randomization;
+    std::vector<double> buffer;
+};
+
+#endif // RANDOM_TABLE_HPP
@@ -0,0 +1,205 @@
+#pragma once
+/**
+ * @file running_moments.hpp
+ *
+ * @brief mean and variance of a stream of samples, in one pass and with
+ * the samples split in any way among threads
+ *
+ * B. P. Welford, "Note on a method for calculating corrected sums of
+ * squares and products", Technometrics 4(3), 1962, for one sample at a
+ * time, and T. F. Chan, G. H. Golub and R. J. LeVeque, "Updating formulae
+ * and a pairwise algorithm for computing sample variances", 1979, to merge
+ * the moments of two sets of samples.
+ *
+ * The accumulator keeps the count, the mean and the sum of squared
+ * deviations from the mean, so the variance does not come from the
+ * difference of two large sums. merge() is associative up to rounding:
+ *
+ * @code
+ * running_moments a, b;
+ * a.add(x);          // in one thread
+ * b.add(y);          // in another
+ * a.merge(b);        // the moments of {x, y}
+ * a.variance();
+ * @endcode
+ *
+ * running_moments_lanes keeps Lanes accumulators side by side which take
+ * one sample each per add(), so the updates have no dependency between
+ * them and vectorize; moments() merges the lanes. Its cost per sample is
+ * about that of plain sums of x and x^2, which lose digits to
+ * cancellation at 10^10 samples and more.
+ */
+#ifndef RUNNING_MOMENTS_HPP
+#define RUNNING_MOMENTS_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+class running_moments {
+public:
+    running_moments()
+        : n(0),
+          m(0.0),
+          m2(0.0) {
+    }
+
+    running_moments(size_t count, double mean, double sum_sq)
+        : n(count),
+          m(mean),
+          m2(sum_sq) {
+    }
+
+    void add(double x) {
+        ++n;
+        double delta = x - m;
+        m += delta / n;
+        m2 += delta * (x - m);
+    }
+
+    /**
+     * adds the moments of other, as if its samples were added one by one
+     */
+    void merge(const running_moments& other) {
+        if (other.n == 0) {
+            return;
+        }
+        if (n == 0) {
+            *this = other;
+            return;
+        }
+        size_t total = n + other.n;
+        double delta = other.m - m;
+        double weight = double(other.n) / total;
+        m += delta * weight;
+        m2 += other.m2 + delta * delta * n * weight;
+        n = total;
+    }
+
+    /**
+     * takes out the moments of part, whose samples are some of these: the
+     * inverse of merge()
+     */
+    void remove(const running_moments& part) {
+        if (part.n >= n) {
+            *this = running_moments();
+            return;
+        }
+        size_t rest = n - part.n;
+        double rest_mean = m + (m - part.m) * part.n / rest;
+        double delta = rest_mean - part.m;
+        m2 = std::max(m2 - part.m2 - delta * delta * part.n * rest / n, 0.0);
+        m = rest_mean;
+        n = rest;
+    }
+
+    size_t count() const {
+        return n;
+    }
+
+    double mean() const {
+        return m;
+    }
+
+    double sum() const {
+        return m * n;
+    }
+
+    /** sum of the squared deviations from the mean */
+    double sum_sq() const {
+        return m2;
+    }
+
+    /** the sample variance, with n - 1 degrees of freedom */
+    double variance() const {
+        return m2 / (n - 1);
+    }
+
+    double stddev() const {
+        return std::sqrt(variance());
+    }
+
+private:
+    size_t n;
+    double m;
+    double m2;
+};
+
+template <size_t Lanes>
+class running_moments_lanes {
+public:
+    running_moments_lanes()
+        : n(0) {
+        for (size_t l = 0; l < Lanes; ++l) {
+            m[l] = 0.0;
+            m2[l] = 0.0;
+        }
+    }
+
+    /**
+     * adds x[l] to lane l
+     */
+    void add(const double* x) {
+        ++n;
+        const double inv_n = 1.0 / n;
+        for (size_t l = 0; l < Lanes; ++l) {
+            double delta = x[l] - m[l];
+            m[l] += delta * inv_n;
+            m2[l] += delta * (x[l] - m[l]);
+        }
+    }
+
+    /**
+     * adds count samples, Lanes at a time and the rest one by one
+     */
+    void add(const double* x, size_t count) {
+        // in locals, which x cannot alias, so they stay in registers
+        double mean[Lanes], sum_sq[Lanes];
+        for (size_t l = 0; l < Lanes; ++l) {
+            mean[l] = m[l];
+            sum_sq[l] = m2[l];
+        }
+        const size_t full = count - count % Lanes;
+        for (size_t k = 0; k < full; k += Lanes) {
+            ++n;
+            const double inv_n = 1.0 / n;
+            for (size_t l = 0; l < Lanes; ++l) {
+                double delta = x[k + l] - mean[l];
+                mean[l] += delta * inv_n;
+                sum_sq[l] += delta * (x[k + l] - mean[l]);
+            }
+        }
+        for (size_t l = 0; l < Lanes; ++l) {
+            m[l] = mean[l];
+            m2[l] = sum_sq[l];
+        }
+        for (size_t k = full; k < count; ++k) {
+            rest.add(x[k]);
+        }
+    }
+
+    /**
+     * the moments of all the samples, the lanes merged pairwise
+     */
+    running_moments moments() const {
+        running_moments lanes[Lanes];
+        for (size_t l = 0; l < Lanes; ++l) {
+            lanes[l] = running_moments(n, m[l], m2[l]);
+        }
+        for (size_t stride = 1; stride < Lanes; stride *= 2) {
+            for (size_t l = 0; l + stride < Lanes; l += 2 * stride) {
+                lanes[l].merge(lanes[l + stride]);
+            }
+        }
+        lanes[0].merge(rest);
+        return lanes[0];
+    }
+
+private:
+    size_t n;
+    running_moments rest;
+    alignas(64) double m[Lanes];
+    alignas(64) double m2[Lanes];
+};
+
+#endif // RUNNING_MOMENTS_HPP
@@ -0,0 +1,173 @@
+#pragma once
+/**
+ * @file  SFMT-avx2.h
+ * @brief SIMD oriented Fast Mersenne Twister(SFMT) for Intel AVX2
+ *
+ * The recursion of word i depends on words i-1 and i-2, so a 256-bit
+ * register cannot hold two finished words.  Instead, the terms that
+ * only depend on the old state (a, a << SL2 and (b >> SR1) & MSK) are
+ * computed for two words at a time in a 256-bit register, and the
+ * c and d terms are chained in 128-bit registers as in SFMT-sse2.h.
+ * The output is bit-identical to the other backends.
+ *
+ * @note We assume LITTLE ENDIAN in this file
+ *
+ * The new BSD License is applied to this software, see LICENSE.txt
+ */
+
+#ifndef SFMT_AVX2_H
+#define SFMT_AVX2_H
+
+#include <immintrin.h>
+
+inline static void mm_recursion(__m128i * r, __m128i a, __m128i b,
+                                __m128i * r1, __m128i * r2);
+inline static void mm256_recursion(w128_t * r, const w128_t * a,
+                                   const w128_t * b,
+                                   __m128i * r1, __m128i * r2);
+
+/**
+ * This function represents the recursion formula for one word and
+ * advances the chain of the last two words.
+ * @param r an output
+ * @param a a 128-bit part of the interal state array
+ * @param b a 128-bit part of the interal state array
+ * @param r1 the word before the last one, updated
+ * @param r2 the last word, updated
+ */
+inline static void mm_recursion(__m128i * r, __m128i a, __m128i b,
+                                __m128i * r1, __m128i * r2)
+{
+    __m128i x, y, z;
+
+    y = _mm_and_si128(_mm_srli_epi32(b, SFMT_SR1), sse2_param_mask.si);
+    x = _mm_xor_si128(a, _mm_slli_si128(a, SFMT_SL2));
+    z = _mm_xor_si128(_mm_srli_si128(*r1, SFMT_SR2),
+                      _mm_slli_epi32(*r2, SFMT_SL1));
+    z = _mm_xor_si128(z, _mm_xor_si128(x, y));
+    *r = z;
+    *r1 = *r2;
+    *r2 = z;
+}
+
+/**
+ * This function represents the recursion formula for two consecutive
+ * words.  a and r may be the same words, b must not overlap r.
+ * @param r output, two words
+ * @param a two 128-bit parts of the interal state array
+ * @param b two 128-bit parts of the interal state array
+ * @param r1 the word before the last one, updated
+ * @param r2 the last word, updated
+ */
+inline static void mm256_recursion(w128_t * r, const w128_t * a,
+                                   const w128_t * b,
+                                   __m128i * r1, __m128i * r2)
+{
+    const __m256i mask = _mm256_broadcastsi128_si256(sse2_param_mask.si);
+    __m256i va, vb, v;
+    __m128i lo, hi;
+
+    va = _mm256_loadu_si256((const __m256i *)a);
+    vb = _mm256_loadu_si256((const __m256i *)b);
+    v = _mm256_xor_si256(va, _mm256_slli_si256(va, SFMT_SL2));
+    v = _mm256_xor_si256(v, _mm256_and_si256(_mm256_srli_epi32(vb, SFMT_SR1),
+                                             mask));
+    lo = _mm256_castsi256_si128(v);
+    hi = _mm256_extracti128_si256(v, 1);
+
+    lo = _mm_xor_si128(lo, _mm_srli_si128(*r1, SFMT_SR2));
+    lo = _mm_xor_si128(lo, _mm_slli_epi32(*r2, SFMT_SL1));
+    hi = _mm_xor_si128(hi, _mm_srli_si128(*r2, SFMT_SR2));
+    hi = _mm_xor_si128(hi, _mm_slli_epi32(lo, SFMT_SL1));
+    r[0].si = lo;
+    r[1].si = hi;
+    *r1 = lo;
+    *r2 = hi;
+}
+
+/**
+ * This function fills the internal state array with pseudorandom
+ * integers.
+ * @param sfmt SFMT internal state
+ */
+void sfmt_gen_rand_all(sfmt_t * sfmt) {
+    int i;
+    __m128i r1, r2;
+    w128_t * pstate = sfmt->state;
+
+    r1 = pstate[SFMT_N - 2].si;
+    r2 = pstate[SFMT_N - 1].si;
+    for (i = 0; i + 2 <= SFMT_N - SFMT_POS1; i += 2) {
+        mm256_recursion(&pstate[i], &pstate[i], &pstate[i + SFMT_POS1],
+                        &r1, &r2);
+    }
+    for (; i < SFMT_N - SFMT_POS1; i++) {
+        mm_recursion(&pstate[i].si, pstate[i].si,
+                     pstate[i + SFMT_POS1].si, &r1, &r2);
+    }
+    for (; i + 2 <= SFMT_N; i += 2) {
+        mm256_recursion(&pstate[i], &pstate[i],
+                        &pstate[i + SFMT_POS1 - SFMT_N], &r1, &r2);
+    }
+    for (; i < SFMT_N; i++) {
+        mm_recursion(&pstate[i].si, pstate[i].si,
+                     pstate[i + SFMT_POS1 - SFMT_N].si, &r1, &r2);
+    }
+}
+
+/**
+ * This function fills the user-specified array with pseudorandom
+ * integers.
+ * @param sfmt SFMT internal state.
+ * @param array an 128-bit array to be filled by pseudorandom numbers.
+ * @param size number of 128-bit pseudorandom numbers to be generated.
+ */
+static void gen_rand_array(sfmt_t * sfmt, w128_t * array, int size)
+{
+    int i, j;
+    __m128i r1, r2;
+    w128_t * pstate = sfmt->state;
+
+    r1 = pstate[SFMT_N - 2].si;
+    r2 = pstate[SFMT_N - 1].si;
+    for (i = 0; i + 2 <= SFMT_N - SFMT_POS1; i += 2) {
+        mm256_recursion(&array[i], &pstate[i], &pstate[i + SFMT_POS1],
+                        &r1, &r2);
+    }
+    for (; i < SFMT_N - SFMT_POS1; i++) {
+        mm_recursion(&array[i].si, pstate[i].si,
+                     pstate[i + SFMT_POS1].si, &r1, &r2);
+    }
+    for (; i + 2 <= SFMT_N; i += 2) {
+        mm256_recursion(&array[i], &pstate[i],
+                        &array[i + SFMT_POS1 - SFMT_N], &r1, &r2);
+    }
+    for (; i < SFMT_N; i++) {
+        mm_recursion(&array[i].si, pstate[i].si,
+                     array[i + SFMT_POS1 - SFMT_N].si, &r1, &r2);
+    }
+    for (; i + 2 <= size - SFMT_N; i += 2) {
+        mm256_recursion(&array[i], &array[i - SFMT_N],
+                        &array[i + SFMT_POS1 - SFMT_N], &r1, &r2);
+    }
+    for (; i < size - SFMT_N; i++) {
+        mm_recursion(&array[i].si, array[i - SFMT_N].si,
+                     array[i + SFMT_POS1 - SFMT_N].si, &r1, &r2);
+    }
+    for (j = 0; j < 2 * SFMT_N - size; j++) {
+        pstate[j] = array[j + size - SFMT_N];
+    }
+    for (; i + 2 <= size; i += 2, j += 2) {
+        mm256_recursion(&array[i], &array[i - SFMT_N],
+                        &array[i + SFMT_POS1 - SFMT_N], &r1, &r2);
+        pstate[j] = array[i];
+        pstate[j + 1] = array[i + 1];
+    }
+    for (; i < size; i++, j++) {
+        mm_recursion(&array[i].si, array[i - SFMT_N].si,
+                     array[i + SFMT_POS1 - SFMT_N].si, &r1, &r2);
+        pstate[j] = array[i];
+    }
+}
+
+#endif
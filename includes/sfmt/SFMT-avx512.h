@@ -0,0 +1,187 @@
+#pragma once
+/**
+ * @file  SFMT-avx512.h
+ * @brief SIMD oriented Fast Mersenne Twister(SFMT) for Intel AVX-512
+ *
+ * Same scheme as SFMT-avx2.h with four words per 512-bit register:
+ * the terms that only depend on the old state are computed four words
+ * at a time, and the c and d terms are chained in 128-bit registers.
+ * Needs AVX-512F and AVX-512BW.  The output is bit-identical to the
+ * other backends.
+ *
+ * @note We assume LITTLE ENDIAN in this file
+ *
+ * The new BSD License is applied to this software, see LICENSE.txt
+ */
+
+#ifndef SFMT_AVX512_H
+#define SFMT_AVX512_H
+
+#include <immintrin.h>
+
+inline static void mm_recursion(__m128i * r, __m128i a, __m128i b,
+                                __m128i * r1, __m128i * r2);
+inline static void mm512_recursion(w128_t * r, const w128_t * a,
+                                   const w128_t * b,
+                                   __m128i * r1, __m128i * r2);
+
+/**
+ * This function represents the recursion formula for one word and
+ * advances the chain of the last two words.
+ * @param r an output
+ * @param a a 128-bit part of the interal state array
+ * @param b a 128-bit part of the interal state array
+ * @param r1 the word before the last one, updated
+ * @param r2 the last word, updated
+ */
+inline static void mm_recursion(__m128i * r, __m128i a, __m128i b,
+                                __m128i * r1, __m128i * r2)
+{
+    __m128i x, y, z;
+
+    y = _mm_and_si128(_mm_srli_epi32(b, SFMT_SR1), sse2_param_mask.si);
+    x = _mm_xor_si128(a, _mm_slli_si128(a, SFMT_SL2));
+    z = _mm_xor_si128(_mm_srli_si128(*r1, SFMT_SR2),
+                      _mm_slli_epi32(*r2, SFMT_SL1));
+    z = _mm_xor_si128(z, _mm_xor_si128(x, y));
+    *r = z;
+    *r1 = *r2;
+    *r2 = z;
+}
+
+/**
+ * This function represents the recursion formula for four consecutive
+ * words.  a and r may be the same words, b must not overlap r and,
+ * when it points to words generated by this pass, SFMT_N - SFMT_POS1
+ * must be at least 4 (see QUAD_B_OK).
+ * @param r output, four words
+ * @param a four 128-bit parts of the interal state array
+ * @param b four 128-bit parts of the interal state array
+ * @param r1 the word before the last one, updated
+ * @param r2 the last word, updated
+ */
+inline static void mm512_recursion(w128_t * r, const w128_t * a,
+                                   const w128_t * b,
+                                   __m128i * r1, __m128i * r2)
+{
+    const __m512i mask = _mm512_broadcast_i32x4(sse2_param_mask.si);
+    __m512i va, vb, v;
+    __m128i x0, x1, x2, x3;
+
+    va = _mm512_loadu_si512((const void *)a);
+    vb = _mm512_loadu_si512((const void *)b);
+    v = _mm512_xor_si512(va, _mm512_bslli_epi128(va, SFMT_SL2));
+    v = _mm512_xor_si512(v, _mm512_and_si512(_mm512_srli_epi32(vb, SFMT_SR1),
+                                             mask));
+    x0 = _mm512_castsi512_si128(v);
+    x1 = _mm512_extracti32x4_epi32(v, 1);
+    x2 = _mm512_extracti32x4_epi32(v, 2);
+    x3 = _mm512_extracti32x4_epi32(v, 3);
+
+    x0 = _mm_xor_si128(x0, _mm_srli_si128(*r1, SFMT_SR2));
+    x0 = _mm_xor_si128(x0, _mm_slli_epi32(*r2, SFMT_SL1));
+    x1 = _mm_xor_si128(x1, _mm_srli_si128(*r2, SFMT_SR2));
+    x1 = _mm_xor_si128(x1, _mm_slli_epi32(x0, SFMT_SL1));
+    x2 = _mm_xor_si128(x2, _mm_srli_si128(x0, SFMT_SR2));
+    x2 = _mm_xor_si128(x2, _mm_slli_epi32(x1, SFMT_SL1));
+    x3 = _mm_xor_si128(x3, _mm_srli_si128(x1, SFMT_SR2));
+    x3 = _mm_xor_si128(x3, _mm_slli_epi32(x2, SFMT_SL1));
+    r[0].si = x0;
+    r[1].si = x1;
+    r[2].si = x2;
+    r[3].si = x3;
+    *r1 = x2;
+    *r2 = x3;
+}
+
+/** whether four words can be generated at once when b points to new words */
+#define QUAD_B_OK (SFMT_N - SFMT_POS1 >= 4)
+
+/**
+ * This function fills the internal state array with pseudorandom
+ * integers.
+ * @param sfmt SFMT internal state
+ */
+void sfmt_gen_rand_all(sfmt_t * sfmt) {
+    int i;
+    __m128i r1, r2;
+    w128_t * pstate = sfmt->state;
+
+    r1 = pstate[SFMT_N - 2].si;
+    r2 = pstate[SFMT_N - 1].si;
+    for (i = 0; i + 4 <= SFMT_N - SFMT_POS1; i += 4) {
+        mm512_recursion(&pstate[i], &pstate[i], &pstate[i + SFMT_POS1],
+                        &r1, &r2);
+    }
+    for (; i < SFMT_N - SFMT_POS1; i++) {
+        mm_recursion(&pstate[i].si, pstate[i].si,
+                     pstate[i + SFMT_POS1].si, &r1, &r2);
+    }
+    for (; QUAD_B_OK && i + 4 <= SFMT_N; i += 4) {
+        mm512_recursion(&pstate[i], &pstate[i],
+                        &pstate[i + SFMT_POS1 - SFMT_N], &r1, &r2);
+    }
+    for (; i < SFMT_N; i++) {
+        mm_recursion(&pstate[i].si, pstate[i].si,
+                     pstate[i + SFMT_POS1 - SFMT_N].si, &r1, &r2);
+    }
+}
+
+/**
+ * This function fills the user-specified array with pseudorandom
+ * integers.
+ * @param sfmt SFMT internal state.
+ * @param array an 128-bit array to be filled by pseudorandom numbers.
+ * @param size number of 128-bit pseudorandom numbers to be generated.
+ */
+static void gen_rand_array(sfmt_t * sfmt, w128_t * array, int size)
+{
+    int i, j;
+    __m128i r1, r2;
+    w128_t * pstate = sfmt->state;
+
+    r1 = pstate[SFMT_N - 2].si;
+    r2 = pstate[SFMT_N - 1].si;
+    for (i = 0; i + 4 <= SFMT_N - SFMT_POS1; i += 4) {
+        mm512_recursion(&array[i], &pstate[i], &pstate[i + SFMT_POS1],
+                        &r1, &r2);
+    }
+    for (; i < SFMT_N - SFMT_POS1; i++) {
+        mm_recursion(&array[i].si, pstate[i].si,
+                     pstate[i + SFMT_POS1].si, &r1, &r2);
+    }
+    for (; QUAD_B_OK && i + 4 <= SFMT_N; i += 4) {
+        mm512_recursion(&array[i], &pstate[i],
+                        &array[i + SFMT_POS1 - SFMT_N], &r1, &r2);
+    }
+    for (; i < SFMT_N; i++) {
+        mm_recursion(&array[i].si, pstate[i].si,
+                     array[i + SFMT_POS1 - SFMT_N].si, &r1, &r2);
+    }
+    for (; QUAD_B_OK && i + 4 <= size - SFMT_N; i += 4) {
+        mm512_recursion(&array[i], &array[i - SFMT_N],
+                        &array[i + SFMT_POS1 - SFMT_N], &r1, &r2);
+    }
+    for (; i < size - SFMT_N; i++) {
+        mm_recursion(&array[i].si, array[i - SFMT_N].si,
+                     array[i + SFMT_POS1 - SFMT_N].si, &r1, &r2);
+    }
+    for (j = 0; j < 2 * SFMT_N - size; j++) {
+        pstate[j] = array[j + size - SFMT_N];
+    }
+    for (; QUAD_B_OK && i + 4 <= size; i += 4, j += 4) {
+        mm512_recursion(&array[i], &array[i - SFMT_N],
+                        &array[i + SFMT_POS1 - SFMT_N], &r1, &r2);
+        pstate[j] = array[i];
+        pstate[j + 1] = array[i + 1];
+        pstate[j + 2] = array[i + 2];
+        pstate[j + 3] = array[i + 3];
+    }
+    for (; i < size; i++, j++) {
+        mm_recursion(&array[i].si, array[i - SFMT_N].si,
+                     array[i + SFMT_POS1 - SFMT_N].si, &r1, &r2);
+        pstate[j] = array[i];
+    }
+}
+
+#endif
@@ -0,0 +1,2621 @@
+#pragma once
+#ifndef SFMT_JUMP_PARAMS19937_H
+#define SFMT_JUMP_PARAMS19937_H
+
+/* generated by calc-jump, do not edit */
+
+/* minimal polynomial of degree 19968, lowest degree coefficient first */
+static const char sfmt_jump_minpoly[] =
+    "1000000000000000000000000000000000000000000000000000000000000000"
+    "0000000000000000000000000000000000000000000000000000000000000000"
+    "0000000000000000000000000000000000000000000000000000000000000000"
+    "0000000000000000000000000000000000000000000000000000000000000000"
+    "0000200000000000000000000000000000000000008200000000100000010000"
+    "00000000000000000a00000000000000041000000000000000000000a0000000"
+    "0000000041000011000000000000002800000200000000001000450000000000"
+    "000082800008000000000000000411000000000000080a000000000000040000"
+    "04000000400000000080a000880000000050000044000001002000000a080000"
+    "0200000041000044010004400200000080800080100880051000055010000100"
+    "2000022a0a00200000280011000014400040180204082080a000800088001110"
+    "001450100040a00050802a2800000202a0415100050400044082000180000288"
+    "8088088085149000005010004a20100aa2020a0a0000082c110d200044404000"
+    "2a444da0200028a00808205110401110501050628071c8200208280000822151"
+    "282141440441022402c08844000280088029149201050d40004243102a9a0622"
+    "0a0a002808110b24740074440866340624a8200820a00820801830d048844101"
+    "f0025068589420a80802824411eb4160e0844587606482894d040a08400aa500"
+    "1716541e00451942271a1a1482008a1402085e07b3606328e41c2c2034e0a540"
+    "e020a8c00a1821e18498ab815412f36368185416221817200392221044e00cc1"
+    "8723627a008d45825589c20a04aa8b86cdb11140905437300a0532060a3f0062"
+    "5a08bb0b13c4f4460652fe8064d1a02d6042131129b4b0a82899f9007157ea28"
+    "470002a935657106c76863422107a046517a268cd4840208424b8d84b18e2e2e"
+    "83ca84503c221b272101830970783a2d7b07c1ecee0e65bc2860747430992053"
+    "1e1147c5b8f1068a5b03a338a21a577344a9f6100a34125022c0872121a6b3ec"
+    "e459b11c0705c50c00d8cb32231b0b6a0c899d7d1920116205d642161a7e7902"
+    "c574d4754c52d4d8b6e1b8c78141e251735e88bcf3b059ad125d638157449538"
+    "04220035204a63625a21946915c9feffc803325cda4694d79ba627aa23f89f96"
+    "dd19052473b0317416012e42ff0ba104b4dc050e215c3549f5af88d015486ca1"
+    "7103392b812ac61aabfa30aec6dc424557b682b3b39a8fd3186cb1743ab37823"
+    "54184dce513897b5e9b3e2ab8649a54b2b4eace7544d175d34afbb3db3e36d9c"
+    "2ec1449af7aeb291507afc6ccb1d6b97b0ac28afe75cf36d53f7d46ac475938c"
+    "8509ee07d8685fcebd59fc86557a4f92721cae3942836a76bc17a4f9f734691d"
+    "f7c164d72c2203b1cb0d5804ec765a6ae1a8727b7fa113eacfb49a492006c84a"
+    "652b59f2a7ac426d81f748d516142065c24d025a9781736cdba3e71d70f5d80d"
+    "42137da7eb3d9fd3afbc4bc21668633c0c0908e04797ebd2ce97c4d6f08a4a03"
+    "534f7ec2197d91558862b0d909af467c7f332ccefc556c729f5a02fa8a78958e"
+    "cd5d8c4137cb114d0f3a54b610b998390fd0b02c311d5f16309690a4e16ad52b"
+    "fa7653d6d820ebd0b8a496c09eff2af9b100bbf31cf8cbdd1b576700b4930f4d"
+    "5c4b93418bd77a2820b51abc71b6293e56009f477c9549c8d0827a79db15969c"
+    "49f7acb219eba50d75c1f518a1d1170666dfc6d0ec52d240f4c87136cf70862e"
+    "399c575b791a8ec7e6e4c84379dc7b046faf44b0acba1214c7e634e75081025e"
+    "028ff84317d92eee114940eb37fa7985106efba2a8cdf6a09bca9e60f9847299"
+    "5553b2d402e9a212b32e7c251b43f627787e1809b23081abecf4d8f1267df6e1"
+    "2f47b086a0ac1cdd87bf6293bbbf37b0c8c7bcbf5fb11f9988b55e23d05b59af"
+    "f9bef23f3c184898241ad0a1080355c0077fd79f719a7d8e6953248a618f5784"
+    "9aa05a030b824bbd1325c2164a0593e0d1d40c3232818e3ebef13a07dd56f193"
+    "2c63078ae2d7300d511420d86a2bc585ad80e28b25608ac3801a4998b96a2221"
+    "cb76eaecdc9d6ed485fb55dbade8acdde84e7664e7570a6f7e72a17b9f9d23b9"
+    "8f8f02f8f9672f04f73788c708e34054fa4f6f830dd0ee8b534c26d77e5c4841"
+    "1319d4afd9652dd81683bd999ce325f5d00b8e7376af81435a9ff4761085f962"
+    "868f52945b779dc031caa5f2aca2efe04c8b6f2a6ad71365dd42af05283d435e"
+    "42593befa9cd8afdf66f9efbdb59b86f7db2312776cc96dc4458e89dedfd4b5b"
+    "7d8d78bcd9047830741bcff2383200f8f0414cfaa1105672ddb2ace256b18038"
+    "3ca0b5b4e01a41d49c2ce918e6fa88c709084752f6e191e04f22a011dbe5946d"
+    "fdcbc3bfec3f1fbdac292c957feb8449bfca4d4ea3a4365a4a6da62c8c8a4617"
+    "046c55bfc7a5e569e424e2990a915fcd1ad243ffdfe016f88d5142fa8422429f"
+    "8b306461596b4c01b7571af2806d78e1c78351099a7a75a74c79181df037a682"
+    "7d5d3bd89530373330bc6aff02b02cef2392f21192fbe02406293935b8d5a458"
+    "2a59672f9d41a1bce866ca627a3a1d077a700c4824ad6b1fe4313bc5cdf40a27"
+    "80b6d15ef748d3a2761aec19a408b3b3b3cac363aa36295c5880fa804997e430"
+    "62af6a25de2626008e11a877420cca0eacfa74481ba4d4dcc07c6a324061f675"
+    "0400054268e13601ef700cc866f122205470215010c160b4062025b4d7de51b2"
+    "1d38836d99d0140202b45b3c84e5733e6aedce43050a68cc1a41019ea2451dec"
+    "e64216f420089226608f86c956310b80242b821f2009095feb8548a7a4323d76"
+    "6719aaee392ca102041af5d620848bc061841111738820c5a3ce1364c7a815c1"
+    "0316e704580ba4619818821b228906002880daa88530e024009a441a0408550a"
+    "8482200b8a1b45004645c684018479a00884a2240996040280f468c0a5d10240"
+    "b815b80208541a00510047080b0d0202004a0003233b000c8499a00494011031"
+    "94c488a6c02284381490801875a00519041200294b100a61408a150329084a00"
+    "18045806410011b1a01802c10024401030803a1018d4a10012023b2811002554"
+    "0a00016b8c000009470204010800138480808100a0001d9a80183024c0200402"
+    "22130a0a04000408020111a8408088440a0441000111a8e04080800020019880"
+    "1010045080211022030888040000000200514884008805408200080011088040"
+    "8080102004148a001020650820100222408a0000200000000500a00008005002"
+    "0000000000a00010800000004008001102040000000022000800010000000000"
+    "4000000000000000000000000000008000000004000001002000000000020000"
+    "0000000000000000000000000000000000000000000000000000000000000000"
+    "0000000000000000000000000000000000000000000000000000000000000000"
+    "1";
+
+/* x^(2^k) mod minpoly, for SFMT_JUMP_POW2_MIN <= k <= SFMT_JUMP_POW2_MAX */
+static const char * const sfmt_jump_pow2_table[] = {
+    /* 2^64 */
+    "365444151de522e57e801b8b04ceb0380d1d45b061db7d773e31b30ad6f0a9f3"
+    "3fb2d49297b61b89607f685ae67fd2c9cb3d0e4c4624c09cb64459ebec0a36ac"
+    "22949619b88fa63e91af97be4a4b20ea2ba9da9416dcf8b9b42aade436d2559c"
+    "15482bb7c4f3c38a5724f97fcff907e69cc43c1f54e09358683ef7654f8d2d4b"
+    "b0a6295ac39fba2fad99d6062e0f49854dd0d65bfa3b07a1acb98e0fc1c91ce3"
+    "1674178f00c8a43cd5e87d6a1ce1b8d7f76ee48bef6a628f330ffc60a82e7906"
+    "7a530becdd84d966cc202b7c7a349abdc89f9737d39256e2899d00a7ca2ad9fa"
+    "71c1c10ec975310544480ed79142c19981aadd93a33b6786a143d793f1a8d0aa"
+    "d56eda2a6fbc9c2d446d09e8b918be7bc85d8e1c59dd22b5a78e6d5331c041ae"
+    "c024f3307d81fdb550533819691d5f5d218f942c6606a68f3de5db13ac8c15c8"
+    "926fee50d96fe95c09d98a4746093d615a7f5debaa68872b8006657c04f27f2d"
+    "7f5c6614cc176788aaebfa3ed220e12314ccf917b5c9958964d7fa2940c3cd50"
+    "d14224c262c8592575213cd36abb242539a703bf0a69ad7052e80c13771e3b3c"
+    "17a198152431be8042df37b3d37fc973bc42b822317eb0b144b1b001b2f83fd7"
+    "77d20adb6f0dd8be856bdc421f413eb0bc244cc99cd52d993e3d0307ac6b6b6f"
+    "ca79c8e8cb5e440839360cfa78ecfc0fd102b49fdb7e03a77f4922d8abf62550"
+    "e93fef63deba570ac9b3d174e1a1c51aaf130b16cd5520fa7fd59305b40e90d4"
+    "86e20af01d312d65c403197be79a9f4b2d4d5fc3a203e5d5eab0200696e000a4"
+    "7228298e02c934207e0a140d50a1f01e49cf08e6e05d5db802853fa2c6fcb185"
+    "835f50bc0ab6f05ff023762df87e11a886c7dc7065fd167c448f601d9d232c91"
+    "ed570db877a7d0ea965d39201f4a6618b6fe9d5d4088854d098b665e9cd44a31"
+    "330b754b360f44917f2b7fe1bf88e972d52b55a2fd3a14f23038c0146e50b009"
+    "9ab8454e0660d0baf7da17fcad86ad1ebda565b3fde568c93767f58d0ca2a816"
+    "744236987c966c5230ce48379fabae6194e3bc8eaecfc384b81f6302692edccd"
+    "fc38f6333d0704f261dcd7a4429dd807bad401b5db01f762b3569e14c245a1ad"
+    "ba32b74a372d51d8710dc938113e1931ce891dd28ecd80b5aee7ee4ac853a16e"
+    "1d486779aefe628db7d8aeedd1f129f7868fbc0e993b24593c495758bfac2026"
+    "aeb368ee8ff64e4317538ff230b2f8216fb9413113adcb8dc116e1f16a9f2eb7"
+    "f2752bf369af14c7740ba7827705c7e21c1c15720700aa6dffb6f11881e39337"
+    "eea64e587676c56f9e36bc7d607f76818b3188eab1ee2768f990543f6d7db318"
+    "a2218d505e75b31e2b0e519b8e36b29ad89c3aa94cf0d4fd25a777069991bba9"
+    "ebaeae6b643f996d99f087270c3660738e27818d36597bb5e7b7edc06e73e627"
+    "d18b85fdbba289b45f938e9d579f65edec6cb7c82e4864709c04be20d20dbfd6"
+    "98a0cb280b0dc1d878343c083ae673bf262210e46869686d3bc3a938e1a13a40"
+    "0c8cf349058c4a824eb50a39a76e3c79649bd8fdd8e37caa16fbb0da83c5cc17"
+    "494d72acda222fd079d83f531dc6e897c82955966c7e36cecbff293939ac39bc"
+    "864c7a80e020f2482a1353a9cc957baccb1ae7e9bbda00e5af62788ddb79fcaf"
+    "236d420f753299a9cf9ef09804118c95a27282b1381a243562f2080b2ecb752d"
+    "b7ba6fb56d06d8bc336d349663d7e5f25b5587bd9ce6d951deccffaf696ee3ce"
+    "0d632632e2775916ac7936fb9c73c458b2fdb2955907a54fcf70ab9edba43860"
+    "1952775ec78d5fcc92da94209768df453769b72ec8b92a46b15f15aedbf123c5"
+    "7195acd18a160aa2603937616e8616291a6c24457625e5811f277118475f8f10"
+    "ca4850b839e5f69f91c1ffd2e50337c2950097103cf16a053afddf18aabf5d0d"
+    "0cfeb72c935a395481842860ee39deecc31f30f7de77f4d9029aa0513dc8e8c0"
+    "b51afa263b85c4c5e229128a2b0892fd71929939f73864fa431e7a2b33017329"
+    "28dd5a60ad9161b12dc13192f398a9cd0505ee1d95b43dca18a23cf778cb654d"
+    "5d4ad15fafe3679a5cd56e2bab08905a23f2b752b5d467a0508611245d30cd1d"
+    "5b13966af5c0dda1d0015653a3e89522c703c13beba4985f149be8d38626dbc5"
+    "7de84748ada9bb96f2089144fcd383b4079f67e37dd7a20879ba0f3eda36757e"
+    "480470ee7307cf1a65a82209018a2e22d196f23f5a6f9cdbfc1740441b345e6d"
+    "9870df8452adbbf7a1ff78a5d141bddd22eced525ecfb74cf056c3b5df8c7310"
+    "db8657fb0f7e03edabe4ad788a45967e5b19245fa477baa9f7c380f561951c15"
+    "4c892f81b25945ba0e8af58290e87d878c6b1139a3d405c4150e17ce6dc8d9dd"
+    "67e633b27a16d8a018f4e1556dd465be683e68603679f88e6141b269facd14db"
+    "83deeb1c475ed05509ed71141f77cca5daaa8c531160828eb43ed4c0c394d830"
+    "893799dd3a6719af19edd9404a34dee47d27ebf8bcfceeb67ec4f5addc1285c6"
+    "3d1b4bba43cb8313f1a75d156f8336718cea3ee1afc716f7d3589f8905b47d64"
+    "8307fd05c90050af8b8326edd215140a77547ddb889fab2e9ad005c80f10b74f"
+    "999a6705e4b14d100ea7269c93cf1d61484633b105d1a596046725d295c39c60"
+    "f38b2986b7ccd1021ed502420a02c706e3c663673ef8dbd21edb563a0b4b0c3f"
+    "1d9b1fbb94511ad37b3e6681c6138734866322e50c2893159b773bd3b8b83b79"
+    "337433594d017ae4b871dc89e4dac551e5ae92158ad368232ad23d7b7a4d23e6"
+    "268cf6c623672681d2d7fa5307727e80cb18a40e424b24e07b5f74d519b53367"
+    "5d07eb6809fa2e61472c53f30d695aa5a9b6f62b70fa4c486c876313ac322400"
+    "0fee7f4294b34d07293db1957aaca630c900c5b46ac7055597f978f81108454a"
+    "d47131fc39e99329b70a917924fd8069f9f80aeb0aff0ef8c87a2fac6f7d925f"
+    "7e6f5291e1266eaba15408d972f09431da6a20f03f1d44f523a00d108f2ffe37"
+    "45b3eec4fdc4f776a96ac4930d7abad87e1e3d72b7ae413bc70e37d0dc136a5f"
+    "df6f8982822cd274aade1a78af9afada121848d7fdc96f21be7a73c9a763384d"
+    "c6d68b4f6be4d60e419fd0c49dad4624ef862a9fbb04601596e7ed1130e50770"
+    "dba548662600cfa0c526bc18a14675a71e986fac2a8f87d89cf13c2854f46fa1"
+    "017e1f960e2430e17dff9a8b5efdb646fd465b2b7475a8a5ab7aee868c10a396"
+    "0d1d9298f88f00b455c8e2c3ac9aa0a8411e1dd3864b14606567922e3074e44c"
+    "df568e41fc87c94730c9a85a33e75581ba1529f573feacddaba3c0414cac29c8"
+    "dc828c6a8b08bd4b426834836d1321336830e691b2e7546453efc12abfdce8fc"
+    "0b14271d952a8d4327398c0c1696dd3d32e742691055d7c7a3b8ee7033f33180"
+    "7fff422b49dcf698db95a2702f8025a82ea272b0b65a628f1f4a915339ab0edd"
+    "691e5189d32bfa2806e37c67725e9815b35450d58ee4111522ca5935f9908a25",
+    /* 2^65 */
+    "a7ec73c1c27e9861032b4e06ef8be37a6ec4c7c5cdb41909f609311608d64b4d"
+    "76c859bec75aecbe1bc14092b8da1a3d8ba1c79b6fd68fc83986310556ed9462"
+    "ad6bee770cf265f8d8bc3f65c73d1454a42fc3c8d9d34507b061bea5a7355321"
+    "d319fcda483d0ddf1094744f4703075944334f2491a7ff33220443ea2b81261c"
+    "f2871645b2bb62d21b66a517ca177d9edf09d3d166ba48d0e588d0e76da7402d"
+    "6bd676cfbb9ec930030a37bb51e72912e048cd948115d3dcd0d61920be0d750e"
+    "8a744e57aebd9688aa12bc7d6ab0748091af7f3e86fa5f8eeb9534e5558a1000"
+    "84ab6a5135cc987c59f37c914f391df8fa5da093986e293b048ca65814ccceba"
+    "47e48475bbfc456c7109523bb681344b92c594e63daddc2234482c6b959254ef"
+    "22af7d1489c1d4875d51398b3e1f4f41cd3dbc4325d80ef86b521bd77e5a4e8a"
+    "bcdeb113b2b94b6f5078ef261de500c6f37d652f331dcb1a520455f864d9035f"
+    "8cd8d33f96f79060cce47e6e3efbcdd173c7e5d88c4255d0948e03f21e53d3e7"
+    "eb96301e2d1d58441931c5b88b6371ddddb9129002cca6a99814ca873cc2b62e"
+    "d1c6e60929cebbacfbeca1ed22ee77ed8be9a9db06c3bac4ece9aec8e8c678e5"
+    "e14c43c2c14e8621a24d760e309cc9c0f1f0ed47a61070b1b0eae6d96003bfd2"
+    "2738d648ae5d66e50e29c70c7e5f6dcb74127dfd9122cd73da9c35dcfdab01ff"
+    "c01ddee1a86eca19564fa63ce4bdcec0cdeb4d67fbb166edec21e6f7c58bacd8"
+    "6404aa36e28eedaac845ff57386981261ed90b91c4383e7428269ebce3bf52d4"
+    "1dae5fb02d0a9c98db4670f97be573dab9dd5c4dbcdcb1bfce10deed2a5d7d11"
+    "902f5577c7fa31c6901089cc706178fe68e596c7cca67a3b1a51e035815cea71"
+    "2552d661b880449df1f340cea43741084131323a1f439ee7aa53acea601a32be"
+    "c628d3b337939f5610a93fed0937215ab095bfda9ea792d11225dddfb7f00a9f"
+    "4da9b280a8e9942ce735f524e4c7abb5495abafabef442debc9a8c4b13735aca"
+    "f4152428f84b3110c6f042fe65491a62ac15a78985b7aabf087b4723c3b62ace"
+    "5b5658f09c280322f8c2802ca0293b8b78ca27d0e1f511b3c075eaa65badab10"
+    "bbd8bd4fefe469d1e41200f5162c3c567dffef2a7957cbfab75529c841a944bf"
+    "6f16032b2b215af2f2c9e561b69aca3f7d8a1169573282bbc6be5d3a5b67c6b6"
+    "7a2d3abbb40bd11fd1e974318793629a5222fab5cedea510dd34fe0fcab979e7"
+    "f6a949624533888561da7e6677765a5bfd9e723b48e1d15507d05b7dec1d1837"
+    "d8cc28444085007e6d5f8a2590d438c6fc147646d4176525ec0f6dfcec7424f5"
+    "83fea4383b6408a14dd65aae5b044af0a6faeaa380978f0dfefd67f9e1c0e377"
+    "2bcce8900c29ae66112287398c0f9b31194f6a203691a1929f47d06e29fb6b5e"
+    "913b4b3d213d8c8a437870a67486e0ba271f6630b75f8966cb65e535a65d90a7"
+    "a9107415a6af9d61cad0928c528979ed88c90b99b18b935538ea194fe13dfa17"
+    "a274c1b3e755498f7ec8aae9d53278f0f175e21da2ab0dbcbb96e7d0f8d11541"
+    "63c5f56338c35f1b2fe55df023f4d644d4ca0b04b50b05087ef2d95e0bc0e6bf"
+    "eda4adbff75f448608735caadb1ed712944a8d69bede43f559292c40c01c5032"
+    "2b6c8c6c5c2408c88a9f0d97e97a050712208796fc4b6d49e52b7ae2e9f8f2c2"
+    "07dfdb8ef0bb28b18033cc2c0ba17fb96d14273d71109d9ffec6a9aa2d9eec53"
+    "6aeb86568dc724767b1d982c4f5bbdc078ebca015f0824f571adbf590df3d315"
+    "5faf0656f40c3a76ae560dcd9d360f61723fd59a730f50e68a6861383024a9b0"
+    "a37504da1ff49122cb89447b04f0fec053ffb42fc5142bd77d719bf789299b8e"
+    "dda146a8bdb6056c2c35f0a5610d1d7451b994414ef20be16b222442d5c31cfd"
+    "b51ed3353780cf1a4b35ba8539697de19be41f82cd2b8c6d27b1250d70f15ff0"
+    "2dd4fb7d9faa957527c2ecc931783d0447ac414766c5d20997d76c1b8aff7805"
+    "e90997647922c5407527d8b9ffbb95efaf4da1b9043ac3429c0f02617ef5a200"
+    "e30e75547e1e7d16b2b3bd9d1d40d3e1c6bdf509b452ca93741cfaa1c148fd0b"
+    "cc6b5dc0b0313e05ddd4bd90d864d291645939b07ed73b7d153c92e76d57925f"
+    "2be784ac6325e33d5b36a0ef70a5f62dacd401a685c8672e41d747daed366427"
+    "e40e7e9b6db51615b96e043b6bd3cbb6c1622d0bd9f41a046c1c174c9a915ef6"
+    "f5e1523098776cd439edfd2c007e914dcc3f69394ad109dc065d2697c6e56986"
+    "94fcff6b6f005238e14eacdef93ada678b33298fb2c34ef322fce98b4ad45bbd"
+    "e8e38094757b0a6c84049c6db54129b636d3f001bf0a06a744cd16a09752d678"
+    "3eaa403585a32d425dff97a44eb4497473f2815539f8d1fb168d4e1d90e17e44"
+    "b19aba57fabb7dac2bfd7a90241a9492cf342a40be6658abd7572240b64e611e"
+    "5ed738a0432eaebf75d4bdb32b0a6effcf48b7bc5985f6c076f28cca29bee784"
+    "785f0830b415df5796d776e487b52f54d9acc2f5565b768477101589fad3d92c"
+    "ff182faf0e5ae17ffb17220f7dd3eb93b86f51e3894df806ed518e9eb4f0e3de"
+    "f8fc6fe62a32545e4912a5efff8a00e33614fcafc21bec068f7d7395bc806090"
+    "60dadf98bb3461e1c9099bc9482310e4ea55bdbf4c7e95f81b23c2bbb326bf7f"
+    "fdf8266c1707d7b083b7f36ada061ad71b71b5a4faadfea331692ddbe6f42f7d"
+    "025a1ba044cbaccc01d8c01aa305769e312e73a9b6f7c2e620587200053b2fb3"
+    "df4dc7224191c0719e5661a0f775a86af00ca41a21f5433ed3ac9748204f1150"
+    "fab3217e166e3995c31fd0f375ec07190821bf3d03a8fc3869a3578b4b570480"
+    "2699526b57cb57e2c40ad719b37d0afe3c09b32fc56b00456a45b5614c7a7a2d"
+    "1f04b7a391f4e4231f0472a2aeae717f6d584623d2ceb1a259d9111412f6d85b"
+    "20ffe67ff84e4d7b287349c94cec7da5a54063d54289c8bca40dea1c57884ba9"
+    "015cc154e3930c9b74e7f3b179e0b213dcba56a94c4fc301f91d114132614678"
+    "4a955c593bc4ba07f44d1860371962397acfa9155711c9814dc1ecfa033de486"
+    "cb3d856f945d8e9bc72591c0df2f6446ed9fe0c578c84c56f0ac93a475a71ee5"
+    "818d9e3ed2f76463b91fdb27d993915673a906132171ab50096948e1f8fda2e8"
+    "eadb4a14641b34e3610bfc491b71abd5f501d3cd689574ed0d211cc94abba90b"
+    "f428339483618173944934bb83254c41da6e321f5e2c504c6fa16e9bf8048027"
+    "73834854aa749d6eb81c7b0440c510c8d17ae9d503098a9cf8030ef57cf75101"
+    "cbc86cc59b336f9150e8184d6e42d18b0e47938c82edbbeae56bbe3704cabc72"
+    "19d67ce5428098c16b66a6b96af48563cf597fe7557fada9da930dd423f5ac66"
+    "b1a382638d2bd91acf88576c00edc1bfd927b0ba894aa20eb147cd9621c8b4b4"
+    "f1cf450ab44ac30de5ff3527f85e57ed8d489d065b9708c903ecb468f23bd424",
+    /* 2^66 */
+    "63cc059ecec2db7c40db88a07f1c4fe04f5c270f9f0199824b60d4e6453d3fea"
+    "0afcbe0f1e2c8f7197889e54e5a023d6b8ddcef1a4fcd1ef3eda1bdb5ab4fc4c"
+    "e4643aadc91cb72f52df2b712972aa3d3696732b406f6b9e8f4a1a5431348a44"
+    "43c10faa46ba690a1d60b27797dfe17ba39e6628a71c307c39995937d9174493"
+    "af007f98baba101f5864cd8b42077a9e4a23e1884b08a537252b663c18613880"
+    "4704d226f308cb315e652cbcdbf95fd0b4faba2d7d7deb77bedf4e73f2deba02"
+    "7af3dd2c8383f634b3662892b1d991735085b492bd6cf261ee95bd8bd49725f8"
+    "9d1adfc2e0c2c9a8261456aa2de3d780d82a5a0ddd274e5473af20fadc2966b1"
+    "d3eb3442fe56fd655d13b137459d3c3ae016fcfbea7adc81c88e00d7bf1b93a9"
+    "afe4c1534363d61ff37f25828cd52b9a673efc6ad565e02abf081e76e06ffa36"
+    "8310de98aa6b2553329eaa3b6f5c2b839f6b51357019eead30cd809a33338ba2"
+    "06d9241a96db8b09025bbdf5f18c1f8c8bca891ff4f2f0853fa46922261850dd"
+    "7c3e4af98b01285716708cc09f011a05c7f8aeeb84d1ca93e1d7e10b9d61fbe2"
+    "00c58d166bcd1a017345f68d926f9978f25435e159ebc6201b6b7dfa58d43369"
+    "a108daad271decdb7d4519efc047c348c45669cf949ef9be5bfc66e644d10bd3"
+    "1556c7c10ce4c57a37904d11b8c2f45eb3071e388574cc8c9e37ab7b015e4c76"
+    "834010992b35b3258810eec9cb5ce5eee482ec47ac4e185d941f621c99ebf668"
+    "8978c2c762758afc31c803385dfd4ffb6c44d50588c6d3573441033f38c4263b"
+    "c3c227135ce1720f22ba88c5277f286e7ffbb19b30cf8028da7f55a408261a55"
+    "a64a943be3f14b21d7f216f108753109e83da737b51536c5dddc2a03462cfb8e"
+    "f440458a11fd3f65d96e46563a68a06566e55d17e4751327a1d18011086283b9"
+    "4cf5d9547555c9b906e5c8cc7ca3babd9e3ece8672daff8c55935f34c5e2aaba"
+    "ee4a62fe23683cdaa4b6c2bbfb2e0f47d0b05ca17d2e57c9aed4789f60e101b8"
+    "7c8b49ae2e74a60e75b4e54cbf8f6c8ee2097566e736b139a6309cb65b2f239b"
+    "bd00885024c3217a63bd554807bca2842df96b91bc13e7e340c41337391cd8d2"
+    "e1502a79f0cf880485e4c2f64a22ff3cd7b487d2917120984276c70c96149bfb"
+    "c60f479ba8b5e51c3685060f087865611357eb5e21997594490da6ee1e24bf3d"
+    "d26e68347faf373634196123c59ca14b0eaa5afad636131c4951600f7b2fe7f3"
+    "a65d540de971351e2a52c47a709eec4a96072d8d3d1fba8d430f5d0b26070a39"
+    "044b7aef572605caf614163d1ae41a34b3155d305ca0b1f583412334f8589849"
+    "3a475126c278c55a4f8ba7029358a1aa3789efa4de9ef3dba42c1b36cb85e7e4"
+    "d9d4a65959705d4e4020ca31d997a0932911ab9e7d053920e76f58055abf0c91"
+    "c25a71674bc8567be6fb260bacd627f7d89e2c4a26e4521b5881c59eb1da876c"
+    "d1c904a2c3bad99227d8f3bb6a1f512946270f9e89baf1a9877df18edc13b570"
+    "cafb49a28d2c2ed603ae87e74feffd42cee33139f36254fd5ea366aa7d5177c0"
+    "6b28be02ab8f06041d0eb6c5665c18c18d9af2ac1ee4dbf734b1846fc3064d92"
+    "58be62eedf5064a5ee52a5d5f03776394077cae7d497509cd68ca84d9335aacc"
+    "3de58f181fd17320ae409ffa35df70d3c594b1897c46d07f2b7df7fef57efcc1"
+    "06d8d7f030256b0f26a344f4b82836e713a8025239257a231a3d8c9c51168774"
+    "ff125b1bf3363631b991eb4c07086a869edae888a4cd06b14967a4fb8c6a5d19"
+    "9ea7834bf7899f8c5daa4189b59fbf33cf699bfc00314511c4f885724fee428a"
+    "82e347212d8b2333508096c2b83c9246e0ad79a414cb501794b84d30ed593d12"
+    "0eaeab9e5c7fdabde2809f3b9a823a6e235ef405f5f99c4a91902a8212574e8e"
+    "712b7c6ffc649afb54e02b9d4f6b04f090335db597cd5479f8b7ebc8d2337643"
+    "ee80f97e53257d5c0c3e838f36a4f85c2fc8e83e724ae29609975dd3b1d9dcb3"
+    "96cf4e79c99238b55adc3e715926fc83486ccdca66c771a10a267626a43d0cd5"
+    "e14c93185a228e84eefef68590af4f468b96ade8faa1b8e1fa2adb5c721939d8"
+    "77f8b1298af8d54b6e999ed1c5f253e8228d2738fd4fcfdd82c90b9519790bcc"
+    "40a7e7d9ede0cb8f9d6853e486acd52c4b2d3553e1894ee13308c636bd3984d0"
+    "8e5be35208ca1e1cc28e71bb35be913d87f2f98f11648fc6881af9ee522431f8"
+    "905e82d4fdd707f0091aa73e3e5e8ba192734d40a8b0789919a43fcc6b9dfc31"
+    "f19dfab510221c00c7ad1fb92542888a04102bcf49730692e6ef9bb241e4a9cb"
+    "31df0997da39e3617541eb829bb8001ac4791d07114106a6b8679cb718a0868e"
+    "e7df91a1ee8d3b24edbad0c967e31837468a035d50c8b04c722b5a25dfefb141"
+    "66afbdfc08c13e8170e18dd058458c244763ea86adc1dbdbaa94e5f16b294917"
+    "f421b30d838be0ae30137fac74f2e5ca4242953744eb22c6fc7fd597dbf8147d"
+    "aaf654dd63543bc59d161d11872040a34c7fc2e745c6177c5905a9895375c0e5"
+    "6697a240bee1e0154d3ce2d6dead4d650b418456d85f2c108176a81d85367318"
+    "f0e0f1d7ea295ec7ac85fdd6f69bbb505f1b78d5cbf28ab0cd1dab6079667214"
+    "8fb5fbcea338afdce370670cf96263ead9f9e8c47f22fbc8c0aecb2fa748b7aa"
+    "ccb4891eb3066ad77d7fc3aebbb76ed370d50ee8c21eea5e2a0facd9a46b901c"
+    "619c19475fac6cd768959ea584acf43d147c9f0605a562d1040a49a69b694a99"
+    "8204a8ccae7c473ca82da52e8a8e1ab06ed376fd2d0b3a25c890dbcf2d622c21"
+    "da407d1e5c3613374a8db3ab8ce46c9c2b6467ca63b84d942bd37cc4322e1cf1"
+    "30949de23847c33d46a5e8c6a3c2a1bb4453f5926bb38389178aa60d038cfe56"
+    "f13a2818badf7b3e30dd9684f026d0e19d232a7b14a9057ad95439950537e820"
+    "626a836463f9cda371f824d67de0c1eac21b2bfbb17be22bb2c365e4b67da142"
+    "321616d064e6f8ce0d0a147450de14e88cd4b780f4d17e8c4f3e345101387bbd"
+    "89672af5833306154d3fcdc82f01d15706745f255d1e7d1022231110c7e15ba5"
+    "999b036a76d854e0132b8511467a3a17803c4c6f7e148dfe3f21cf09fd79898d"
+    "60ccf11091318d740137ad2f1d2ccb2314bc1e2f71ec5b2eb05c5aed70476a99"
+    "65de74be1287d5b0dabd01377e6d918fe32231e1c10ac0cc186d75209a81ae0d"
+    "4d8cd6c75e2e6b3ce01c2b669121c1d4bf2cccff64fadabd5bf2b8a56df6befe"
+    "bda57f7cacf23c8b7063fe566772e0052e8442dfa49fbeb5fea0be8f90304448"
+    "7e63e1ca97e70fe85f2d1ca1625959b140627d9561c0d0bcae8ea157289dc17d"
+    "b10bd6af990b08c6ff10ebfe0453a8db9742569a9a9dbd57e771f481b2564bae"
+    "d1c5fdc3d7847ddba0b9f5f20480a4e87442e93f0ac509f45493bbd30f1bf26f"
+    "9755e2baf3f54d449890b2aae56ca55903344ee0d16fb25e4b7a1b2f0cf8bc5d",
+    /* 2^67 */
+    "753e59ba7179e6f2e206a1c5435760786ac2b19da7e98828c26195b08da22323"
+    "d67e16aa3d6e761aa437d193b7aafea83604c2571aeb0aeef868ef3500a8f2dc"
+    "de80612933fdee6c057102892d7052dba39a3c79d6d99956ffd9e11d92817c9f"
+    "6298409e08e5a0235ef65dc0340f733f385f24e91cbe8db27245986c6b1b2cad"
+    "496e01d23e9b44f0caa422c598d0c2125dd2a2c0bc29fb10ecbadbcc88a0f447"
+    "c83f8d9d3ac6a3527c9ca16e56c1107a7bcdf4e26c586fa569d1918074c556a9"
+    "8ada6c2daff1062725fcfb654ff18de3c7f376b56f5f767ed84355fda74d3651"
+    "69a3f9984266f1d53070eab1b4cc2a8c8cb1e6029a6a8d1fc9a1fadeeacf7fc6"
+    "13300c81016169d32c6e95acdbb4e6f848e6002949d7a22a38e05caafbc830b4"
+    "aa135b75e16fa687ce8d686a954a8e0c50b981504a01acb824b759a8d0e6f178"
+    "529a5d063176b4e8f9d4d6ff91d9252502d1172fb931c32e57a389e885205f00"
+    "f8710b0abe92edc17621739d49db1111649ccf206e2216fefebe10b82d323956"
+    "dafc91af719aa7782e9c18063d1061286095d7b1b5d4f8fc1c9cf1f1bab97732"
+    "987454b6265d5c38c510369d933981e1edc58dd4a51fc70418bbd1c9cf68f108"
+    "78a2793a5dc433687ee4792f24d6ab684fdd57a57b6d7d0fa29bf533f1986499"
+    "d16292d254018cc5867b6d38fd7f4748dae58fc2cd113df2764a22e15d6ccbe5"
+    "54aa126fc8e6fd831ba9532db3d7a43e9f0c317ab9a8922d6ef004c21ca53dab"
+    "d6a3c7068221a0380bff4568b0caa261caab6d43b46fe74d59ac0ed497a55a73"
+    "5a20e0f9c976f6974545f3d4dbc565b98181c4ba828b96a506422bb3940b3ca8"
+    "6893553cdaf9b879fbf674941b0d534a1b0c1e37a5d67fbfa9b38eaf25f2fbed"
+    "64dd4a5b35f97e1be5e68a010c2c7221819c3aa79473151f54590690c5fad0b2"
+    "8570baca012e34b6a750d962906c21f95e632d6f892eeb5a92fb2a659ce0f879"
+    "6d8779ee568a80f22f5a002c32ced236b2e453c87c6c29802906f363c70a865e"
+    "9c6f5aac0108b8479336d4e0f0656c2c9b63582fb955b0879cd24ace56acb572"
+    "0ed5bedc64c4e06ffc32472b6ee1822d47821f3756a91b694929dab6e2d4f340"
+    "572b4b5642374b66a8c5f03db5c4983499fb41ef2993c8c26d23af4bd6e64c17"
+    "beed9d5ae9aa7b7490e932db5b0d18d01523fd4835656f9616655fe17b472da6"
+    "a7746f65ae8f2c6a19095c4c2c23a55d6beec03ea4b48b7f9c4d5ab8f3eac0b6"
+    "55a42c7a0f73b0116d430ecbd943143ea7345b863ad0ce37ccaac26870f487af"
+    "305016852b1337b7b8b7e4bff3853b293808dbac54a797dce7c15cb3b3d20284"
+    "9407c9d42c08c9624e86c208281a269697f7773ae0a7cbf7a95f73d179a34a35"
+    "503b29b56f28f94064eee0b6a20c03893d74931228ee16da8580adb2e76f574e"
+    "92d20edd270d5b106f48628aa4520caf80bcff88cd2052a322663eb33a5a6b04"
+    "1acb1fa154f4f9dc40105f5b377ae31957513c7305d42e70d847dd222168cdbf"
+    "6f6337aed88a4a0412c9e336e845489600e94dab8a8cf08f770a3edd1e6a2685"
+    "a5ef2865d8b2df01edb15513d19f831584aca54d597de24ac1c3d46da85aa143"
+    "43b45981d0a433b72dab867e0aa1ecae656d7b9f619c05611d2ada102277b0e0"
+    "5fe3ebed1fc6a007f03c58b0a9bb23ac9c06151e4ae7fbec3f86eedafe4ccba7"
+    "f58be61d7d26d57ec7623f8b3d1c517b50d695447aebaa9e7073d4a8ab792cfc"
+    "49e7f7b4499e5735cc665ad2aede9fb9584848c79e9d9145f35dcd506b3de5e4"
+    "69522e16b6e664758d8b4b504d011dbc2928ebfde9cb9265b805c57323031a60"
+    "4e95371b55ff97e929ee08d6ac5659a355c5e84a0be3c21ddd4715eb93799edb"
+    "df3c21746f3f0d7fa7649c4160f6c6187a656d5a12517bd70c6c680ec9e52520"
+    "36e4c1dca4b389cee6cc83e7070b58d1c676c0580cc77637752a646de5c81dc1"
+    "a8b8e55ce6724c98cca827e151595b160736f7ee372e8821c4edd6e45754b8ea"
+    "d8a3f8ce7d5324d71ec7c6478120ea5c01ce35b4d3077248713fac9b9268bcb6"
+    "7a69c15066ab5a232e9738dd1cd278428b901a2906f87c09275569d59f5da959"
+    "da761af0ef5a8b7b18f843d0329529c8410bcb7e0674a5e4b8715a55c7ecb3d9"
+    "f74ecab3b058bb48000816a7ee6c72ee0081c2cdba224021431bc298d7ef3c0d"
+    "99878fd97030d70d13a9093050c73a0eee4696310a2a90c3db1553871d390dd0"
+    "b9a1e532b97428e4277f2abca2746199a3cda55c333eda81019be8f5da6300b0"
+    "ddf37acf81bc9b9f6ccc35727eb3066a8fe3be8761a9b28ce2577dcafbb538d2"
+    "49415c4b6c882a73858d729e2cc9fe435ae9dc7fffce07285dad82e32059c1fb"
+    "520f1d3336de25d03968cb757f12c37b372ee69302e88aefeeee727c40e2b194"
+    "e19da172cfa6a397d350c7bf1673c0d1add51e022561a47e2750818a3d838f4c"
+    "ab5dfefa28052c3a61b8dafb55c9156a392528652ed602f7fe1ab71ed9e69b84"
+    "c5ce752fdae1e76d737660637fd195a18853f8ad61e93fcc24b83c07857c40bd"
+    "4ba8e70451ded9471d4431d2b20d516ebf060ca3b43586a902bbcadf1298412f"
+    "2442e0bfef93d1e5c44797e7be13b9cf6941c13859ee48e259af3d0e6d0b252d"
+    "ab399623f942de4983a91db636fb08f3ca878482266127b2e921fb7cd1cf0a0f"
+    "1b46b89a238d8dbfd423c4f0b9797093de05565e2d9a8891088aa7effee517e6"
+    "c0923debddde847debc60d67b01660a87fe5084bc5cb504041327b2a3c0fe235"
+    "a39ed5d8b649c765682464d599b71db56f264923a5d3b7a29eff581c33005387"
+    "47af68626481fd8c92764540600bbf9236f463d0925df83ec7b5f868468505b1"
+    "bd0d7a773282652dffdb769c7e0d64810d0d8b924dae6a22e481fcf50c2ab709"
+    "b55d94646152905cd78613a973b05c70f825ebdc0cc214c9bf754d99b8de6efb"
+    "87e070a45534c69efa4549535a3b15e526781e1f7a120b8b15cff4a6ddc761c5"
+    "a7d5e853f2e198c132484ab52600f7a3fbce9de717a5058e932bb5670efe4ed5"
+    "c08b9d36b8c13444d7a5431e03ed0133e5d1e967702d0ad9f5dafc74b0d89e88"
+    "78198d36b4559691022fac1d8c9e0bc6273b5e3841d488ec3f0f8dcfa25a9c0f"
+    "b03d1c1ddcedff70a55ce22cd5ed15b3131037e5ff0d15007c446466effa7e29"
+    "749a53ad5d381b4c1e258f4d3ce24a241d3b7b3c912f735223f4e09744e3c4ba"
+    "c622e4a748d3207cb17cb98471ceb988ce453c7b63fadb177ea1d3cd947d8cfc"
+    "56333f255fc7b91dfff1d858156e8ccc88997610c343adbfbf35b493a715d78e"
+    "6fa67d455f436abcb5b8ea8f8f32e678bfb9fe82ea5274cab4eac47537e8d00b"
+    "b3e397b0f016001cd21bd97933a138dd29ee3ebb857936df283d99f64b679752"
+    "876752edff7277a4ac5204a9eede087b40b7bb3bb84c38b6f6e2310f9ddb6826"
+    "0c8d3193414a3b8dc50e9c1637db0f5e1862a391e71ff29e4bbfa51b9a8bcffa",
+    /* 2^68 */
+    "471f49cbb8abbcdb8da9a3ade9a749f0d877b9c2f7b3e30fc3bc33641bc520e6"
+    "67a5b914f19e6e278c07fc6428cf511b76434183dc82d87a8d29be66d7dfb29a"
+    "db48db856dbffdf83b65dea73a31b021a063b87971472f602065a39c3bb11055"
+    "75098061d36e4865f11fccbac895e50058e5ebb48dc30bf6f978e22299732f2f"
+    "fd4c020105ba7f5ddc0116822511c2a5d48fe8f7a4581feca5af1cb3f6e1fb2a"
+    "be2d5b2cfb4185b7da9cff1bdd3127cf7663c5679666db5d1a101233b22fd056"
+    "d3df013f56fa9d9a89ebdb9b106a6158dc99d71d7a885dce3eb36281fa1d92bd"
+    "a781b14fb4fffe7b82729c2ea4229f4ef65412b100ebb8f9d15321f33646e9e0"
+    "ce2fde977eb7e1412aba8beb32a599071f34d59a3eae1a93b1fe5fe1f40e8dbd"
+    "3ef420cd2492dcdbdeae99bb43a5b0bfc5672dc18a035cddc5fa0eb9361dfb3b"
+    "d95ac9313afb725348233ee5d3e14a476ab0d87e8bbeb8a51157f8ce62e268b3"
+    "d756e26edb6b6721cf30d2530bfd25bc146f267b88ee701cf5fef533a77d98ab"
+    "7a42b33d7816b6298f4f25fe802d4f45732042e444d3d8b0ac5cc4e713cac3db"
+    "0e74266a680d66f03492cc80239877d58554b47df513e98a37ccb24bb525a947"
+    "d70a3caef1ea1b7d366088cbd9326d5cdcb1cfd54ae73e53b6875a571fd21dc6"
+    "8229f7ef75ffa6d9bb84e06202fcd3d1811fa75111e2bb69a0de425d2101ad76"
+    "4bda31b806ab33785feef83540893387ead7fdf4e5d8504b88ae78c9b2e4fec7"
+    "96851ba3c33fa84faff1b2ea0b1bfdcc6175acd2c65781e93d2c4f7d33018c84"
+    "c6b7fdc308767cd9948f4e4c35457802984b3553d0a4f1e0f5f5ede909ae1eaf"
+    "e3fec4390a93038711074944a51466c82a5e337ee36567097359be18b02052cb"
+    "4d83454f0b1a127960c445a29758f1d718dad9746dba6e352c9735bf55d3a027"
+    "0e1f8c3f774db8ad257f719cc0e6f6dbc6d04cfe651409bcf8159125c3846332"
+    "0ba2a117b831cf28958c019c83e9e9ecf992121eb2456e36b93816265f69ed35"
+    "2c3aca9177db505d6095799a7dee3dd7926dad6ff14a4cd04f79734169a0a235"
+    "8682171b07c8e56b3551e17460a537ec2bff6a3f396c8b214a0ef94e807c1af2"
+    "5be4ca2f76b39ce7404082fc2bec88763ecc8189b0ad267fb13e11e0561f9b23"
+    "1d36828e2af184e6e3737298ec8740f0e398a73cdb15911284704c36309e8eec"
+    "9da46630161d02cd69a85e66b5a0d5f1410559c05ffcefccef731fa246aff787"
+    "d306a45c1aafc8bfce8b2b834a1dedbcb28f8c7629e2db084eee487cefd783ad"
+    "e9583adf7fddaec2f3f23491461ca7de14be8476aafe267966d37d041c0ed325"
+    "bcf93af5fabfd6415b9851f6dcdafe9a392535ddfd7bcc4dcf5d92d78ec1c698"
+    "2219f7ce5c9e14514ab599cef8faa68f630c185d525a5114bb2dbe68cf16f0ec"
+    "fc9e2d68082bd9a43443989c582056640ce480fa1bedc4204664064e48065e29"
+    "55ee6941e1bb3e7ecd4e96d951ecc57d6ad9548f8d77d66d6d9a23a6c7d13e5e"
+    "b8a44f812c16196688647578aaaa2402bcfef28c09970b3a85c12a7aed6e3728"
+    "d4755b9bb3d3f82e2b57850cae4190738d103c799acf6298d7433003076f79cc"
+    "59b607ed95771b13ce95d408521d67b9c2a465084969a6479a1e11611cdaa263"
+    "228bed3aa32e9bcac73d8d8d0dfb86ea0b4ecc8885827a04ddfe4b5723249596"
+    "f7c7a192e1c8bb79be1ee4817cd26ec84fd4805eb5d7d61241e22f279f7784b6"
+    "e8c74d159f1334a0b7236bf851808349f319b3b7b40e095e60d18307d64ee288"
+    "b58109817b6ec9b7bbc9db8332113333783ff737a969ab7c603364d16ef7417a"
+    "bc68bcde1d3f9bf150d28f9805969a391372ac46c43a440285d95bbabdb10d37"
+    "1188fd349ce74f135284b7ba25d7b2869947cb03a223a79443b1872a4f72831e"
+    "7ee3bce612b8919e56f127a0a852132b6446ff14019332323db3f849b3d416e6"
+    "1916e8ac1d1c9e77209c61e39ea49eb690bb9776e01317b2089fbb010c55e786"
+    "51460b13bca3d33edf4b42de63cf8778399fc09add94db58f63ef2a1045c854d"
+    "866b8a32acac79be58bd8ec949c11104088b9845121e53ae7ecf8b5b75763896"
+    "a7d793ff2b2cc165ac297a197a863a46650c1e4c4772eafcd4837662615f3fa1"
+    "275d066916dc8be4946bec6f5953337f76d908e11465b6ae9a8cb49c5d3ad2dd"
+    "99fb5049b5da1db1b5cad7692faf7e983a9512d52b3b9ef5e06f91ef10e42726"
+    "69786fb766d80d17ed79d01b1561b9db607d999088d61d7774bb1f2370651c9f"
+    "4072f63da372fb887e2a6aaae68be1ee142dc2c78f1553677304241f871745ac"
+    "049923dbeb58dc2fc34ed64c16dd6d1b4af8b23fe83f08c835854f1d8c67c809"
+    "95089b98c1de2faf4d47fc500838630c3ef4a54f1f810c2830c18e637e211d99"
+    "70f04135e6aa9280332e601d545b02f7221bb626a41e7a1ca504a1bee1193da2"
+    "7e7b0825dc4e7650a01901c8cb1fc0f0d4215b6a6a60e79ddd4844c67eecc451"
+    "02ece3a73e788051a55220cffc5cfb76e5c7f7f7b7c2a3826d77928c03df2edf"
+    "717692b526ed46e684aaf595e425978ce6113576004402617f90e20fdae49585"
+    "762361d5b13cc9ecdc7a9bd14ce99c45de1820fbc48a757691d3bd0a6a1a0182"
+    "d0f8dcc5d3f6ac373bbcbd06ce0681bfcb0f68b14ba2c29e2c118cda69a961b4"
+    "bc3aaede81eb883350c2dec196c3cec50afd244d397cdbd83b98c850b9e6828c"
+    "6dea980d5eaa9aa5939778a6306f174691bb2c0ec738534afc264377bc5ba087"
+    "3d497c8a404cd9f1d541bcd496acb74b973640cd2a82c6d45f56a341cdc9ade8"
+    "cf3ba849bb8a327eb0c1a0f2eb69f87a38c4bd14c7246f9bbcb18e0fea6d6fcf"
+    "0444a8f421911b706db93d27e7be974a1a2184914362d339bb4a26efac935fd4"
+    "84df66504f7036f88c12fecdc03d120f4ed8d1975ce8b602c2b97f1e71ce6a07"
+    "5794b37963c8be3f4b88e5da5513d13bc749d7e8e275ebe7aa73396f2f06d9eb"
+    "6a0dc3cf4ea12b60d66230321b36ad505444c2d576176783eaba98dc9f4f4657"
+    "d4d9c862287973023e9ccf08bda2c5e44bddee155f49d7199a001ed6cf00ecd9"
+    "db0c0b74dd9b95626486b5198bc80690dcbca7015e6fd3579349e8692cc51e55"
+    "e91124e0ae64c6d37f8e3086b5e39ee825910eabcb5298ff417345987a933a34"
+    "ebbb9b3fef21173f6e15182718d30d77903c4bb62beab1ec8d9ff220f4d82c15"
+    "8a1ec2a3612ade316c1a94fda3d253f1d67645563d484b25b6a3526f9c534dfc"
+    "338c360aaf77a9be46095146a09dc65d2ec8a560671d72bd58b18e718abcc29b"
+    "2028c8cd672047f6c71970ade6d3b1898af1755ccb4f9be2487a5e1c06bc01eb"
+    "3d7d0013fa474131dfec9eeaca09c02fd2dec338e4f673d7e10752d8a8582a83"
+    "b35f3599ac5f7778e3f99331cc9515215b2b59322be8cd5a224811f714f2a7b2"
+    "fcea21d86981f3eac9b08f3b5e48dd246035cee4fbafa86c5d52d08dda8abfef",
+    /* 2^69 */
+    "3da6ff81bcc4c9fe5e5ee3eb321caf995cc50418fbcbbef0d5ec14eb17a525b7"
+    "9e4441c151e10b6b1c549ea87a4e71f35d35f1fd6942421f7d61800ebb419891"
+    "4cb0cd4ce757c9944f61109b9ce772712102a0f4a9a574105b96908801e52862"
+    "d468d6f6d660639ca8f991294adf8cd0409a575a20142daf4c9742111b50fa68"
+    "3237a94455f99e2a5c33e7b425f58e1c0aa6d5a00d18ba2d732593e12129ea0a"
+    "01d77e884e89372dbe6ba04fb82b109370d3880f19f27a1950406e1cdd23570d"
+    "be319bbe83fa40e8f4565e68710a74d552442a6d840d510abbf85e47a19ee052"
+    "65353209706c9e47e1612e6c66fd851b0bac5f662e27d05968fb284620591e01"
+    "3636da060a69947956d6ae3452719894ed941c9dce4a3b25a6dfb6dfc6779a9c"
+    "fd6b34af321eb4cdf58098d37b66dd33bfd026b93d21cba49a7db7a5740d8683"
+    "41de665d294b348f1db1810ecc985599f5c5a39aa0fced808ee5780cc736cfb1"
+    "43cfb4bae6b49278822447721f8240efb7ec262d4856404282a6fcefd916e4d1"
+    "1d5036993c128a09c26b6239087c80e255bf9a96a67e2cb2eb2aac5e85bdccfe"
+    "be3e654c2e8e04ffac177a03c80936b0b31170fbcee6d1a0bb4209d8210f6173"
+    "66fc7a53b4e263781d1deb074967dd6ea168a2fdbbe25863a49664aa0bfa3085"
+    "f1648038e9fd2740bed87d68d9f514cd222d166847cb15ff0909bae75650b09c"
+    "562e57866784956d47ee4a1194a8cb7f78c97e99d19d3e1c022470c1e9ab2e3b"
+    "fa253a02ae1fcba7db2e88759d684f07cc43a6319c577684b0471f51aa509bf6"
+    "5663275431dfd7cb85767c4c20556ebcd0fbc57a7d5f07e6ba1c50ad4b8f3355"
+    "261d3bc6893d784796f1ea640fc10aeb33bb4e1ff926b8269df48acee77682fc"
+    "eb020480369eaba23de0ac658f5a433d8d7ab99f44c3355ab65f34fa3e2c5fa9"
+    "77505603f74ef5270fc981308d0593c5038268f42ea7cca8e95e2cd6dde8db0d"
+    "c89e7f252de1bbc94ccb50b5f0953412325903095144ddae79944af5c1db7026"
+    "05d87e19f0ecf0cd674f3ff82e355d0a95005494c045b3b6feae9c05bda97f9c"
+    "8ee0c3e80eabd546b93c12ff5e79ad36799f4289a9f3ae6e2e841327ad5cf1f3"
+    "3d5114a7093c8d09c980ebc9f7faabd4d636e7d95f92da3e4bde6122874ea079"
+    "3aadbe9b9bdb0e39d3dd22da4fe063cbd312a0128e93594d9dd70573372769a8"
+    "c40b5be73d614b74cb211b9e8c8a556e711a5617861a17907330a551baf5918d"
+    "af383bd6d06be8e508b49c681fd79bf0cdc02400958f6c0a41de94db00b6b788"
+    "81fa586b181787b7acfcfa3eadbbbd984d5ab7b3036e5e792f2d9e4251ef5073"
+    "b48d318b5b1b0f204a956cd4bc8a622ce51ea5bb3e40f1ddbdd35be72da38a2a"
+    "689151954433403bb2038791ff8eb4a56476590aa5158dfb0697f4bf2e944650"
+    "8a7f26dc4ebef64890b322226ea78909c657b26690e3e7527e311e97ed601930"
+    "9bec1b486fcba7ec6550a2183bd9dedf4b935201d917836566662e2bddae6f49"
+    "061b84f5e7b157f6c975cf1d98edd13e8228537122a77677475d5813a3b90f29"
+    "38a6e0798b116f3edc019c61fc8825d54607dca32b40627705df29e889ef6d3a"
+    "e85c33d50b43e3c806ecc7e6cf535242d3206c21edec6c5986cbaa9607f4245a"
+    "07daacf054b26a202c9ff59f4aa8e62047cf7ac09ec1822a0189a4055211a357"
+    "9072ecd786aff753788231320098273a981e1e4760b6e5971a34f714ab65e4f7"
+    "10fbb78a26fc342cb2cffc2cbdbe79e4542e469b29d50cd77d9bcbded38a602b"
+    "b40cae9157f92d489e32d8119575204ea8b9b62fa95d782a33e7a513f47c904e"
+    "bac58d64a62d9554145b1968ee2e6b062960db79fbb4614afe8c06ab8a59b657"
+    "8e872344e85b3b3b720edbcf0bdd53d6c07070724145b79c9883c8645ce02940"
+    "20afd72419a3a18ad7f86b67707649663ed193055fe70435c43411bb44881b1f"
+    "9651ffe7c0b33c31183c8f0c011780edecfd556f56a0105610dd50f5fd5ee7d8"
+    "8e3d8933b9a95fb33dcf41ac26fe7fccbda8781c2f4d448cd6aadfe6f1580370"
+    "6827f5ba6f3cdd0f46d6d1bda5e79ddb2ad09ff76eda32576dc4dddad32c1407"
+    "e111530a4d9aabbe789d125388291ab00ccf188436fff0ddfeec785b1eb18af5"
+    "fc6c7e20180cf100ef5d23e651cd95975446b8eddd08af28ef35dadadddac102"
+    "73dd9389055b4b853c62cc1ada5a60ae39470d3830e0c059e4f4b58952219d2d"
+    "ac610682e2763cdea4475dfb1e8cb59a3a8bf3c5b745490ac431ea177e9d9714"
+    "21fe785f9b4aa6b2fc3e8bd9ec65e28b4d7e7e78c6d050581e124714313f1ec3"
+    "5c413a29afd5b85d531f12a72993c71ba9ba66463ea961d875da9ba0b29ac5bc"
+    "aeaae12cc0bc1de522ce1ab5ca0c32d16e92695f315f3995ae35c6d00a5adc4b"
+    "0ecf6d751e5cb6587f0597505598258c2e8503c196bbdc400788697ab0498e7e"
+    "648f4b7b4ad3f4fba894bc60bc9751f91f20a3fe07c89814c049a0ea8e6ee69b"
+    "de1337d15ac45c4125e10d1b5c95bc69be5f625cc5676fa09420e550e21a1ca2"
+    "c1ba6a99f8f8fd4c1641d2204db1f554cdb0903f53529cfcc3e3a3d24fe91359"
+    "4b6a54895c155779cc0044aff8da6dfe16d24e2ce36d295eff10efb8f8832e67"
+    "2810656de4619430b6fb4bec7f7ba1f7e6282e0330e1aaab20d0a43e718dcec9"
+    "0a162bba3aef60c58bff067d9bfe5820236c0ee6236b0aaaedddf5d0673119e8"
+    "37d04e5fafaafc21fa03cd2bbbb44a7545b14a72dcdfd80fb62c1279dc443b24"
+    "4cf56b496bbc6fc6ee9d86934ad58d54f39f14f84f2f126f10acceb8eff489a4"
+    "6f1432941f3fe19fb66a79bd11552ed2c507e04350ec1aa9cc833ab061441fac"
+    "d9b68f4dfda36c79f8afb62abbc0c09ae763284a328d1e77f4a860b09eebe1a5"
+    "58b24e7a4feac2c7c1ee335aa5ab51c32b3e6a1dd08c48ce79a3d14f5d224445"
+    "b9271dc97efa35281f21603bf08140f8acbfe71dae1ba9acd33f9775a8d1bb74"
+    "f6d0e7d913884c8320d7d016a9db91e4bbc72ccfeac4a2996d168747cd30ba86"
+    "6d4170e9817eb8940d37c7dd7cc58051733506fe3e6a506b62db623160a41fa1"
+    "e71c89f0458381f7945b1c5410c570b79520777ef8e155df5a9c23f66705b391"
+    "cd4ab0c525e9b3d9859981817d9c4c417842950701affeda5f7f45f7b209f92d"
+    "9ce097c8fdbd5b848bc0b47524935d04ec7914a08059604095dca2d1d2d31b8c"
+    "4eb1ded1df697ca433a50aff0e60730e472336464b737057d9c7646ecfb103c3"
+    "95787e380269fceee7d5816964c0ed674fef4a5796183a732d338f6d64b70ebb"
+    "9dd9cbaa3fd0eba875a643255a5de772929d615a1111bca4b6acce9de97a92b5"
+    "a6f270a2dd6b531ad52829ebd0d2ec0906fa0bf33a2236f679dbee2e03a43c2b"
+    "3bad283574a1ce56777584e4fe6496d498263971dddecee2061cf6901c279e25"
+    "80dd730fc4d5fa1a239b752f8f0b2c7894298747bd6a91ba998e1e247cb9dca8",
+    /* 2^70 */
+    "3e3a344b386b7528a5820f1e1298f2ab8e6841c0f8569c6ec07a0b7480eb4221"
+    "68a0347b4fa1f044cacb33228d8ae4224151c1abbe806a82b3d3aa8ea0bd1c63"
+    "96a985aca898c2ebb48bc68d916e4d9824795c82dad7ad73c1f32ab31ce6212a"
+    "3d3801c251c2f25b64e6121961278cc1d516eb9ee3917c0e3ba9f01ad94c9ff1"
+    "d238d3b90513ce11e5a74f4af57a21d5ffab1cc4bc73d4fd7cf5a142a3801b3d"
+    "40011977e1b9c640014e31bfec32313233b4b51dc54ac568fda1fe00822d64cc"
+    "111fa3502548b0fe7ec0e0664ba5261cba2318db3e504d0fd343645fb6500384"
+    "743d70a7b4716b02f490662e252734473d18fc37db2bc4c541763c5dbf2d0376"
+    "b3879f78aa24b07f6d1c992c269ea31f1e51ce9eec8b7662978bacf953450421"
+    "b912317e6a05a292a231ad77f803b72d81414f70bfb82d84580e8af52a065f69"
+    "86c22794932481396ed65c52e0447ef5f1d556991c4bc07df6bf1aa72f67d8d0"
+    "75a6558c4cee7d6a424813f6cb5d5f945af377d9d04a9ebd35083b571b4554b6"
+    "a50f351d58baa9b9e99c868ab95148555f238bfe11aee337a99457ef8bcdf5f2"
+    "fd2a8e16deaf59b3bdd750897ad9b4c8ffb224a67aa287a91bb00433c4750343"
+    "124aa8ad2749eaa24fcfbde823cf68c065f241881ae81266ea90503ef64ce9d8"
+    "caca9b15f654256f25ba34d8b429f579be82bbd8f21b688a0d80c23e89618c08"
+    "0ee48fcfbabb169a7f61ee186bd78b8a38336f240e1f0306469784f30e6d79f8"
+    "efaa4ca88b1f1610080c1f2927aafcdf54d2acf5b51e260b0f776a6429ef2a17"
+    "f5daaa22d9aa0e45a272c5cb4e7f1ac698acd792bedd74927ca7b6578a85cbe3"
+    "c8490d506d07ea4be4e8cfb165a95ffcfa08d88cadff0dfddad73231ed698995"
+    "b425fa9fc6f98d97ea07abda202e91be5d806766d7050e8163cf8c3b556a24c9"
+    "61ed92d3b7938b1cf6c93ea169ee8046e264f1351fa7c73760c08830c5e7aa25"
+    "ce62930eae45ea620fad98a0d039f46aad1326dde0b6d28eac436ef67dca99bf"
+    "079ae94ac480753efa6163d5b98db292278883f182dbfebefce4c2ba93097617"
+    "ec6b26577acdceefc3694494e5ccaad42636767679c05cda9d935da21fa908ab"
+    "e557a7aebc3d09735fb72093ec6415ce85bca77ff32c8984b3ddbc6b2e7c4c5a"
+    "ed610a778f3b8ef6f7e46f2f2135a27e1603bd095c645aaf82a7ce6e7fa85204"
+    "a1823915ec0b2e7124aca86c78ee1d86d8b0c58343ce9298827dcb7ae55806ce"
+    "a184a5454db285c5c0aa33418e5ccc3ba11b5134f43f916947a4b2442d6c8d28"
+    "2c9d7b7b271e25fe685ff12560f77c94133c1fd3d517bca9f3482c157ca693a5"
+    "f367d542bc7c1aa077824b79a060482a1bbd4635d91dab78849be80c8acb74c8"
+    "9776f6d312f36f481bfaba902eb435d52b39f2581a67f5621f3c5eb5c3d78ff0"
+    "690757d4a57131d87987c743229d233a3ab635f20b73d25f9417b68c0ffd51be"
+    "492bb2af2a9ac924e5e8d0a5719988603473f08482ca58599e6243ec129d31a1"
+    "682900657d647d75054b4fc0cfe4886332462ccaeb46778841d116eab80a2949"
+    "8cd6ec859d318633a6ae6c98d4f0c6ec3278b3bfcc86c5e66c8b08d9e18358d5"
+    "c1909cbbc64fca8b34f9a933cd9301a87910420e26e5b347a34e7dd5c7ea638c"
+    "19bf4321b2182fc1b050bd8bd8906a94dc10c36ffe02fec6c76513bd5afb2ebc"
+    "1cfd722d19291e2bcb59aebed81abe95684dee4d776e7c602da7a5afc9e77e08"
+    "042fb5593f5accbeca6b3fb048d389149ef13544f1ede4c04becdb03da9ba344"
+    "c08524673b2cc36e6eb6d2765d5b66610ea2dba04af7b987b530f234f98d20ca"
+    "f862c597d3a016eadbe1abee475240a95a6c86db63412b38ba43a7ccc1eb4402"
+    "32b348ebb28cf99d920d0f45483e193274b72866c5891dcad47df10b49e4b52d"
+    "ba7bef30bffed76c0d9db54c7d879b6cbf35eea640f807971a9a1c3c73efe5f8"
+    "0aff9460c64095ad2bba8fbe4c26f6f88603b0915238114f142eff69d28b4dfa"
+    "86707ccd4145ed007cc22c4eb7bd66b51205e7b8e4c70e7730e3ed1165865a05"
+    "249c052f91a61035d86699d99e724a059e5500cd820b5162c9b0ac321bcf4c72"
+    "ce98e660659151a95566b20d33cd5ab05513185cd54aa4d25997fb17b29ba53a"
+    "ccf5fa59118bc53769f34de490c321d860ea6f98324b38046d620e4fbf1f2b3b"
+    "001fabcab8732579766c6e345de580dafdefdee09336d82d81463e55b39cbee6"
+    "086600d07ed87df627ac663b426aa26d7877e2363e631786217cd4f83a29a385"
+    "98f39f6ce871cfb676ffd46288a804cf8910e07f8c9b5173b164ecc3cd6466bf"
+    "e555b9cd8264ef7dcd56fcd216e2993c6ebdd30e8bb6b0c53b8d32fdfa54c6ae"
+    "fd5573d9968143206d8f1a6ed9e820ce958226ed5e5f07f9e180e56072a19948"
+    "c24db2ad174d40aa606286c2d33136ffec7fb6793809f024b59fa3aeab2e6082"
+    "d30594fd3a9a888c9fa0cb45c47490ff5eefc724ad3c61c645f1ef92c5e9666a"
+    "b34e2674738436e72aa9f23ff4b8f4e7f6d55a53baa600c4c640d6abcfab4eda"
+    "1b3e3563d77d8e9e5b969df5f2396fa1019fec9801bb8ab8f0b99fabc8eec32d"
+    "4e531f13020288d7482624141959804b8fdeb4f190fa5486d8cbc88058845770"
+    "97a57e90c1839ff1b1af34fd20f9b8fdaee197f3d760171b883cc97b00e8efeb"
+    "bf23835d9f847072c7d8aec82dbceff9a674eaeaae920988e6032e543d923dc8"
+    "dfab3a2be1d1302efdd4d514e5e5a66e583114f626b7020a4e958d6360392836"
+    "7b7838c876bab2a82f4b0f683c3e4be2daeeab09bd2ac4a6a3d6423289b2b124"
+    "18d17b9cc7661c6a76d92173303687736cff4bb837911ab73f3ddef4f3ad0355"
+    "ace9fd11838b3054682ec0d9dce06236c2ae03d2927185b430fe7462cc421eac"
+    "b0596bd6702760625cc00e3482beb08cd44e0be5079902b3c7de0706dd31e5df"
+    "c7269ea8ed37287eab5eca2f12b0d26496a9d20dd78aa20a677f14bfc12a4e01"
+    "44931cdbf5843b8f61b602796d9ef0c52c79b01a4d665502a51490b624938387"
+    "6eeeb1f253410e2d2fd4e2f34307c09fdc6184cec441d19dedb9b285e4ed5bfc"
+    "a38ecbbfe0e68cbb92b5dacea8fe7c9399463b39ac30b59f75fc1fbc41a8bf73"
+    "cacd5794bbe9989126dca3dede4f6f59df1c0fca641cef9de654cedbabaf34e9"
+    "3043b4d7fa9f49a416e9a93794881f979870b4682942d487972b78d471103639"
+    "d59388c24dd74403e04480a6c37da05ddd26fe45e30898afa0eeca4d9b3a0c42"
+    "4f0988e665da1d5ce7838dc73a349376f96e661c6bcc9a8d306b4390831ec7f9"
+    "a7c6a01effa0f858902e680273fe8622a14e58c3c47777de834d0cfc4fdeb392"
+    "3fff9722d7fb0fcfebffaa0d91d25a550211ab7c4a9fd85536342545438082cc"
+    "9f95f4dd94171ed2a5921259baedef03bac68116e5bf219fda83e500b6f046e4"
+    "4852782330633ebffad61befc78d26080ad7bad4954134ec9ebbf049673759fd",
+    /* 2^71 */
+    "d6e493d31f447296f4c2ddd7b836164932da27915047e59c52207f010aa73f45"
+    "3b41d12b81d173a6c32232f0bb1602f25c5b2af189538ca4bde1493614370fe2"
+    "992cdab020eda4641bf660db844b4e498e4d70c154dfbc43b6956a5cce69e2bb"
+    "1d3c9ac99d8aa009821d1e1bb674159740930be6d0a36d07ed23a822aea49037"
+    "3cb82a5263072edbf3834ec5252f502dc77ab622d208e7a034453d10f3c6a7a7"
+    "ade8c75992f9d56d63e5bc40475df3a9753951029b127874eb7115f224935cf0"
+    "f1c60b16c3be747b679351971cfd7b43e9291bb911501e130d12cbee455c92ba"
+    "ca0e68cd1a2a9247eac61c318d14dd6eba6d5415a3126dc1fea7a918e0119657"
+    "f72579c3e6239eff7f20eadd7b036eb95a458880c6f96af3dd2dcd6b035ef6e2"
+    "8975824c8b0f50f22b93d760703bcd62f0e7cc1935794486bf397dc6f9a5002e"
+    "8d2e67476a458e95d0d20e5c20c8c8029c30928071e2fa44ecef54807b4496ec"
+    "098f3a7e196ec6fe3297df658552a065f4b688e9bfa608b845d2471d93e06c41"
+    "578677b4638596fab232de32236be6b07fc416a51cbadc1d7f2e75eca7614167"
+    "ee8c88d0607548c413d0afcc9c8a5949cc2f45cb51cd65958aacef04e44ebd4a"
+    "ffcb123c2765b4fa2111b08833c845c697b70e4aa4bbc64d903613ac9b2bac74"
+    "41501e74f6a50529f7bc0a1829fe6571705f8998d433f38f6b231844ba82fd6b"
+    "97c844e329cacd080df66448c8c586b7a4bd968cc99ce90ced333cf8a132bf90"
+    "d23adbe4e5ac7a9c11d39e13e01e91456a8f0f28e264327558707455cf27890e"
+    "d198929382ee7cdad8ae1ebffc996814b142920d526a3b15722e9e8a170325f1"
+    "73e41d4c8f833a9d670dac940ec38a582fc4762194c736276a7abcf3bc6e3385"
+    "d2fbd3246f8fd88bd087fe8930c78f00b08f11e4008614b9ef83c18354161454"
+    "26acce49f55788be91ba34f60697c6f59287cab2d3d1c41b96304b77515d0be0"
+    "f084f930eb1afe2b8632f034542d727f66ef61df01a4acf00e34b810b5c19172"
+    "fd0a87e3a8d44f66fe4c24d6ace83e8d62e9d26bad9b1804edee85f571501cab"
+    "ac597872dcb90a418544b3e9c9f7525e9c9b07e23bdc57a58430c0c80139ebe2"
+    "e6e93ee2c202538d2130cf4bf5d174760abc6ee9a5e58e0e8886a3203b9fdfc4"
+    "4ee71ba1d0be9309ec342300936f95fd48049e9fe9693cc912d77121dfbecfda"
+    "dda068489df6507f2a9dd452aec9dbddd8fd92304227698bd691380ad75b45ec"
+    "d505f411392d757198df243abe36306a79464125e8a54e1910936d317305803c"
+    "3b183c63c0622d26de707491cf4200e868815442dfc24511ccc7a1f9ebe470e0"
+    "082f308700f7ea6c95af83d328be3efb2ca1b164dfa92e4203b1631f85093c6e"
+    "5edf6c36b834832c128f1c706b14d445117a0922011dd23e750e3bcba61461ac"
+    "14197039abfc7f91db091b39977efa9853a9da088a68704e7a2b8c50acf743c7"
+    "e42ef2e4db8ecc0671c41cf754df81f7fea3b51a04f7a993bf193812cac958c6"
+    "cb0b3c6371bd2a1233ab5e642411d24c7837e03ae0cb6159b386bab92e6360dd"
+    "f60f64bd9cd516b9217dbaa05fa2efb8217282470e581392037f7db9283defb2"
+    "5e8b2d046ee9094a7e0e11a9238961f1406dfbb844d68cdb8483acef5cc39c63"
+    "33cbe8e02462c203419f574ba6fd4c730e699d2745d43042f0c8a977803421bb"
+    "7a985580d9a93fe8f3441b87c5e386e949d6587dec98f4ed2a886f652675d479"
+    "b9deb8c358079eafef7cfad9df0d4a7d62c9ec524f2953138b5f46b0cc54ae7a"
+    "125a84be6f498c685bf7bd1ad74941c41a3126bb1f0f465ddfeff642df0ebbdf"
+    "61facdced7ebc02dcfcdf56c5853ed95349ed4073cf4c6fc68885f076b2d6ef2"
+    "5634e0c242ee0df3304ba6d39b97ab71456ddef8bc796ebcf7c03a43e2bc9ba8"
+    "6fdadbc0f9785e0b0435abc7ca557a55e3c517891b732ccf8c62aa1c1f854e00"
+    "a69bb1e2c64206aea1734eb8e14ffcf60501f4533290d8556b826e62f9caae88"
+    "eba808b8b7e3f0951d1b39e9f5313b1ec3193e204533906907a45ebe3d71da96"
+    "fa53deec1ade19c2f5c0beae894a4d7ad23a68014c02c3612ea940c0ac0c428c"
+    "a2cc0fcc54250883424f5b71b255144b2c899f79cf22f17170c7bb6c00671aa0"
+    "787473bb0c058ae8489a621f8a8b422f347c267547a0b3307ee7acafb5ee4257"
+    "a33f632c067c7c93d44361c8e5da5ef157cfbd3d5d12679e7fbddff796fa0626"
+    "97d2a08d4752cc40ffe1b46061f214bda0f9328ad2db9c2a8965b4086690fe47"
+    "4d12209f92c4fc236f210595cd8a11cc144704aff2ca2ad821021b3933a00f21"
+    "3842ff705e899a6b7c702dd5850867f19f9ab631019e51ff8a34abcccf435edc"
+    "09919e6bc7af6f946dd6db51ae5ffe7137ce379ab45b337ac0b984c23adad7c5"
+    "1db33e00d3679124dfe8e9c729e738a83f887f82f44e50f0c9ae40c73998ccde"
+    "9a25015a2afb6e75c776d126af84a39d2f323931def35ca4732947fa97a52786"
+    "e93459c1938780febed1ecaa294ee144422167d9cadb3d59309e718c4a9f44cc"
+    "a881a9bbbfa745a3fc47286a9c00bc0564c67f86ca0f353166f7e4731448f58b"
+    "6a1ef6c798de8b316a38ea63ecab91c62db3500fad469401f3997ff8d0594eae"
+    "f5532b54272ecfed2488032438a91e2b5dec0bfc04c0ee8719964f081c9a5a45"
+    "f586f573cb3c5ff153ef40d42cd936155c1eb22245a312932fb8c204c1cae89b"
+    "157588694536d98173e7ebd48e27b8b45babc3bf24d94aaa151ed6ac70e517bb"
+    "13dbe33a7f3bd9e23f450ee363c373d8f5b0613fd2bc90810e72d92828425975"
+    "05cdf205ad34dec08624020920dbb9c67703c14c5235ee4a15d94bc1f8ea40ed"
+    "33866cb1fdf29c266fb93a1b5a8dc9805d9783601039a7cfa006afb26de4d2be"
+    "6f0f9a6b01fe09761aed5b907a5d95234035a5dceffb4c4545b127f1a4fa32bd"
+    "f6849f3f066e09bb9318e328faad695ff15c950dd91cc197bc8ab283964bce0b"
+    "a49c1d9348c589141378ecb9162df92bbb133ff74eeba2a27b2283b88b4cd793"
+    "51c7d79084b2baaaddc78f6e548f1a8d0ce009aa2c66f38f56496a150b6941d2"
+    "b2ca9f98d9c46bb81b72c7fd6bb36b2fc48158b12652811d81d28bf5b116ad37"
+    "51784b23dcbbabc1a0191099ab538b942f2e25dee5292c6ce9440ef47124825f"
+    "d6ae4ebf350caca97bf12511b8d0d7c5c2e417e2fbdbc84bdb484c57824b755b"
+    "cb0b22435852eb6ad78327a5b3ff862e2ed70c5f6a4ae2ac35a0205839f18510"
+    "bac220e61138c080e65f6c8dc7c4ea517938552034c3cd664aa84e3e52556333"
+    "da07127e0507848d9d96f727105ebfcf641f67d2bdb15c52284dc74505d6e5b0"
+    "851b9ecfdd0492b574d774fd71e91731279262f786186b3b3203030646a2fc68"
+    "45652a5729d4f48c7c94a902016a1b0386e7feaae441b938f3cb4d4645fe2307"
+    "72f6162c84acbf5a7a7777e720c01621d23a85a34c8f12a6343e82954398ac88",
+    /* 2^72 */
+    "4f99d18bb0167e37aae62075d5f8a513a314d83d8a16d134c606ce128678a0f9"
+    "f2e46ed5b0dce11c22f74c440296c312a55d123e272b60c85498863e36e6ec2a"
+    "226f08c954c696a201ac9f45d6c66468e8b60b0381f46631487f94b4cdcfb250"
+    "d23096e116b7ad37165b9483970f8c5ac265f7c66a7ca24abaed587663c9e269"
+    "bd351b3ea2a8c06794540b4db1a875afdedde894b6ddb4d5fb23ddb30721eec2"
+    "c2394cb77eb6dae3df3cd370e19368964d56e65f7e0cf36ea7a776d4d9fe19da"
+    "c7f9d9956e1b4331a6fe39667316165d0c4b00a6068579bdb08436ce48712267"
+    "59b2a88e6e26404e23a41891b8e54186b529ff0423243a9041b28ee7d7325710"
+    "f0fccb9e4fee027ebd4f0eef331e3cafda55f011620ddf4af19153385e4cc239"
+    "091bd2d8f5676df95592524ff4e6b917c78d41f7aead7b23afae531bfcb7f8fc"
+    "ff7060844cc30d1c41d9ca292c755eee769de667e59ead50d480c0929eba1846"
+    "d47ad3fa505894dcb160ca9c9f5e766112321e1c2ee35b862707597dfb1c611d"
+    "d13a3e9a22cc56f8a154ba6e857ae3d124777e4461b4608f11d6f132a4c5a16c"
+    "15943484eb040fa5ff5bef2e4c4a0b41ff903296dc3998d4e1d6999d347ad228"
+    "c87f31d6c047c1a0ab5e8b34c694de05175edfc8e127c3802907eb7f9dd20a4f"
+    "553177b5248641f47abd0d33a89060c4c8fffeffff8d0df6d2675d9347a9e266"
+    "328c529bbad0a1c912361eafe01be8bdc89d5729fa3e4e8bd758365f47418733"
+    "736322d5bd43bb7649eee2d1c899637dba556498cbbe978d7aaa5a217802e62e"
+    "74a440a472c52e3a93fb7c4b90a66c0dfc1d18bafe7fe8e738308987dc255595"
+    "a699e515512e05232dca899c45107e508341bac1142dbd3c775a73d420d1d166"
+    "e91a022da3e6c7e4573c2618e1f23eddcbcfea1cfeb3144215fac9819a3e65c2"
+    "db2bf02ae75b15129d50c2615c008d76dfab946dbf532fc65f6b3645ee813864"
+    "8fdb355c0c78f5d59afebb392087dbff4713d111a03ed361d1ecc95c617c6bdb"
+    "ac8b4db8a1463eae028aece0243bd213d743a88888f6f8e937ec66d84fb70ab0"
+    "0291955c63704d9e6c9d3106413b07a1f65a59d8bfdcc8ebfce67bad991978cb"
+    "2865405f9b1fe2cd33f882cb86612fa6b4a98bacbfc91e6364e6f2881956808d"
+    "57da87d67411bf50fd6a08e48e9976fc9dcc6f91ac7db425e6de605a069add88"
+    "550518bb3a5e6cf6042c4f7ebe88692d559834eb045a13e9190c257d428af0bd"
+    "3b2e7752766d5bc1b4312290c991373c2515126828d0a02c806bb778c2b086be"
+    "3b89829d26661d9f886676588691b27a354273c01ee8f7217cb790a0810f6ea0"
+    "4e1adfdc3481d9f006f09820affdb8b528dc78c045f89e8a9cff2cc15e8a57c8"
+    "3a2c1d312cd5f83acac7dcabd4dfba175ab644a4cfe7be05594b0355e0ce4ab1"
+    "2805611467576d71ee2266bbe6b46cbeba2588c31c00dd646f4c7dd383d42037"
+    "3e1660dd7185683412b6fc6d1b39a680cc70cb7993b7f3055b8980c370883df8"
+    "8275db8944ce9e2d2c3bcb50d7bfb3766df662c635c0a95ba70e6e8435b4425e"
+    "dda3138b82025c7f3fccadeed656bf9756aa22b16f269c22979775ea9e2cc103"
+    "5cc0421fa4a6576c8d6bf9780d13efefe23e133fe390d64b6f09f8748e1964ab"
+    "31880b532d370855982d172907b6624a757f51ab7230068400da5789046b7409"
+    "efb3defeed62e359ca6354721ccf372c26b4dd92bcfec8c4da3bab54d3135436"
+    "4605f2b8e2e750c8f9cdddc4eb9f9725c06a3570825ff141073a624e3c46f63e"
+    "ed3aa181d126127364250d978ee5879586d57996ba3062284d19a7217165af12"
+    "38cac6b0fc796399ef8e2c190db8772fa1cc19ebd0feeafbd7b0cd21f2933646"
+    "d10e993bdd2489b096b4da2b05fba15db5f48ecdeb94f1c2c850f01041023dbe"
+    "f8136d1cb85b0b20578e93b5e5907a450e15bcf20d3cb9b8009ecabb63a6c1e9"
+    "22549eb279d80a0ec7ff1ad9cc54b8f0cb55791424fab2e7b77363e626481159"
+    "d4d125eb096fd4b1ffc5f01833b687f1599b8f6c4709f35240d898a0f06e09b1"
+    "54ff92a50a9cd86926a1092b7174842e9f6dd72d2a790aa56715ba4bd07ad931"
+    "30df226325e0461cce66c9232dc2b0923ffb829eaa9ac79ffb32c1ea40d44014"
+    "42dc18199c776e29891f0b3a05da5c2435b0bc254e62cdd48fc2f4fd0a78752e"
+    "d311c64775957036f1d812a5a8d4623d18d832c80677008667bb44191b59da83"
+    "00c4e8b09fbc32daa71ff485dfca0cfecbbb851dd2a08d902f3fd77b8e9c6cb9"
+    "bf09eab1aaffb778132c12e72e0a6cc900a32a0b823bd0866a8f3d40d8f0ff67"
+    "52ecf0e3290c5bab3850da72873d544ffefd8ae95a4caa1cda43ec8cb90da70c"
+    "6fb214993f92f1dcc47ae081d2e388e778b30718bb9cef8b077ceb3c23ea0bc5"
+    "c009663a758ad8b12654046a7501176512fdac50edb2220e7a2c2b565fb10db9"
+    "242df1c313e73cda4c955e7a3903777a6effcd87d375406199410da33faafdf2"
+    "9fe8accc191f4fe2eda2b67a652e686ab44004e28417bbb0be7cbfc3f5321e63"
+    "c9c63a76206fd7bec44362fccccc37fe0011caf63e5868654110dd0d82da6433"
+    "e0aadfde18f8dd19b9da2a0aa37ec18f0abfe019f6b4526136adc90224e99074"
+    "eacbd706d05d8bf00a7b6589a2a661617cda3ee8d5cae014af2ac33c0db490e2"
+    "21598b31b007ae63f937ebe30780eb0578ce328f4d0dfc51a2e3e4c96c1865e6"
+    "7daf3817a7471890b027012b4d5bdfb362ce9542b5234ae3edab0132018bf3b1"
+    "15e941a4574bfc2fb31ef68376cc3d4dbedb838f1820e8a5b1ffe4d37c766f7d"
+    "d8127be552abc8556b0aa008c58d56d068427d94f59f965d74ec3100f24e8ba7"
+    "968589116109acbf77cb601329bb1572bc0a1aa9842cbf7350482b92c7aa2c2b"
+    "afe07f92f303853a95bae19258bf58b81cfd59ce43b501c486e2168c244f58f2"
+    "470b84ff21967174bf2308965cedd4a3929919fe91c8b4bfcceecf3996cef40f"
+    "bc355ae08201429a83d0be1236d98366399c0eff51ad7b2c773bee398ebdbd0d"
+    "9457a7711e3b3682d100601c1dc1f979c86261c78c710a28dbe57d99567ec11c"
+    "c09bf0397ef06f94a44b72df01902d105cd32bd0e750a3568e56cbf8b5af68c3"
+    "18622a031f0f6524b3d08343d8933006e4bc7ea26e798a99ced35264ecaad15c"
+    "f983deb3e3f3cf841d7d1ba8c507257fa8a5ce812038ab315d42b6dd4895f21c"
+    "fbadf5dd4337eab5e03b74f63b6ae9be96dd3f31e6ae644ad31c80b246b46bda"
+    "c204d865427a9a3e3b00b097cecbb911dfe99f3eb63c7ecc8caf4fa3e124796a"
+    "8381ccb7426cc6935cdf2773f858ecf6614fe896b866a416f3982e91a846adaa"
+    "3ae46b6359dab753585cffe32371a1d9e6a49d6abfb5e84451cb91d1da932a29"
+    "d7e8cbfc464b63301371fad601b9782826563ead784085a25032de649c13f9f0"
+    "e66f2668cd41832b5e945c5b5f324082bc54af0403b43d540ef15a63e1bd6bcc",
+    /* 2^73 */
+    "c50f8156872804b14a5375c6ccc89c8c3e58311fb5ca68230384658eaed125b0"
+    "174dee843e60163534c4bbb001b59d9318abf4260abdc78d0335e2afa8d501ef"
+    "3d616b1be2c70b04d801b48684664e778e05780354762585621e7553c20e5812"
+    "ecfc87fe210c5bdfd7b6bd4f2ef2156d6d484eed7732e127dadf2a3b29555584"
+    "92827cbc8580626ee147e161d3b749b0321a53c052080eacd22765d017cdd509"
+    "e09191b5a5c9e1348f4c3c18400464488b28b33b061ba9c1b73cbf38124334b3"
+    "856977f84f74a5a73932006db92755fa45c7cb9beee119d07d732fc96f18e482"
+    "823f0cfec68586f270dd79c37607eaf30435a628e197bae84f443821980ec2cd"
+    "e8f63044763e278b9d71a5aa99d02a9d7cc68a9601c304137177b4f5d745386a"
+    "c17c3a478fb48bbe141468288befc505efefe4176ec4f3f11975f9bd64fa49db"
+    "9de6d59fcf6fe5d0bfebd4403c323ed858966586934d925f823d859a4d2aa3a6"
+    "3d13d7f3b0cabbb72f64150c840c2b1faeaf3997a421a500bcd88155dc33346b"
+    "515f6ff30f0c085d28c20079a5b5189546cb7973d88bba1cc315877616be3cfc"
+    "8ae08dbd513ffbba06d361ceaa48f71a9fc36c0900aa0b153da9cfea29e4b356"
+    "873270bc9026a4597da078a14c49cf3bd7f433d62b57e4622834bfe315c4ff3b"
+    "faca3cb0f8d6ac25928e36e4340741fadcef7a149ec1ccd18dcc9a6dfa486c9e"
+    "9bb0613f21e210fc1086c103c7680e52f194a8e8f91321f87e4fd5b879e584dc"
+    "a75ca86fe1b8f7dc8f6487dbbb40273bbce8bf67cf30424a79883df8e10e4b3e"
+    "e6798e76b333d953d33cf26fd2bfe2508eb6b423426229741bd853236ec5f12d"
+    "dc843f843c1749449b392817b855402cb92f9d0515d0547b8c085f43ebccd023"
+    "bf53c567b655f34fc8c8cc351853da50d09d29d2ebfb6c3564234731e80fd2bb"
+    "9865b2789b47566242ea8a543c44eb2a8ae4d0b9138e712e85ff68c544d0ac17"
+    "4fb2acaee87822bc60632506936da64bcf1404791aeaaf60bbd60fb7ce5fbff5"
+    "d97470c0c740193092f56b5eeb5e943f9450132876e1722ac4329ab437a180e8"
+    "fa68bae05351b89d62a2ee5d8cb6da33965b1a6f90ca65549ff04bdda42de00f"
+    "5df0cb047ac6009bc521abb604ab0596c0dbc1264b5a1d73e866900131216c03"
+    "2afbb2aca8b0597bf1e7d4c07214edf9402af7ff8fbd92d26f39ba8ddd604de8"
+    "eeb12cfe31ea9e97e36ea429c88f9a7454598cec574d01d8734e4ee330c1ad2e"
+    "8a479141bb68f772861effa4f891bce4f47d07b81fab72012e856f72264e309e"
+    "4a73ccf1686a99d6e13aef5af612d4bea8a6e05239c293c1fb34198f1cba40b7"
+    "b4c4bae7bf4130bbadd22eda0ddbfc88e925b693c331ec60de3829d53d34cf84"
+    "95e06d4e7536e306d27573f42b369286692ad40ecad529017041796463a844ac"
+    "4d147aa0e50d0b53b4761063e8082667aa29c20cb41b8fdfe5020c0a9422a9da"
+    "6336465c76ebfc7e7dd09334f50e35e4948bd3712ec11526ffa11dfe2cb48f90"
+    "88d59d2edeb9167098b67c68e51e0b1c3bc31b1f7566105454bf151302a0938f"
+    "87b9e09cd1f599f29a615ac4de5d72d96ebbd3aa1c70175599796a05afdc8f1f"
+    "70a9796d8cf5f3485223d8235710986e66661b113f8bd3affb9c7e6c074e752b"
+    "4a864e91779ac7cce1b8a2b19a10d7cb1a4fbaf8b72ae274a46002c76424005e"
+    "65a1fc212e93b0cbae76f930c318a4b47e15cd46d19cf66bd6c538fe2b3621ad"
+    "4fdd64cc9f5bf78264309d020fdfa66d2fd4d3e64ad6b881e8e137521ac93c2f"
+    "4542e39abcd8b233a0266cb1fc42cbe03db1c7b64771e500b51fce746d29de29"
+    "0f104497e4355d516241d806fcb6f4b6506f4e5a7131dbb52630baf43425d457"
+    "c88c54249ea21e6eef759d47abc12097f04d3882587ba9a9fa0792cce4626396"
+    "2285f542fb0fc08f168f7dd4861d985d6de817e92ce1c84b56ba03c94764d59a"
+    "c8a38829d740baf5b0fe15b062084e4216576421179861a1567663487cda9058"
+    "b972d01377602bf179f5021ac7a2325b2261631726975d30501234f101a9dfe8"
+    "c13e23a60944fc7246080380ac9f89adf9ade8bc35af36ea6e717ac7f59f6b27"
+    "5e57919a63890ff797ae6c8373ea82df7536feb2ae80a78d887f5e9183cbc9a9"
+    "ecc2260c5b8623ff30522516529566788570ae85f44dca0503513844b8b67aed"
+    "52917acdf7d401cd8d968021dc812e88ea9b992ce5742555a8a98c33ad671299"
+    "c689cb06d1582511aa42fc08f6ed702ec27b918ce613669cb963c073c964bd18"
+    "47fe037513f61a92e582393de5b9c966bad1b4610bfa389cfd69ba0369a52209"
+    "3df4245e58b22fadb83a16308ff2963efddd0ea01d09cf5e02d6855db88ac038"
+    "20e8f01fdf778ede0db81ffca2190209856cf106214156bfda989cec86020654"
+    "e6068f390f9e38ff928261fcc467fb2a28f0ea53ecf5aae1e781ddef062f31a0"
+    "38a79d2a5c44971a190cdea1927ce115968bc32795b26072d510d2e4a78ac9d8"
+    "bf6cb8ad18fe6a6728c9378c062cae58b296688d89f89a0ee89d674d1700b311"
+    "1ae578911c0982e3ce30dd41bb49bf7377d28f8f6242ba6a4af8728468cd5d98"
+    "5be580449f7769b455c0adfc31642e825e02b6fdfb8829bc8d6162703bc4faf6"
+    "32023aca464f1b27e307d411c2a3c0a872a24314464fa2cb972d29c1e404e703"
+    "f7cc411d97689c9a401e7586ba101f17405803f5f13b5daa40fda3c2e2c080de"
+    "608978cfe3d6cb540105a82386fd04b34dcd02bedac9d13f92ee4a6e2aeb6c4f"
+    "7c987147757c060085f83a21324d4f795cbd3cd743fe8804f0bc1b08e209ae3a"
+    "95bb63a5ed2bad08f4ab101edafa6c7fcd8d38ebd42b15edee6306d5beaa8519"
+    "dd9f5dcd6432fa27450f0c036ef9d0e0ebc289d2cae1fe7a4e85e3a4b588b30a"
+    "7453a11af3a5938fe6c62994b7b480b275aa070256abf4dfd7c28ba2af8fab5e"
+    "a044f0c48dddcaa9ed309d7bcbc2b1a7e2deed331a15f18b3f4be377a244a7d9"
+    "11adf82f9f718f5778a656623a810245406b0fc143889be8a215dd11e7c5f7d0"
+    "aee32ff477419d0aef8a5938422dd8832663dc2429b0dc2c9d7390c8f149ae42"
+    "ce69a6bc2935fd473e0c90ef56aa905c59d55056d139efe18755ea22da2156ad"
+    "728b04a59c48d68e8fa41f39ad5c480b2fd7f36a1f8dd17425d5d473ecafacae"
+    "39bcfed723ab622ed9c885cff7bb0ecf6e5fb2c5855c43d480a4d420875b17ff"
+    "53e63361512fe7f78f45741ced72191d2a264936a6196c77259d0cca63897212"
+    "d3639141c8e3c3425cef89b5e0a2310cad41804828e27ab38b5d9d7e3e157b81"
+    "e320cecd2737aef3be78da1e7e18eddd0b25727e34448f95aa0679608eba1fa6"
+    "ece938310078ba4f7d7321ae44e15f26df70422fab1df4917c78cf8f33b769a6"
+    "826ace514d86544dc60be6373c4dd9f2fbe20aee9cc5405a55bf70fce60d833a"
+    "cecea85292b86270bd71c02715c58c7dcce89e896126eda47cd69b929764b888",
+    /* 2^74 */
+    "189dbc5b73364714ee0472a1ff877520fc36c9f7dce4497870458ccd0551f1b6"
+    "d61182739dbd214d5509599048ee8a7f4f32941fcea50f8a55c5caad0a8ac231"
+    "26719a26d17f8ff4a1493502c1ee24fc5f625b4d865d07c02d8ba3a9bc31de77"
+    "0f11c49c702283794cbe4f327a805a6dc2f405163b564a2f81cd9e0bdd1df4dc"
+    "ffb0eea197d855274c12bf2290c612baf8fe7893c7e49aedca81eeb356e4a77e"
+    "f2976797002f19ca2503297b1ddbf216d3f5a67b697c78876b6cbd17303be157"
+    "276a5ba73424b9a026fa10fdb822ead8eb78e8b1e9e05a987d690990202c9073"
+    "c0bdfc5c7c66c5f8448bfb64a407a2a4aca45e8a0c65da54a4d69b8a1401c424"
+    "b0e256291bb1dce7afe13dd189b5ea80bbdedb4bacba56e7a99f608adbdab616"
+    "a9581b6099debd71a09eb9bf3473cdb72e029acb86f83af762439c5fbae88174"
+    "0a80e53bc5b8c1e4d08ae5ca4bcfd88b0c47bbf78e52e7e01dadee1a259a4413"
+    "45ed6f3853dcb8d9e947c2ebaba7e9979979e36b3d5c388445afade65a8aa207"
+    "4a0e22041b2e2c7d24f50f88df1ce5d6caf70cad4cf986759a79ab3444031097"
+    "cf2f864823ab1a98184a06ae94b08aa0d5cc33489bdebc831fe6c1411589dbc0"
+    "0f415e5efc3f3a84b9f4af526deafda4005fabf33a9781090d9174a80fb2fa58"
+    "22bc889a3031fa584dffd790bca6aa29d3662dba9155aeafbb5c9a1671e2692c"
+    "a0663cf7439118881d47d6645d94d7876a7ce367a81196de408b22f6dfbbc949"
+    "8078e77c7d5262c8282db7e60dfa4d572812c3f282de229978b65a2691a72969"
+    "e69b12484f808c0b68157064d3f98fbd6c871fd67293c3deabc85fe8a6ddff8e"
+    "af62c6d6f83df5471b3b7e1a50b931f6765f95264496f97fefb6bdb45b6b7168"
+    "f0242ea74b519cd369f3803951a222a7e98656011a53b4a32cf579d55a629504"
+    "cc19f35be0311ceb443c7d020516bb13d35ddaec0213dd2550885aee815c2bcc"
+    "b6b81f7b4725cee85be24fe37470fe8338635f33f048db97464151380d4c1ae8"
+    "6c461261f6d80c1bd78804635dd85705b6788322fbec57adcb5f1930d6572ebe"
+    "38dc1e27ff3343149c3a23c30d1390281126071acd6b91a4be689f18e17f5d86"
+    "65b214b6d755ad90f03ed5c74038fdfc3d4e1ea9196d2b24f07a4933662cb1a5"
+    "b1d2fe5b05cb3eb241cd7f61b1a29aedcd6e260469d0116a47ef180348438511"
+    "0d681640aeb1514fbb0f777c03999f7747016c86a53545b2287efbd455dd0e9b"
+    "bbfbb7115def278216a7773314adb57195379c8fe72090bdadb291a336d4f875"
+    "a1a611786aa1c76c73cdf76f717c530fc1130c59e39ee1bf75ff2d87055f1898"
+    "ceff46e59987f8c78e270c15f76b23a7b7323f0d470320d4d9a65ae92965c96a"
+    "e60e14665ac2993ecdee6951c48c89fe269c3c472bb62e0424b5e2fe7490e4a5"
+    "96e94e22a74f430677853a11fd27d20cad141f4990d9d47fa322dc83b8a1e82e"
+    "869b1e4ff28dd751fe3b2cb6301425aecc5de132eabf2d9ea0dbd0daa3b06e32"
+    "cc4a5b9ce0c88c695927e551e2f179e8a500e58a81887efd7bbbb33a5700a279"
+    "b27f8f47f77efb82a5035ca5be90c61c27a372c662a8cfe1e3ffdd8d0bb48d47"
+    "21e841dcc994ec2dd5c491af66c092fb4378188407201ac06e368c7412450c08"
+    "6028aaac57789acc5d8faa5a1d32b6192c3f2009765047a266ca5330d0dcd07a"
+    "cdca3c8b25e04c552667ec2c6b9193376b8dcf67f5f8db1fc39183926d34940e"
+    "f81db3fc3c10b5a7a4a6aa4ad089bd5d6ff9202e953beb691dd7714c72be3de6"
+    "a85a02efed6df0623a0671110a34594dd1d68254b96254fb88cc30d16e88f522"
+    "849bea6daafefacbb0c576c6639026ef1b9af01c576f07e7a69c1bee7c2742a5"
+    "99deebda0ca26b0bbc428625d9f3821d6bf86c7d216382317984ed44409b39b6"
+    "58479350dd1daa1f6d6ae8a81bdf2745f71c4f43204197f3b8b2bf07a75e6585"
+    "44c93e96e337539a564a3e411ab9741f18ae194c05af3dbc0fcf6610d4a02485"
+    "71765d97649f38a27f1fbd6b541b507c6863b525ab09b61b30aae1d1e2b1ff36"
+    "3bf180e4e5700e8971e3dc15c87b97eb9bbb96691ac18b60af990e794d949260"
+    "4a01354048aaadc352425ddf347b5afd68bb2bf8c630449631f594bd1a95a150"
+    "5606fd2739202df6383dcce82132f52ba881aefe7f82b0b3d79f09fffcd85342"
+    "0ffc3a71dee119dbc3c235ca57731b7bf4a95d56156afce2305b408ea40cc5cd"
+    "b65dd638541db981bcfe9d41360359c9cdfd02920d73b7e9cde62d9928a70795"
+    "b763cbf1c2eebdd2161124ff5568ff7bd8c8887b7901b89e3f1f99dc0b749659"
+    "69de0be2fdf6100fcc357d9e335c57aabad0186a4a0637a7f94613c16e151a03"
+    "6a2478650900f1eb8476d16768148b7d35e43252855f0a7dca643b58584521f6"
+    "b5e3e4e340089dab98d8131dd32d18861a2864a4fdc768889ad932d4c3a400d4"
+    "ed54f4f97b45a1390ee470f0c706a59a3763c0ca127b905fa75840bdf17fa087"
+    "560a5e1abe96755eba3bf4ffcefa62f8000cfff4e38fe138e7a30d2098da6dc3"
+    "e80d9a0fc852a9dd5e8fd6849810001280ed1205761958b506f37d0c25d5a941"
+    "51d658cfede4dceb51f8e42aadeacab27572b64ca7bb34ee97643ac09c7f8c4c"
+    "7f88c8ef11f82a03a702f8f87f96f8d98700d3546b5c94d656637d37596d5976"
+    "9df42b8f4b50eecc5e9303c22f11f9b06058dae5825fba4f3da20a6f0a8f36cd"
+    "fa3343cf14d8ec5e58c1438d57cf7125982df5997d93b9791175da9da50809f7"
+    "dc81b6bd90d3c1a92867ec7433b39dc435816a63b06030f27f09fad674d0a8fc"
+    "71cdba90d845ad9fbfc9fbfc5d7019fb7f5bec6c97557fa3a3f663326434dd57"
+    "5998150c3e460ec106d92254d9203d39c318b82daa93b8d380a37eb31cbec4b4"
+    "4d1a9af0be315c6e5cddcb73a71ac7fbe4dfaf893e1e489f323e493ed2c382bc"
+    "9f9263bad5edff50d5bf798752634b62526b144c1a97bad1ef4f616583c730f3"
+    "5babe38eeec7dd3623004a6fbbdcf9092c9bc0fb1fa5d44d8aca0259a6d07dc4"
+    "a89cdc7cbe68ecb4fcd59ef2c29c2d3528d17203116043fcd327b45c070c10f3"
+    "3b990e64e538cfb7c50ce3c822e479f4ab08382ee0b079b96da79c211380f144"
+    "dda7ef0cbdfb7d2767b6f862b9db5be1d33910a6312ae40f2937aea0ca11fa86"
+    "3c4bf89fb1af5a1ab985014cff2a051b33e71b66625f1a9b5bed5d51e3593a5f"
+    "f2cc11ea7d7d45b6a53db886678cff0c1f37cff8797b0d08036c9e613c38bc66"
+    "66eb165df76ff862ddb6f2b0ea5b678fa30aa794c27e322f321fb896aaf16d8b"
+    "94a45e336d3b70aaa1f54be11fd5130a534c008110e2abf05342fc893d506ece"
+    "06159d8d3d929b482fe002a6154fce7aab8852c39cbbf4ecf9e883de6466077e"
+    "43442da4b237e9995949ab9d99b4460ce709a7f8e122c0d7bd0cb4fbcdf64f5d"
+    "2870c083d07580605f16e400a9d976f8ffec5ecba87d0799dd7f8a71b4ae3dde",
+    /* 2^75 */
+    "32d81e1803e9a20ab68e5d8efca074e3390fa8327be13572cff536f90d2153b2"
+    "8d722545dce634528f9935f541dd026ec931e0cc2a7ee5d172efa5ced0a3b89c"
+    "4d3fb8cebe4425eca26c9f12c23f919705bf8d38db26e77e0ea3a2e2f8d6f96e"
+    "b4130469d4fe68031c51910cf58d46c76d58adedee34e9d91452cc9739993f3c"
+    "016d7d2ea80e0ad1ee35c50edf0991c14b1761a81e321313b7de231ca6a4c3b4"
+    "5206419aa0105f8d3bd58550b04b50e3cf2513f868e3bad8ceadd66059a038c1"
+    "7a0787f5ac7a95129cac9da884efcd9fbbd4f271ac848b894451728b692544bb"
+    "d4ddf8cfe0a30bc41cf90e18ce87cdd69c48cb31bd7ed27710a16a38959adcde"
+    "f97df104a2d5efe971c302dae3aa93962fa5a4e2714a653d058e7447c66d7eee"
+    "bbd509c4d7f8f1e6e5dd365591de0cf04dfb43ad2f4a948cd3647e6c7fd38f72"
+    "01bd9f2b5f0feff4f3d4d25fa1efd7145bb3adfee16c3ecde7c3b0ebb9c8b21d"
+    "8bc4e53b3722f6f931e1729cf6ebf9c9a7d1dfd959ba68eb3a4a33e49d97f58f"
+    "05b4b0f3993ee5ef1478b3862854220e7a957d22b58a9874612dc24c4426b4c6"
+    "23ad54dd45a391999e24b4bc437c1bbe422f79240978980c7899cdbb3ee6d190"
+    "1529a025a232024d35f58e5414622dd3d4bca8af724abd10c0d79e9989011702"
+    "f96fd8fa9768b85840b53c8e2fbcd35c1316cc8f94ba5080ffc3971524e64a48"
+    "aa0fe4b166c55afb117c35e136947c621502e51b6a931534320c9979d1295f35"
+    "c6a3d18441bc87ace8758c2214fb83d4bd083ad6447f0989325d05bccb044ed1"
+    "e65985aa06b67c13ba0ef2e703b58aecc64f146fc4755f32c431d45e090b98d6"
+    "7d7aabf1bf38ec7d3f68c54ddd5791cdd9199b31b0e1d56a7b56ca39e4af7db3"
+    "68c66dfc22952cce8dabcf7bcd4e826c7de1e451b42a6bc18ff087a65f879ea6"
+    "043ca8dcb2994bed663dda3d28926e22725df3f0d61099967ea8dbfa77eb2c65"
+    "ada0a49c87aeb9f757cdcbc4ce47cbb842e88a26fd401eedf321c5ca20ac0b28"
+    "354a8ec69eba20850cc363d871b6b8af0d19d6cae4bcd83a4982559fb8bc53e2"
+    "52dd70f7cfe58b1fe49d9ffdd30295c8beaad995ef5928d61bfab48a6d382e55"
+    "0de13aa98383f3a194e20736ab1717d6ed16206d90a76f01a87bd6f711fa7e48"
+    "476e69b4bead1006dcc4bd6fccf0e38fdbaaa001f69b5ef4cc6a312fd29e0116"
+    "45a4beecd667ec6345eb98d912dfadf83c07b0785ac3e05f6f1f319902133c5a"
+    "5d5cef8544d0af4ad85364d84596a2e12055619b4c4fb5fe832807f3492b787f"
+    "e7ebdcf2973c2eb69f50da929afa096544eab7da9545e83b63c635ca11a3891a"
+    "a39a72135a2a1ebeb15c13e35ce6a543448eaf551dcc4d29d54a821c2f7c8041"
+    "d138dd721c74d1addb5966732f258b3c0e2ea3ec299e98be8512c6376ef3fdd6"
+    "8e9d6f9533483eb01a6ca54fafb387f5642728f42558478495de6a3752cafda1"
+    "91391ed5a09b8b456072c6b9f86073dd2bf14b40380842de1f884016633f28f8"
+    "32f74ee4a8c4a97f99ada80562daa3b627adf4a793b5d63d55205c3a124b3d43"
+    "13185d71e67a9f985328b7f3d81680e452b2aae44792125b527913fada683223"
+    "341211b126e625db9563dc505ec6a124317d1fda21d328b123731778fd7b417b"
+    "c4d7b3fd93a517ebee316086d4cd8dd2684676679c9dab15b777b177b11da564"
+    "8b84f899ffb4218f05ffbd901b8b79c55013dee9897719037f200cd6d63c4e3d"
+    "efdc2f610a765fce1d2704649999cdabe20cb38d957b9a25ebd70974209f0f6e"
+    "5d06501fcdcb796fadfc0ffc6e2c33e955516d28b654f883027bc8121ef7dbd6"
+    "72334fa49018b499a6eef00b38e6e1a8fff63c86c43a4db04b792eab4be8d717"
+    "f2fc92a14d305e965c5e77c67f435630b61abd6f10c539d7e4452696efa6cdbc"
+    "5dc54f6ef7af436e8bf7edb3c5199f0eb0663067b5e6c1f302ebe8bdc35f991e"
+    "bf450782e269ef86ac896e2bd1cf0573c0a261cd4bce2b0147a6f72b7623ae87"
+    "d823ca76d7d78ce0e2d3295a67789329e84837567a25ccd3c15d8e6ebf7f5359"
+    "c2a8d832caf26c93572c17410d44ec516d82df8b7d0a70f868827213caaedc70"
+    "8c57227e6154a1080c57dc35ec6b088b6eaa16465f75af06a221935c7a35088e"
+    "44cde47d82af0d5af8b0ce76ce3e6c4a15c5120c8da98aedab536f730a4d0e6a"
+    "34a2714dd4f2e6b8238f5075125b083b51debc2b6597f48b95137a38f6680cac"
+    "911832333e91f7bad6701c9bd5147acad3fc37d959db94021453337d12bb1c76"
+    "e6174b66d216eb7d2f3bf859fa97c8290c6335950d0b873327eb67b1c2eb10b5"
+    "f943d3697eac28192c3d665dbb27aa1da5de629424cea5f67466d5868b3944df"
+    "d45f71ce966805af0765664d744805b2f12e550323e632556e541cf4cc9fbdb6"
+    "ab8e6672d176db9538588b01201d6a7f0eb6720b9b0134ec2ea984406788756c"
+    "c4c0fe901b8dd6edd5d05e5f8182832c117047b8f02d1509e2203b738c697a04"
+    "8b8bafeef4b882c984a9d19b60c27ece34a710ba6aecc2d97e04280cf01a36bb"
+    "fd51e74cad2ea9f3c8f744f52ca20bb9f0dda100f20c0fa6793c041f5ee1bb73"
+    "533918e86e27124eb45dca38789947f02a176030312ff5b0f2b7902356a89f35"
+    "1121072ccf31aea31b7fe1b7f80545efe4e397fd70a8366e257953409fe40401"
+    "05f3c40ba3006fa71c47705ef3af3c1373fc3a9655896b140641665e27a58268"
+    "8ac8a57a37de56789e8c947a8c47701a9594cd33221b461d404fc9ea370c5fe5"
+    "b6393728a06e579e1c3fe4cfc06357dea8d6e0502e441fc6a9005110ffe149b4"
+    "fcc4542dde0b3dee5b5a28711ba021e8ebd5836766e7769e3bf837f4a1cfb125"
+    "c3624da348915e4cdc4497315b6caae6bcb981d81b74744393765d13bc7c5aff"
+    "fa2c91c58e6711129e5fb8420ce9cf47e024dee6769061d5e3fb6b1555922281"
+    "d273e6a6fd5ea5a47727a8f8425f028768b870af92169ad8789a2eaa16d7dd90"
+    "ca5d99286b4913b21842c838ac7efbf8c2dcdc6d3074cce3f35313aba137ffcc"
+    "8212952e2279293ee57397f10682c424e9a4722ce9221cba1533acb5c9e1435d"
+    "4670b0e2ef513f1cb1065ecc8bee55d90afe335f6fb0ece34de0585751b96693"
+    "f1c3352e11074211e10c0e6a0f4100aef601b11f264637c86fc3b9e73f54fe50"
+    "2198eb869b86f5f86bea3646f5fa66b3f3064b1da366428886945710df54a1ec"
+    "4f4aef541ad23f091ec3e22b08929be195788863d0428a4e338c326133f57786"
+    "b18827cb40f8cb6ebcfa632c1949ea53b93bfaee98894c6f37445060d67c6855"
+    "708c0a15e46e26a6aa83a697ae738b0cf771efcca423356ecedf1a9de037a889"
+    "9e62291603f13aae6380b3a850fb5475268d827e3f7af012f0778514b85c27a8"
+    "c117004feef24b9924c4d6b723a1a9b833b4582a5f66dc79dfa60dc9ea4e6dbe"
+    "6dcde2a31b45c454fe48960a3ec3fe639af943505b48f7008f01262303e24707",
+    /* 2^76 */
+    "48d0d1c51d5918ae10abcecdb5062a70ea544e86ec0ea88ae68583b63da52a66"
+    "8d77661122696fe7c852671cedca62c7faeaeea1c0bc8cdcfeef247d766e1490"
+    "bb560f96b67e746ee5cd10ab0130335751012c7ba5f934cc28f825a0133f0c60"
+    "8f244e1686a4b91e764037f7efd2d1dbba05c720df1d39e5f89e302caffe7476"
+    "5029f70b058230bb5930574528c969ed5c70be28472eb9ba0dfbae55ab2c9a1a"
+    "5e6d79b32806e633fda203a65a3816b5181c906a7f8a6a01e5029b37f2013936"
+    "f9359e0a7d5567448e2e04c6fa6f14c38c7e4efcd4c6cfd3fc449731a0297505"
+    "1a4c224bcc46e734f46242c8eb5f758e26844fee6f8e84b1bc3167bda57dfc8d"
+    "a732ea4dfcd3d405ef9c6666a72a0d7241e56fc4cb5feb3954514663f5351cff"
+    "a40b8e357d74431cbed9c292bc8094ad559d155541fee1ca7c5685d764fec0e0"
+    "1a402879018bef243a932d02c879da8dcb28253529a734bf176f348aef7b6a42"
+    "74c0204d901d3ab7b3b2356395982ac1c6bd3461550dbc5fa9c7a72106a78c77"
+    "e99fdcc5b045f6bddc3f1dd6a34ef1acabbcf9b5255feb19fa1f85072ce11f1e"
+    "c893a488ebb4c20a8c45629ccf7011a5d168a5e471286caff94842ab58132487"
+    "9e2e034bc33968a8e332216ccb6584c3d0cf02c6f2333c3fc50173cdb0950aa2"
+    "6bc952ba5f048ab7f4ce4a513afd0c319a8a9a27e7e95c4975e38ee47cf223bb"
+    "1758a16ceff2044cadc7cf0d28a8f04775d93e0be69aaac32db7f135d4fb5c1d"
+    "080fd45164aa59842b5794ea4ea3428529f20e37046e6e86026945e247555c13"
+    "4fd34620a62ecb9ba938c61dc0133687e750d5c4d6c4c4b846ea41b823b7f423"
+    "1b0f88c9ab004f0cb8de8eca069f0799a08f0af0a52ad8f328cfb03fe33cc384"
+    "e6638410e664a5fef197eea0a6319b9cb05daea9ab50b1dd7c26ee3578f09940"
+    "eca7c95679ec7b7b3b649c0afeb20c040cb0356e22be124614b0793884bd2eee"
+    "9da49cf6b7c1081d4e46790609d878f843dad183c67f48e597ee6aea0e78baa5"
+    "ac226a1ba86169980f6d89e724d4870f340d0a466faa1c7aba2cbf57f0069d66"
+    "19ad349203cad722c81a84138f8c06461b0262131a43e2462ad6e89d0f7e638f"
+    "5b66c8a7776cecb8119ceab97b9d7902496b463f417126ff2cd504facc506bb5"
+    "bf9e735099462707460234827e8a964ae1a90d3e547a74a87fabf3eb028c1508"
+    "ff5f770ea1f5eb664d20768d29107dba19cedab8f8060435209c46e057b4b34b"
+    "4d610e37894ea47e40d319878e5d8e705ba54adeeb73e8850b8962c2baf3b4b9"
+    "37312053e1caa021c22e0e297fcb3d0c437920466a69d107f5db49be7503413b"
+    "10d73f0d9772245ebb2df489a8bf39e1245c7add28ab5a43eab61f4eab3cac76"
+    "071c52695eead8b98595e16fe439900d6a2a57d41466f12ab0f7d29d46306fb1"
+    "7fc366b418fa3bbec745678f42dc3905aa99283063ffc0d7052b340933734863"
+    "9406f80e138315c40f09f4b69e806e6cc3fffbd8c858069d7cb70ac622802ca0"
+    "639a0b08efbeadccee6ca42229b7407e1d8f09864b65c9bd10630adb1c8c37ac"
+    "d87bfd900756f9b81ca449be718e594d849d137f52f15c42894a86b8d9e21e7d"
+    "4ae36516d2060f5400f79038ef70020cc43c0b65e46a8fecb9d833b80bd3c958"
+    "5f889e1e75030fbb9b186783406ef01aa3a724343100cc4486aedeaa2e80e717"
+    "5e53746d9238555a2967309256f7d125e5d43cc102b5aaae11a711d94a18aed8"
+    "7e8b1f37e8d92d0991034d94f9a4ec32ace705696716daaa88767ff2c8ac2ef9"
+    "9b0de51bf1b3fc72dd952ead91cb5986120bfe9e4d865763af7ff3de5817691a"
+    "7e6664369f14787916a0851c521ab97002bd07465ef2ccaf5752d2d05d2131c6"
+    "c8b3886a55f8f85ff226933b1c76fd28dd78f0ea0d5855a9bad95851d4b80c5d"
+    "115496acc7566356562bb2ada1e663e2bd628dae087fe620c28ad6be9fc57743"
+    "c6c6f803d3f475fddf51a61786f6d7eb5dc6f9b076c231bf1a33d4c7b035885c"
+    "d8db8a52c25cee783b68e3390dc70c9f05772cc44ae22d21bd5089a27bad9585"
+    "4b91d4090e6032959e6dc72a0ab235b9a4eb66e5ebd96f43e9a10112b04a1361"
+    "17cd98bf1636528f4221fa556253a45f67319cdd605f0dddfd8f4fdeb7b95310"
+    "4bdabeb0a20a6c8664b2ccff898a9e3a7f402ec9170ad77829c796247f0af1e8"
+    "ed05e0ebed0477c00c9be757d8de6afe7b7484bd402b84cb0a54ba91d0a823ad"
+    "00dc551f906bf0205f2a203c6712d81e168304f6b71793902e71ccbb220327f9"
+    "bf7d39d43c3f7f4dbfb1a6184389d432bb5590d532f4255c663069cf7595d006"
+    "dc07d9d031839bce9edb3727308d75ff7f46d74d694f3bcf3a712c0d0d680a98"
+    "204c71acd4f1147573a3b22207d47299345ab868a3ac7604e9f545182e8beec2"
+    "0f1ef899a355adf91e9fc1eec85c6f06b6d0300488c6f0016305550ac11adbaa"
+    "3b58e603a21282076b22da6f5dadc89dfc8e11dd5f802b92aa218d71e76d1ec6"
+    "4506a18a1f9a9ceef654e71dd460961384e494341ebefcf6f69634271dd7f83c"
+    "b3fa9b746744381fe389e8cd4ca0ed7345726fab571e49b211b6bfb86b104cc5"
+    "e2c2ee15b529ec433b7dff1a18fd57071eac886a4f5ee0a5e94b13d23f39fb2b"
+    "61a2a32605b5244440104235e954c884c2e84b1206a6c661253118feb6ebdfc9"
+    "84ebc4f78d4d41c9d02c522165f372c72f87194a070461334426673c3cfb7ecf"
+    "60b1bed47281fd9c5203275cb184453d893f3df2269c7863e3f214a938dbfeb7"
+    "0314f664b6a7fa0a4cab59e57b285ffe81d2cd28b53a37c631bf6c1952f87609"
+    "24d08483c7e269303211abee32dc68ac791555addaaf1065f2c93c0c628d9212"
+    "2259c81fc92747a381233d41fdb5bd7c49f265d36abef8e32e89d0e4541d4259"
+    "3a75aeb837dca59cd74fe01c18edec3794bd309822b1cde2756499dc443151ab"
+    "2aecdba0dad8a7ef90768d0c7fb28e7c25251a72bc60273e3f1a08ac6551053f"
+    "5a4099c0de74d3a6512e969bcc34ce18801fced4240f3edd8e95e165c5c5666b"
+    "0efcd91035109266dbdef7723c9b24322fd1916a548cbbf2aa78c0021186d82b"
+    "7d6db2b2688c05ca8a1b4710049468919c7af4652b6ece26eea384d43b6af480"
+    "8f60971d16c0ddf8eb499557bb4922df91e5112c3ebd5685c603e4b8f8d7bcca"
+    "7344cfb878546d00e75cd0997d68a805bb145007f18d42a5adbb66a873410821"
+    "fdf7fd2961fe45a6bb8ab0aedc4a750881f4bb5c81fc79d4b22595aa7054de9a"
+    "45eb38c111394e64637f1f808b2b9bf51e0d06dd8dfb9f559cd2a3d17d10d41d"
+    "62244900caab01e8ff52d8079263a4704ae89ae6c4eb0a8a15094645db025c79"
+    "4990d00210d368ad4d3737e5aa90c0fc88e8e484d3d053fde0bc7c6ad4235432"
+    "f1afd7c636f5644581c11a35bf5a5e848aa14c89efb3e7a9a9c2ac41e311f4e9"
+    "dac1f0882642046d57e58fbf556c2b6c9a43b326278dc4876c560cc075037c74",
+    /* 2^77 */
+    "9628519c6f560cd2980c072f3172bf6e81ecf8dc71dfcfb938eae2ec0c53cb65"
+    "b0b3daa0324c1b456f1809da90ddd00fc0e7152c63459abcc894f38593267314"
+    "a89df41e866c0a503547b5a1a359fef399530b7f195ccbbd3799aab21aab33d9"
+    "edaa41797b702ad8542c8014a18cd4cbe3fcd8e63b3bd4de8232de866b3bafc2"
+    "ad35bb778289f0953c6f99cc11660af3187a613a71ab0cf1fdeba6ddf040cb8d"
+    "bb482637df23771d51fb20c6b57a8ee39df19e10b22aec85b0808abec1969f80"
+    "20111b68a5837253102b5768da7be3d315aa7ba9fe02c12905de7cfb56d9e2c1"
+    "6327e2cb618c8edd92cd4818c06e0dbb5c4f318961c6a2c2dc3433d0633c0b90"
+    "7286265267e91ca26533d529c7d36e751ded2c9773972f9f97d49ceacff14977"
+    "d1c59dabbef9bd130e44789bab307e95ab79105efe8148f86b5794a6ac483bb2"
+    "2423c0f3fd870204d6f83f257a76186ca8c1e341d8bb79a405017f6ef9e708f5"
+    "11febf84dd3da6760bde4958044f103f025cdd4220a71cf0e38bbc0a6198200c"
+    "07b486f0c7df59fc62581a48d40cf6e384ae68d3fd2a1427379f066539c9417c"
+    "c25994a6fd1dd18121be320f481b4f050595059a8ee25d2fcb3ef278cbc74ef8"
+    "7e4e62a1730bda01080ff56c440edb3ae838f9a8fe00cf861cf54c41ae1c7b8f"
+    "76e804a77f8a70a35e8e5b2b5214c184678a725ccef06dda6a84fcddff6cf214"
+    "5f34224a8db643971cea5fa927334dfb8ccac821fb21e03f6db050dc3bbe6801"
+    "ae2d488cc3767c59a97271a704119859726d8ee7a51afd6a64a29d5e4518415e"
+    "238fe3723d6aec18f833867594f76927ce0242252abbc0d553492adb714ed1d4"
+    "2eb1bcf8ce4102ac908c1f6684163a16bee6de9931cd2d6e0be231201074dc40"
+    "3b1f22d2e074b73749c874585a9e9da3103d3b2c6ecd4e6490bacc2967df9655"
+    "346ac5f19829c4153121c231b41e08baddaa989922534b57cf303bd8c0c3225b"
+    "ec1891a6fa1fbceeadd0a063f6ebc0ad21ee0075f2ddf8eac909135b597709ce"
+    "10e6fc9eee8c71f3f20407772c069439222c6e76bb7da89fa5d36f56dc46bf59"
+    "5b0448bc7554b58ba20274483355eafd35f4c0dc77b8f95c3f76703ae8f55dda"
+    "20974feb45c6191ec41dc32b1dc9ca21334f0f51a3f5043427ebbf08d9afa7e9"
+    "34b65351555b6eef002cac488ff6f6afd44ebb68e47e579d7c17f89e4e605363"
+    "c8446be8e60c1b992e1f2c87d68ff2ed2206d13d32e3280ea2aec47f6b117a54"
+    "7d22b5ba26feff2cc33ba9e95f12549ee80ce2b93c4a6ca88b15b384771d0d4c"
+    "d251075542f67e4b6d91bf550ee9149187d1b0f6e893cb84f6797fb7feb59fb8"
+    "de45acad8e4d4428f654fc9f2e9b25661768282b4e4d1a35c06389ee35a64de2"
+    "f74dc78ecb076797dd1e72b41a5dc8005823a7b6fc761e05cec85ee7e6770702"
+    "653647b921b215c7fae35839a5edb08d4fefbff1ea094fa1dd936ff9f2c58561"
+    "864cab33a13a79f0c056e12df16462b9920f499b6f916f0a476467ccedc65013"
+    "ad515bc2ec0ae294f11a4ffec95dd311e4c46745d3d55f295f2782238a8039a2"
+    "b7b7bc85e31cdf51f6e9749a05143b794140ade014497401313d7b8098b3f22e"
+    "d0d11fd032a3e79fc9885dcd4495eec5afcb8a9c0449f136ffa9f32f7ebf715e"
+    "422c548c155600688e65a13bda11ffaa177b32eb34d845bc631711a6fde8d87e"
+    "04caae64da214c2f9c1a630cde1578ef95aedc07892221d466a12cdd4f5caa8a"
+    "b112e82cc73bfb47327eb6975c39618e838674dc0efdcf869be8116b4cfbea6d"
+    "ca2858210bcd36e996eb0e0baff270d5a087ac643c8991563b04b8feb4fb775c"
+    "8c7603cd5b9a5b6112d7ff7731c13077dbd2b5bd15f7dc5a5dce7e66e2a59c9c"
+    "24a8240a1c732adcd455f3043027985116cb4401ed13f0c593a1338590d70e17"
+    "500109340c20700391ed8738f8befb603413674d9c61c787ccbbbd76d446b4af"
+    "654569380c2052ec0203d13efa4349228ef75e56ef070778b3db4d395c184aed"
+    "868c744684c2aa1a37f62dd5b10f7ce8323b442815d07290d1281e33f90487d1"
+    "3f810a7c5416957ea90a32af2baf23a5417f48a94c681070d2bc5a17be6c89b5"
+    "476695991242716004a7e7154a91795ab9dd7bf18a84fa1f9fddb906e4007fb4"
+    "01cb4cb59d8a48140d3cb6c77c23ca4eacdb9f5f12d422cf023ab1aa1294bc11"
+    "ac5b925c2f7bbb25d7b4944c3c3f647fac909a789c4243cd124c82a06f94eedb"
+    "59807f3b4c5d5af14133c22fc763e0102f3c4de1da5ae27e47bc711e5c13e9ad"
+    "83f1558e79285ea0c14aeea2c79593bb35c39890529eda450df48dd795f5325a"
+    "6262f18b7b47fdf80e6dbca054cbe7f7ac8ed6ff0f565a5356f0587c6cb1daf6"
+    "cb5f33e07f954ebfa6ba2800fe02f7c1519b5758b68e396e5f48438a758ed74e"
+    "d1c1425b8ff2cbe95e55abc36bd6cca3f0ec6938e4eabcb8c7075492e85330b0"
+    "8abcabebbbbd7d4f647dd2ffb570aa8d249e72c55cdb9034e6b8ae806d559b64"
+    "38c42bc6426423d3aa15d8ddfd733aebbf6706fb43926903179baea82a701dff"
+    "d9ebaae708fbd18d3a7365cda66a9f9b78b620fbc00990815d09b950cfcd5a9f"
+    "42d5bacb1e2d1feb0b55f9d5462d181153afa3f55b3c692436602c9c27610e5d"
+    "bc2ee437248f671e8c811293bc9637bf9a10cf4824aff9f4d5c5190699403fd3"
+    "a1d858dc95d887cc48e1fb38287b60b1b1d2ad9dfae005b2d7b0c66a44c883d0"
+    "1a8ae89fbdb88c5eec54946dec3d5a155e33319f90506e6c5e651ee4075d27c9"
+    "ff9efaf0c7792ab1c006189a444b1b051fa2d689d78cf972339257d2192c472e"
+    "657fb2b28ec0e817d9981de50c83d242c147045adc96abb5e192fbcc424d483d"
+    "c2aedd2906d033682ce8219402fb476ee8a772370ad4351e76f2b6d9362e755f"
+    "de515574ea3c4fc117c7a6f9f7903d80b40fc609c0a3461c98c9b465b6b4a6da"
+    "ca909f15018c772bdcda466f42b6a77a24e8b42deefacba014d6fa2873676e07"
+    "982dff1bb748ad5df99fb96d5bb94610c3b56c15d1a95fd667cf6f23b3e92e7b"
+    "ae89761dd583fa5da3353d2010ffb69e30e38366adefa3da175204ff169d8f90"
+    "1a1fd605acdd3633e5a84bb6f7dba02e02f645b7a0cefb7f11015f70a281eabc"
+    "4dcf45df8c223b8a7326cb7e616cc0f7fd076e73208e138019a11c5e77a0a93d"
+    "c162d454886d4cdc5730da84a473805689c99730b5a1557647a9680386fb2bec"
+    "da60c9c68de054548e60aaa6cccb32e3bbd7e328d8fced91f135771da4251481"
+    "80a93ceb2d87a363dc07043bee1834f32e0d4f841d46379fd5ac98d2e48ea9c7"
+    "64322aa484ebf62524473e194bdde1c1cbb6057c7f16442582dda42a13f6d0c2"
+    "266e76513db7dfbea69a87cb9e021bed9ab1eeec8755a7a0b2c70c8abee98c6a"
+    "4e37c701e0284015a6bbc94f82b56c1c13540d3e9d632e9fcc7cf846e357fe2a"
+    "60f278c2c03d1a7f545ea38127aaa16d2964f4d017353a04ddd7ac25143995db",
+    /* 2^78 */
+    "ba147da7f44d958e6743087eacea91be8ce1695d1743c96546603bbac92af6f3"
+    "71c45dd85a872d67adf164e47ec0fa42ef5cec0191f0fcafdcde554e0f9be525"
+    "be1728234d572658b76c871241d937ceca8ecd37bce4195b6b7fd574ff078351"
+    "dfd5886b4883097d3a0e6f884286690ced46ccd2a836d18894506b4c062b10a3"
+    "8f1a2fbb54c84b7ff0b99fa9dfb60c6c3ee9993bcac4232247f9976772369de5"
+    "902e17ce715464ac890a1bc5a85ebb272d341a5b944075aa7249282d3149c6f8"
+    "459e1a2c1a01664bd5e0b15b913f612a2a1dd1de4bc795efa1030886987d4276"
+    "d7631f2452854e4845e928db110a658f2b17a79e49700fdf5afc0c4fb1de73bd"
+    "b24ad4952507cf505882d431b76de379528dea44267bec32debc6805d5adfee6"
+    "e5e9a6109eb40bf4c3ab3b2d992c6a1423c60e2a118c3e0da1a125b9e7328500"
+    "705d0619dee238c55e37308fa4ed115350b542d23b90541b2c4810af3cc206cb"
+    "244d323ae895178b34c7c4cb4cd0e557dae64f443ebbcc16c10b6188c476cf1e"
+    "9648d87036ade6de2e0651413b5115f2d88c32dc1e3526c97102bd1541fdd5e8"
+    "dad420efcf53263d63f1b36b1be7503f8868fcec6dbbaa9079858ec238009446"
+    "2e44b75a50958671cd22331f464b2393e235268824939531e6cddd2b05e807be"
+    "1e5a61c657b705de0f7b4a9bb30c76cbca3b151525f9628506202cc8b21c4df1"
+    "720d3da171706ef3d007dcaa32da6622002aba4198347cdab9662e8cb26d7ad0"
+    "9868d6da4d74e68d79c739bc90e2a779e0c8a88781bb6c3381357fdc0372d4f6"
+    "51fbfa1f5efa664d726a7c6aef4bbfb1b02665b7d595ab252b8f9714319171bb"
+    "966f99a31102498468cbc3c5a2979c6d2ad9127010ecab2199b2761146014b6e"
+    "5918b5747b425a10e92a89db860e3145850e2154ebb9b82ecdb4da185e4fdb69"
+    "501a34048f52df8bcf91d4e7359b1b8c705de3ae67fbd0d7b26bf71f6ae2edb5"
+    "23a7554e7aa29422cf7ae31855c864ce241cbd273fd5d6b767b9e757c1e6aef9"
+    "d0ad1626f2e3991036aaff079d27a8242ef28b5a7e93799a2d4ab1277cc44f54"
+    "a8ea881fae9aa00fff495bb1bc82893bec005851bbbd97a2bf0e4337531306ce"
+    "aafb49a21a7b147a1f11102c515e557de1b94df45f733626a012474b3328af65"
+    "317ff59742ce7245128bc9777be2fd2f296d5a1b6519ba41cba76410044c82de"
+    "91f4ce20d4c921ddf15797bd2339d9225f7b97f21b379211318578f230fd5084"
+    "ac7c7a78dd8c586b995ff81f1d4167a9e2a620cff55b8cf8369dcedb21f555dc"
+    "010014929a8ccc8c55ae461a0a85eeb9aa4078fd9a65fa23344a2ae9481c8556"
+    "63fca968ea057abb58be4545909bbb8ade7da50cd93bd5f6666fd3f1663612b4"
+    "b074fe0249f589c91533a76e637ff5762d7ed7d714e35850d53781d169d90e8f"
+    "7c2e920453e075b37cac6b53b57a6ed2d931448387d93ab7414619cb3f07ce1c"
+    "ff2b702a57db10b47a484d1451fa5c84bc80d98d1fe44d5a95ef942ee6f7a70f"
+    "35006dabb329bdf15e31fbfa1b556f4d3de973e0b51c0fbc882548eca3031c08"
+    "5fa64b090e952bfda967a98a7a95a5b6850fcbfde7a53850fa2be73a3cf4b262"
+    "607acbba78dbfd7feb1b34156436acdbb7494502b7de94e431af057fc6834cd9"
+    "d41c802ef1fcb17e33fa95e372f6ecf8d7f8aaf26dc0abbeacf39580b6d95308"
+    "6b394fd04cec5b8b892507ab5e4ed4a8363d94f84395793c74748b22bf75f45f"
+    "9c54723e42a911325e492a8b70a531e02411f92b8c76aa4c7c73ca6f30318261"
+    "49b6d4287e7dc1a46f9ee3fc1499874d580150be6438add08ec8d43a8ac7bd1a"
+    "3299c5c2cf8ba0ab90a5615b6f2f88652fe08dd21c6b4b233c8b61ddc195fbdd"
+    "31e7672d017f2f9a3a4846b3f73488f11683768fc365209bd59fee1a919d1a19"
+    "fcd4fd900a07803736bdad30ac7cb25119e4308a3701eb586f9aef370c0a130c"
+    "795152475975a20c9d0a877ad009b67089703b73e48aa17bc47f8c557061bb52"
+    "7af5d7e49a6759f1ad10cf8bfaefb479a9c5d7127494114440de15af2b900176"
+    "45673cef6f72050c72cf4232aaf485da88bada6f74f7c594db22c8993ab95094"
+    "63c6cba1ed8ecb7e7a3b44331ee68c5ee6a2501871d180980952a2921dc1bb48"
+    "3adf4e2649e3d1d3f268f98b98b8a31c2b865b59c189ebfa910fbc9903339e04"
+    "f980db8d79cba4a53cf467dbfe4f3715354dc4d8339ade1ab25645e95f737437"
+    "5d16cb59e887a55c808adef93b0162591388baa2af4fb14579aa4b5a3b9a9247"
+    "be402df323562598f466327a0583a0fa7658f5eab4ad386a233b015ba215a025"
+    "40de84702d2e51bb02637b357723812384a89d5b84a02b9ecbc4a5a04f5f2734"
+    "239c65964758a942424a3ce9460ee63528452b8e28396171d3ddf0c2236be1b3"
+    "f0971dc2d793f4916672105124f1afd69fedca0ba268b3bc854005849a898749"
+    "a97e429552cc263a0861d222a9140c43fda0311fb574ce806ba02ff6cadae50d"
+    "29f5e28a366cee0de174eae64c48ec3c8b935522b7ec6ca55bbce784e7bf869c"
+    "5f1182adfcdfc644aea8c6bcd15304b350347e9ae2ddd9806e0f7ade321662af"
+    "2b5d3c8c92cfeabc8c31fd0e38bdc6a275936fcba4d94237328f40a66d089b7d"
+    "8af33d0b010e300d9436adb24e17d9aa8dbbc597c5b11a2646fadaa4ed9a9fa9"
+    "77bd1005e362e402416347b7defeb8d225de9c3315f6835c8ac14b60459d0d77"
+    "7f547b95017230b438b214fb5f489bef0e427721df18282894848a8f9635ffdf"
+    "150893eb30a6ef0c09c3fd892a69293d2209f271812613a720f1d821b812f375"
+    "e40cc27d619eb0472bfa4f93ed17964cf3707c72afab15ff11f1914eda618b2d"
+    "f8c1cadbc70db89a381995fae884d721259d5b85414359231fcdcda6ea5a88de"
+    "d41b4897f1f14d88fb9151d38a8bedcdb6b51a2f8d0013703326ef254d42622d"
+    "97ebaeb72d72e25d1c9e6b6639fb9f8524133e5ed6746a4a5e32e6f681d77c12"
+    "b1e2af9ac8193e645a3890720ffad47c8d3934b2302c6ee56df647c1d749a275"
+    "6de00c0562512eb318214dc17686b068eeb96d11c173e1be22fc14c45b8cf9d8"
+    "53e86fe424358d65b18ceda75e4f7ed827477602fe053db814e026bd09ed9fc0"
+    "159dd495762a18918e2ef6755f3eb9d5900340142eb6892080c6abce0a012b48"
+    "f5961066667b219d65b4550f8e131a86999712964d4a83573ed5c45cf2989eeb"
+    "58714e1086720e25a19694350e6d4621e8ea51912602259fbd7160b1d24ae7e6"
+    "0ea5986ba78f6516fd29b0c9ea0e32dbf187dd720569da206e2c9961fdf60825"
+    "a03657a51c7c3ebc7fee9cbfde89dcf7c23cef13d0329b8697944eeb8da0656e"
+    "6e9637df690de02a4de59c2be6a0984bfff92df1e61bcd9aead966d6f5a6697a"
+    "7c6858f9048c3cd735a0319fa124c690867f544983353497b02437f93de7337e"
+    "a999ab2dfed8e6f1f7fd901929c6842ed574e439e0ee0d241db058496bb02c7d",
+    /* 2^79 */
+    "f4e86594d1f13b96a6a35ef6288b9001cb9494ef4b5edcc9521a729040f4f36c"
+    "7f5dba97d61e90d41837412cb8992bf3f203f0e1d619bdd36a3f30c3b24f5a93"
+    "f2a6b428b41364ccaaa8305da69f23c3e58ab7ea6ddbe5d7b628f8b0bdb90d4b"
+    "6c395285d5698cb1474acff0250c9cd7c2a376105bc2f50fc29fc104bc0f615f"
+    "e1618cc9bc77bc877559cbd1f11bf93ea0ac95d858cb1a9dbd3ebb1d869f5fab"
+    "69b25f1db05ac704b3efdc4ae7d080389aa1e6d29abb9bc52278613fed7d09e4"
+    "9e5b8690db5e854da0ed716c69c4929302a77626b7d8fc78a6e6d7be9cdc0c57"
+    "44da685cfecdb7fbf107251b5582c0e98be0913aabf526652d242825e30e7a1a"
+    "37e154162626b065ce6b2b25dd5bf701d2e914897c171273fe59240da9574db9"
+    "7e253edf9bd953c917590ac053bfafa55ae63c0e14ae673bdaac41cba70b2cc8"
+    "a209786fc790b74a79c9120d58986eb023cd86e18be0c9e488cc1ab79a873f86"
+    "b6634468078870c0929452188fc3e2686b753a50f591d242933baaeef2376b28"
+    "b33a584edf698e4928e45483efb2606b715e894665618a99614f519bc87e3bfb"
+    "2407d90afac1ae77fe31971ae1e46e2f8e2086693fcf17d69a1c9120a837b9a8"
+    "cd5a5d0e32f71104cc4c60c055288626ee723417cf9723a9ac666605830c30bc"
+    "ef5bbb049db31d497d07d33e309e95e04c43634c7e3fde2d8fa989db2064ada8"
+    "601ae7424524899c90f22d8f0d37f2517312172c97300318a34103f2c2df4772"
+    "bc386ada03a0fb20aae928400e0c9638748fcc44a0ff8dba91ff7735ff0a296f"
+    "8518b4a160c74d934de7fce27be51e9ac31003621730f1d986427e062bf30bf3"
+    "6c414330097a071d57b21a5a72365427367edf25bd50c687830d0fbbeb5f5bfc"
+    "e167245b66b547751b3d741c478a4d131e637882ba8030816adc654eec7b4f33"
+    "d4dd0a1478cc6ed0fbb071b8f67c3295c44635a1ff2b58c3230304dacd1e646c"
+    "f8a70898101388eded8a92f62b1a12631c4aaa51732f77a1ec4d7be14df6185f"
+    "7a1059c7e3bfd0a7b461cac91e3bd3d5686c13f68f234629bfe627155e948e21"
+    "42ec107b395182b38596c7243acc2bd2b0b5cb51afc056430a0ee7edf556bcfe"
+    "138319e283cc2b6720941608dd92869d7544208f18921d7fe0fb13768b9b6e87"
+    "040de7a37b227669a9263ea58728c4f62744c46d4db69083a8989af53703d0ed"
+    "86f317da258b4a5735fd37e1d8c4fa3f58bbe7a136c35e99789e3ad1d12c3d6b"
+    "bd4dc847e208087167e0f2d292e5f833062f8aa2beda02ef3f6df3095b126d8e"
+    "f593b7d723bdbbfc6791afd315d20359d844a1df58d6a7afb3362b768b2b2d0e"
+    "eda31250b20fc362854151968c8d82d066bf43bbed259dcf97250dfa467c9126"
+    "797f24e2bf3351ec4f02d36ac42270eee398733d97d6820aafa5cd07bfb23d14"
+    "30d0ab51872985272da3773aa89c77f4bc0a1654fa930254530420989ce7720b"
+    "adf4fb2b21ead15e74b9534bc0696d5374f30b90d6ca7fcb94b81e6e8d9e0da6"
+    "0f695ba6f0e26f8efa5cd671ce108066e56e0807186011bc0966e1f3a21a37c8"
+    "6e599b757a47dadee6140a8bd50bbc76e48220d2d1fb7eb47dc9c6b2b175abaf"
+    "a8edcc2d76b59bb0cf6f54b362c8a9fa36de47384d627ee0803de5de9389792f"
+    "d0774a5ed3588e6fae9bf1fd830a4260b0e69b9e0de140adfaecdc4bfe44dbb8"
+    "73d0976257fb398e3580fb610bbd3585600232c2e0cc58b12e13cfb6eb27a242"
+    "36a8a79bf1c8c0a744c945d7ace18ddc326396db5c7ad8376c607c04a944fe91"
+    "78069fc5382e5e3a6643477499b5f37b5dfcc7aca00a5b237a1b701be9dec5d8"
+    "b61e32794d5f19db436b4570d921f6ddab34967a4213441f02adba5678db460d"
+    "28a95f9c43af0f412e7ed5c3d5cc6735fdde05efc61cbf88c61d0d62db93f1a0"
+    "674ab6638c441f3959b3523f7049cd110a9f1c82926ef1d9efe2d0320a7a844d"
+    "fb23772cf1e801f3d4b828a1ddfc38a90a92abef2ccb7f5b5ff5cdf21b5f8afd"
+    "2e1425254f91a3d6266fb62e3ce3999fdaea5e17f1831073be6835c43cb1225e"
+    "c34682fb6a437a49dc694e10fa6da56cc20f3b308245f0cb5ff640a8fdc75c4a"
+    "b129c5be81e3a56691dddbde2ebf2fa6c8ace3322e8d9ee9654e0c42e209b070"
+    "1b46ec0342f318e748c0f9b9dd2c003b97718c811051e1afd0421375cf1b0dfb"
+    "dde421ab536c6984ff1e75d195bd2b9569847396f90eb6d1d8c0eb746141dcec"
+    "cf032e843a4bb06ef63425df43e669fd5837b2c5a832c274243a2a549405f65b"
+    "cba4be4e7acf979f473f1b1e898ab44169249815db24bbb9c48d7cb69b036018"
+    "a1c5e0e1e85ba99848bd1aac05e8f904146867998bdf1ae6f4e1f8f0c14ab3f0"
+    "f9bcca4e1a87ddc913162ce84c14eae25621f37b00b0cab1d0396f0e4f8a67ec"
+    "ffa1e984794e9201471e6de6bb7759830b054bab468ead7022272439f005fea5"
+    "6c9a9898db3e9ab35ed5b1af8e7e31a9ae362698e166a1fda9d7aeedfe797b1e"
+    "431c8ecade31730a050ee72a1c25b7b00b9f7cf7ee2cc640650199f2ec23cdb4"
+    "1664d6022c9b962bd3076b5d1a794d7de3fc36f7d515c6a1044d56b43a0f45d4"
+    "f971176b272ba62baf8b1b934e99aa610dba99e8d17c527db76acaff5d839988"
+    "740adaa502bfab2c6057e66abd544d3f1ffaedf88f32ae1daf7176690594c317"
+    "82be3ec1adf79a5b44f400b01d6759f43286c97195130b0a01b736a1aba08d70"
+    "6bf2b8981aa083ec9ad76145dd091608b7cf005881a991f7fb347eb5c3afdedf"
+    "009e4956094049c164e4057046c2709d36b2b35e6b04a51149a9a14ba79103db"
+    "60655d7fb49c1a7251b12cca680c9a886f215de5053c37207be0e251a836c371"
+    "f55f3fa714733b62009512fae79181d2d2f6caf8aba77980217b2f4fd0c10da8"
+    "708c239dde1b69b599c6e4b5138c353affe871c7b93afd2a87365a9bcef64f7a"
+    "97f89d18e7667f95d8f590d0b80faa2b173fdb659803f338ce6bd4ab8129e151"
+    "5a04b34d6058d1f541a14d4cbcf5cbf063447a417d413662475964a0f177e072"
+    "8a9571c7ca72d33a66271429b54765151bd3fdea6d5c5889cb132d3c76b614f3"
+    "0799636767dd66a4329c6376b3cccd389d028eb06dc23ebc5b95522cfa58ab5b"
+    "ad50c003cb4f9a5825853abbc3d4eabc195b61cf7b7a2a79691da9ba34d029de"
+    "761ba3ffbe9019b13a10d2ede72927e7ce4ff485974c7c742607044c287628d1"
+    "cc6b8e48711ccef650f0b0d327b4387e4ddbcfbc4b32194d05f0cdeeed6641ba"
+    "a7587a3fc8160119d3bd30fb44b15eb175ef7be4563278180a580f90e6bc8330"
+    "e0c290e5df06550b67cb1079ffb98f62908d95ddd4232630f53b98ef6d2f9572"
+    "8c78aca499cc2245f1be1ed80fbb468359f43d3347d45bf7322115013133155d"
+    "76b3ccdbd067e9f412dc910d8da20c9c45ffd13620b680b07f250914680d880d"
+    "2415472c7e2fb5cf2d3f155f0e8db1053172ef25819ea83adb5de85f0f61c1ad",
+    /* 2^80 */
+    "75eb6864b9ce177cdca909b98d153770d622a8c94ad76b10696a6004e42c31d9"
+    "e10fb8ee4cd85266d9cebc177129be75c879d354c4f42f333f925dc952a675d6"
+    "2cb00aaea1500483ec9fe1b9247ff3f6a319853f471eb93c3c815032242c4adc"
+    "466d26007ce84359bccd79d2bd2ee672e098cab83faf0edd6a5f0f7716e3ad1d"
+    "e04641ade0993afa9bc20f5fca80c8728428add0097ecdff4cbcae2723453495"
+    "b46a71b78da6f3cbc38f15bba1d1d3021302a9ef8bc21ba3f0dd7d75359d042f"
+    "4654890e450de0116986c33cdc14c5cdd0281fa4c48bf112b73822ad18a9e798"
+    "63f4637c75779eae140779b558ec7f7a3f87da287f78dd8d2d0f7954e229b8f4"
+    "06bb3e44c5613e0fa57732af981c7a51a5c4c98ca5685a3861911cb3ea281aab"
+    "22488f7dee457d1c78975a2e1bf901d63d8868d8d527052fad5bcba177e7a81b"
+    "095e8083c2999fbd25331d2b8f9decabbf359638d994e1e84f6cdf938744ad8c"
+    "e7f1c43ca1117493984117bab6b7cf4fcc3cf990f46ccbe877503b2c4ab949f4"
+    "b7c381a1f6631562aa13587a7e4855188b37d44a67e62799d84604bd04436341"
+    "40633470b6bc1a4b8097ed8d1322e1254dbf67c182de1648882a1b0438e9218c"
+    "a6619c34a7220d728be9197a68864041930142a4afd6e8852807466df4d18dfb"
+    "f7455663a0643caafd4b2b5378b4219c50f073d28a1ca28ff842049b4c906cce"
+    "ae171b7f8a9f657bc2d0d4d34caa133dcc62331d5d9004d25d49a79c80f86ffe"
+    "b4213ff957049f55f757bc71019fd1064dc5f022ecf0a9baf4c9966b3d1b6408"
+    "ae2f1ee9be97a0aadf5bbcfa851a5171911886cef79562eff6acfc460535aa64"
+    "f6a3c213c951de1c621cb9a8ab9bd72e74e13d83f745cc8e31ad2a2cc610c3c2"
+    "027ef984d026bd8c0140cc4e3ae5e709d205322225586e058a8d595b6cfcddca"
+    "7e13ed6f818435d017cc863644c7f01656928cb7931c261599b375d4bd0615d1"
+    "eac465843cd4489f988ded85845d1f568ab8de664bbc008b3719b66950e0c6ab"
+    "b18dac42bda8a8d6c093106087c3682207cd555192670940b068079fd4c740ce"
+    "289a011a17d502e188c0fd7667684cf5ced9e44c4646a0f1d09b8cd4f759789e"
+    "50011feda2987f2a243909f22036eeafd215f258f587195ad87e268e49c21164"
+    "ce95eb1d48e110037f57dea2fb7b6b859db9cf6584ac957ed8bdd4bd0b3fa5b2"
+    "ac31a75a7c5eb0b96d8cfb5ec559d9f6b55aa979f7b86db14aaa7dad2e524415"
+    "e69e3c0e8c4c29986e5cfb2ed59a3dab1c28359a1f7611a63f81e5801d57ddd4"
+    "ce293161583c66c101c156faf3afc948a9e965834e1d5a97fe00dab0102a216f"
+    "9cd76d70c72d74999d009e6c18499c8ca170fd30ba1f6cf804e2dcc1ce3ac610"
+    "e4e34ab3c082b814741b8a205af35eb94c20f2acb0169d84e9759e13a8aeed3d"
+    "c9962a57b3b627c24cc9e64a6a3fc623c5918e8e32072ec733fb294a8fb0eddf"
+    "3bb4ad1215c921376cffcf6fb1541e5cb7692095fac2b638c25558bea7705038"
+    "2f76a486cf185e90c2b04cb08e17a3ff4f6627954e20bfd95edb64ebf82f6825"
+    "08846dbe714bd14bb9b0b4237eb1601dc84654383bb8cf64436fcb4080c1e098"
+    "108d84c650b46ef627704464d7ae03f35562edda3639978425f0fa480902d926"
+    "793794bcddbb3eb47d94ab832c8f0050e964c7f5b9c71a05c98537975d9c9bf0"
+    "c127a1381ca1e5119808c2caac2b5f86c4de917cc63a3ea593fcd44c835b059f"
+    "3fc756f82f4af1d2116759f0f0fdcc9c635412e346562ec28fcd395d0d59c761"
+    "932b38e1e37ef21a339cc10f64d29b13e6bd25772e2ed2f686caa7a38fa4670e"
+    "db7c591b4e8bf0af04b5aaf8995b06390c51b2c7c4f442cc88d26cad8567f6d8"
+    "3adeec38ab7a5c4edbeb71fb8ae9ae5774153fcef1a2b6cfdaf1800b1065bd64"
+    "b95d69cec6d2563e6a88debe9b956b122707640d4e078a517219015252eb1a23"
+    "78567fefcfca1e8b2b5edb3503bc98fc6ddb41090abe2d892622573530bc27e3"
+    "a57993c4c58357851d47d68c844d5ac18b45a170c5b4bc62fabd0f05c7427f9c"
+    "3543c03dd434fc4545966d7013874970cb7743e5a1c35c5e70ab02b578a39803"
+    "f69e1cfc52d77636271e7778d1134cb8dd26c25f208033900f40b9c0a12998fc"
+    "1f112257505690ceb73cee347db27ac7e63da951cfceb4926ffde66ddb8ba350"
+    "d0ee73b2e0ce0b36c58d0cc89ddaaae05b565b00bd69e6016d1ca032e041988a"
+    "efb364102a1d375a80c8bbd72b07cdef622082afceef6bddbc98c5e8e633a666"
+    "e015751bff4244ca5fe6f18ac86e1d77dc35df3929aa3035a6a6d0685efaac70"
+    "f4e7b111941d78ddc811a8c4b3ed10aea6452b18b18404bf7a5103e93e5391e9"
+    "d16888c181b6ed89a94de0a397d6a8ecb1b7886aa3996965661a1fab400f5250"
+    "641dfb56a9a0249cb04b6597590f4f130ecef675888ea96814ddd07dabfd28f4"
+    "af470c0659224b2b6b459381df07b969fed3c5b319ef204850a555b78f4b8d77"
+    "dc73ca12518287190b89b27af9024fa6d626ca222f76e3a0e6e219125654a473"
+    "3520595839b746235718fe6c2fb334db7ca75df67acdad5ade9ad1598f8390f9"
+    "b78ec3d72df66451b2a21d4fad5dd2003c1254011d274c2b95f43fd846763d38"
+    "33ff8c2c6ea9c39843f3516488911811631b35bb000759cfedd1f971fc3d531b"
+    "ad4dc9cb86842bac9a3c7e45ba90c0658f2391994b1cf1009efc6c6a6d35f23f"
+    "8f0feb7eef0a1e58b279f5f022434712bcd3dd7b3e0df4eebd7201d5c244c365"
+    "46463149d4a323f47c46362ec501bd0ab9195da55bbdac70207d5b233899d448"
+    "35262ce68553902bc1aac5b8a5c92732d8f779f9521150aaf6130e027b5bab66"
+    "acfb616106133536e037c3b5c17fa9b3a9e986bbf028391a4e79ad4e09331d48"
+    "cd6beba387c7bde7cb65db33e7c1e6f6cd175156dd11096c11def3106ac8ce79"
+    "5e7d875876a0e64982de3f6c847235249780183a3e25b220ff146f9c7437ab86"
+    "ba2a32146aa7e69c0ec3c96734c927aa87e5d8ee2b46c39c7b2c38549fa88b17"
+    "c2e8b7c35625d1f13d4433bd3240742e0256064e293d8565b704bcdc325b847b"
+    "bb413f6f1b6b9b12b4527a6d70315a19543bd052067d145e93b3b9ca00b6e467"
+    "f3edc075dcfb4f72b35597e164c963bfcd5ccca8827de73332a7ab92a21de4a5"
+    "1a28dc101860d5989b19d7e65a1966ad7e23326208dde5312e706e0c0d845cf5"
+    "6523ff28604c6edd09dfe3c07f363f8d9f0a0b12fdf2f4dcaf18e27dcd640dd4"
+    "920a64c7e5e45e56bf0ef6e492d4d48ff47a0a80c2cea08ac63569495f52b856"
+    "4ee79eeb98f20eb2ec5d86bfa4d1931ae8044a2eef46526cc412563d7adf6fe8"
+    "aa1cd3df9a48010b43490cc7a0a2f87353efb9f08a8e44354872a0b573d45a88"
+    "39df6887c966487599736ddba5b7fbcf238964e4791ab57321040ebe0aa3c207"
+    "a25857de1382c34aa4ddd59b5eaba08e9708f3efcc9e0de6a4efc650d830e638",
+    /* 2^81 */
+    "125e0aea23d1e7bd52361ef1bb0bd644cfa82cd63205004fed36fb2419f42c74"
+    "aef88f2b72c7613b60f8a375cc7cc62c5f2029c0d71c55caeb8ef1c742e1e238"
+    "45af7f3cce8160c2214814a09ae5661c8bbee1a774cafec1e045acc88c604252"
+    "9f01460ab0d9f7cc827ec15e52b5b1e46576d65df186f98ee0329077cd4626d5"
+    "c95b44bbc5b012f2d50b3242dd646422f69b2870ca99e622bd19ac05d9479972"
+    "a75cf5de6a9a37c42e25625d0d0b15358a122665835f20e38dc1ce1eb4adb20a"
+    "2731bc37b36b6c78054984c874e222a93a8a300df8775735caa264af8bec1342"
+    "80a6b2f0cf70dde785e885f1175d1a4f0c8fa092bc80d2d1281f3a9ca345b684"
+    "4cf20554f0854aeb4fb64ee35644443f807bb4a8fbbf15be3581e8639796480e"
+    "2f4e5b236afebc1e8524f8a9c18162f9c2335dddbac0d0eadc00c5c9ee669d4e"
+    "4e1b959ab99bff35a548ca33332e004eb2ca3425de6b27221c6314d9fa8dcaa4"
+    "c9ab114720d4f29818ea2e1d18de9bf1a7dcfb7ef476b83aab7c6a8fc1342f03"
+    "1fae379b834a8bd7608f5a3290b6de0266c679f6c515db57fbb4f57e90402a89"
+    "7d839222eba34b9384fcb83a7e68dda5f124d8ac74b3b2cc5ccdc9590661b57e"
+    "351d8bfd480ffd759d9c591fcd1bff9226c12bc688b3c909292bc6c041961504"
+    "975a2f98bb8e7a471e0858a07f06ed37b9bfa3bdec80a9ad4f5aa2b5a8569b52"
+    "65b5c7b409871552d3afe0343f4db9d8884b5ecb5c117d3e59863e7057b93485"
+    "de6324a2a7666d37b4cb738f05d1c1130dfcb89d787decaf1dd6ab6413bffb28"
+    "3aeca9f81b291fdf3b215e3afebcc53e6a4dcba7e2890662e9427927116e90e1"
+    "d162766f956c72007d100747bca48a1bff714e7fb8de4831f61f6e8572aecd73"
+    "9157dda2d7ec36d50fc7c4226f89490ca69f19d2ec450c43338a3bd5983422b0"
+    "8908677e3e475b46cc7563a086577e6e0ce9d1bf3017becb7facffe108a87732"
+    "eaf055c94313f9207c8c48198bd7bfb1c83b5e430d161625a31624f70858d7a7"
+    "8140568093c33b68c5df09caa52c9943f16fcf803fdc6edf358ecd0da90fd296"
+    "c5c42c331f617e9fda545363ad4cfbf3829890b65ca206a877f69e847c2dd724"
+    "2714a05d2a905c862acfdc8ffdbb4ffeceb9b31f1632e7e5ce61f4abe269c186"
+    "abb2a1805d846659c1f6bfc2882c0ffcf7d3a3beaa499c781a66d5d5e7c40469"
+    "79832a41719674e686555285bb94e1f973e23c09dc128a266cf3e4663d204836"
+    "8be37e23f8308e9d826e8e2f9436d29b605a6381b1ee1dbd6693ad820b658280"
+    "6dbbfa2cdd69d5e4463ab30cc3afd6b27a72457603cd64d74da9c33110159413"
+    "047ba4fc4e46563e0ffc68bfbc24b4d9c4c644a4a39311b1436e1a612c865703"
+    "d9eb3c4fc5705a675dc22edbe0783432e1eddd26a7c2a1148120d940563d347a"
+    "d4817e09e5e4e946c63cb8c89adacbe4da88adabdd07cf183485de3a5b25aeb4"
+    "a76c955953414234e63064b2eadebc861e1615696f4be50bceb7132c50d6c8b6"
+    "464db342c908c2d76c6f33dbc035ddb18d56143e0eb033098c74807f8738f22e"
+    "f270b7d7b5b5984bac02025804107b1ce44224c7b78bfe14219d29ded15ac607"
+    "8b8ef0c2d8d99be30c5b49aeb0e41745e9b3c78c541ecea30a59ce1c561136e4"
+    "357766c7a125e7d3df865cdabb497ca50be3bf4b655e607b8d860857f6b4a7c5"
+    "ff77ba5f1d378928867aa6bbad1496ab3ebe82a2acf33305b60ce738c955f862"
+    "78c0cc2e30ba9806f4db520c676c38b21293f498b55b4a310975558b73e7fd26"
+    "154ebaa0db561985c686614376d8520d3a858c66e7a0603b3c696a691b282cb7"
+    "740b6829197a12a35ef7a255cf117db83c77fdb16672fd035358a678b3fdf0b9"
+    "0231e9a2cfd27e96d9b10e1626ebe0bc4736cd83846f9d0619ff0469ba397020"
+    "c6c2ea347ec5f9c60696bbb8acef9eedcb4feb354cdd376a624937858cc5050d"
+    "f63338c0c9ba7d8ee370d2c6c74cdd815c3379bb272da649a662ac13ba9a178f"
+    "b479ce6bc7ec8a515e4e6315f8edf7ddc7c8da1cab4cffbf6b5f1f39d8fabc60"
+    "bf865c2ee8ddf7cbc52f09b3fa9f66e4da930f46360f23e82992845f794097bc"
+    "3881ff719123d9bdc13ec24cb0ae3db57580fbc5f877ec59b7f324cd64095c85"
+    "6252cd743518f7fce5bde36e755be96575d46fda36b26a8c656920244015a87f"
+    "35b5c3a72b86679a16248c710723a91df8f3d9146ee5bf4167ae1e427a09c871"
+    "bc502775484d87a8743286bf4d5db892e49d626c6d9d5bee9df86b026010dda6"
+    "0286f6014f03004e43f9bded264d8bb565c6658128903f82ad751a628f731096"
+    "71f2e57cd4b7b33f767c506f30b8b8013e59e59069cb1512b4599606359fc458"
+    "02f8d4737286ca5021be19cc679002c168319ac52be1bf04b96107f62274416a"
+    "9ff16c74f98e6ba8ba1742bd8cf16d20ccd2482c0ce22d88a4db7ff70511f853"
+    "9e6fe27a5f5ed7e68cbdba01bc02fa696aa6316e9be1421f43540f3bdaadff02"
+    "99ecf53866ebce4f8dd3eadd0c2ad97dfda13eaf400b53e6cc107bc8ac699896"
+    "27e7df0faab0dca3abbcdeaf6f342fc8bfc44b3a952001f218d9c571399932f8"
+    "1356831352906777adae0d7719d1bf6ade5d9516fceb76d6373082be4bafb9f3"
+    "e8237e988fd5ea53b86a75affec9947b39b343aaa00281f8c901e7118dd0f4fb"
+    "03b458b0776e812ea3d35f4e6e491b8a7e072b47a06dc468fd433450b7dab086"
+    "463bc54ae4131791c6e21a09d0db7bc73bd54ab0572b306f498d93a2dc0fef45"
+    "a29db855e526935e9f592783d2ce46fb4c07780fad98542a3534339aafaefe6e"
+    "396b17be65fcab3f219c676420d537d12b7cc056299cd5809ce1cdb0a81c3059"
+    "a020c8cfe824fed4118e2f33b43396837a513fd8880d963e88606038ca41cde9"
+    "308022ef54064f688e2ea9686e17eb61b8ec3be7543392e91106948146c118ab"
+    "79d20dfee07a98f69c81069a7379c60cf440b77c045bf891379128f706a8b9fc"
+    "8ceb84b665c0a109ccee74e9f50a89a4558edd2d31c4909890734ca890cfa098"
+    "9391f2eaa2d5729e5c2fc38ef82c3fff87c68b38f145fa31f6d0695bf0b2a9ad"
+    "97dfcc56778608edccb80be5615f7ca5de0ed034c0b3966be5991414fb222607"
+    "d6f819e942b1d37c79b7b0a76082c40d6c455942ac34ff179818325b50848bf6"
+    "facb569a519d29fa3de99f37ea9476c4d1e1ab353dfaa1cede7c3f4937ee3dc7"
+    "40fa54d399e970bcd6793c824897cdd60831ff8c7e7b8f548dc497f54c42a55d"
+    "baed62511afebbaabeb441e632f82e96046c1488763b39473b4c28451db38c68"
+    "305b2117c6ce155d94895f53d3fc380069c7e908925445f5c8c3de6c552a36de"
+    "8629b69bbd0ef128642f1f24c3abe4b03308cfbc893b9fd1b0be00f1deb8eedf"
+    "d693a13ed44460f35a35a6d22447abb87a81a8bef33d1d50fbd0de574288043f"
+    "da7636066dbce50ffe7112ae7069e7d00dc0d8db9cc4da9378451207fc8cea45",
+    /* 2^82 */
+    "dd735303cf89a458996204f5da5e4c667bae7a33a62d55a54f26bfed81219bc3"
+    "66bfc17a6b99f75c5134d6d0d65be735c501c40020d31ed9fe4a0d3abfc1db5d"
+    "6e95ec340ffbe5520ee855a33c9bad66e6bf9425694b43414256d153882c8920"
+    "93d8427da6ed6fb5337115a1d16f077b6dac85f36ba5ad19fc59924d49ac0a85"
+    "0dfae4d3690ce721160ae948eb0056fb2cfe53c0129e2b2ce5b099e36c96299b"
+    "ddc190d1fcd8538012c514a4f162513cb23b55e402d88c93931d6589f2a53ae1"
+    "9353ec2127e43146fdcab08a3e55f317797f1de5efcc897f441532dad8cd743f"
+    "47b943c98f01b83250d7be8c6551d6a33e556db1d1269865e1721fc8b1dc5f0a"
+    "4676fdbd4851b870cf039412619ae056d27a312e47283809b49badab87e0f950"
+    "befce5ebdff3b2d587ba3526187d574af12a715e1052a1877b2bf680749b6ae5"
+    "83d37a55d052af37a649b86cec485a5f7d31a310bdf7de3cc5c1aebe0d4763e3"
+    "0527aa7ce9fc80dadf53e11ffb6506ab93521a1bd6b5528d33d7354e09f33257"
+    "b1bc98f74c6ec58b271d46f5aceeb59a664bddf9765b08f84c7f531796df4a68"
+    "a6bb270dde0411cf6c29a0348d847c0f5cf8f7b17d38ec73393cce266080cb86"
+    "c869f62bd365aa4e5bfb5a76988426d03c10a4431a7ea3b632c6e5bfa897c0fc"
+    "a970fe6a43e8c6c5be5a6483b3f2622f02e325e9341aa17cf1da89c5ef309309"
+    "63d2096078a5af47a5fbae8a45fbfe88f401f4544ae2810b3718ad4e7e407ac2"
+    "e06d5ec6848397dcee85ca7544970de9a578b446ec3a0d809954cb2e83b16d82"
+    "fe8d7f89cdf734dcb7c7f89b0cc4ba316965384b330fa102aeccb505d10eadac"
+    "8846fb1937eff0abf4c0d867f598c5ab4e5c68889176929bc768292388772b24"
+    "d74b0bac9c3477a902dec91437b81d1e3118e77fb872277c12d772dc6c2bba99"
+    "d79131134b49cba662f211978af6c20b21c865db01e3129d3a5e5c25631bf59c"
+    "9f2dd5a783c28151098f55eef0b168e700e075613a6cdf71c52091622bb6629a"
+    "f37f166df2d73f474599595b664d7186e22b16ba78de443e3fe96f0126f98b16"
+    "6e9900e438ab2b0a9fb5204d8c76dad52775f9d9d1cf52a20a3881d06919859b"
+    "0d9415b675c8d1b1b4a056cc9590a3f6e83915bf1d40f2bd3eb147d322ad3320"
+    "bb47b9b94f09360810de5cbfc703869618e939869e83017f26c9f56c771a2d84"
+    "e029c7f18fb447145d441750cd60d69cbd0640e7315f576d98f43c01a457ead2"
+    "4ce3613ac174cbb65aab2baa464450c0cfd870f44cc3ad35cc9ac7eb067c702d"
+    "307ec5f5a7b3e0a18ff24b945ea06d7a45dbf53ec57d92b49d946727c3749abc"
+    "d8773280366f7d4e5fbd9fdf4a6aa66c82657f5c310ee32cda248fdbef159df4"
+    "d1fc4f43a77f9e0a21f3b0a99781fdb2bbeb5cb032c4004dd6138983173096fe"
+    "2a94bba93182b6bf52626cd73b4c81841b51a8afb5f174f820f43f3ecd0719ab"
+    "a2e3407dbf7d37206f73f957e2ed4c8c3b751f7f4acfeb919280a8dcece55f62"
+    "8559b81ea7b617a69357b756c9930ae6865664584b023005614f754da631d275"
+    "2995071321f1b573b2cb5ac63c76b8df71e5ab1f0043001528383cf66ae43378"
+    "1e9c839f144efde3f7041a6726748f79c15307d3b3e39566eda658330f2b916c"
+    "358ed3a3920d545376b664d0c7c3f5273f4469fabe8d64a5d05de10537d907d0"
+    "e0c9394d361b7d3b5444608d942743381395ad316f91b4075c365c3e9cae6710"
+    "08a27e13a06df1576069e4b97a1ceea5535d0b3da8290634b9d8fe4620d000a4"
+    "11d4085e89b894237616e3ee7c0f6e049e843b8c36b8d4b2d1c3be467aa53bf3"
+    "8a7837ef3c3cd7c3142a3225703f69c274ff203db0f585ab66e43e60080293cf"
+    "0f410fe207b85dd30c591169086e60133b1c93dc97550f3787817c2e7fd8f633"
+    "2619d8a6be2e847c6cafb3085eecf10b39a4dbc9b89403b9e68ef0a124770260"
+    "f8097604825b9d9f8f0366196de971ca8c4998d159f390ee493d48398dad049e"
+    "392968b991b410072fed6d162f079060c46c1071e2a69b9fb544de3385448f94"
+    "bacecdf48283067dfc1b6ae9f8d36c260fd26f07571b715ed2a8ed5e5e42bd27"
+    "249575cfca120aef8ae2065dcf5786a3598a80c446374b59bb56903ad0e822c8"
+    "d8d542e6e4a52d39c5c305da1df177691329caf1e729849b9623c4a50ddb6eb1"
+    "0e4fc182e8d390da64d437ea26e8928538cfc718d281788ca032b8e54f5b0c27"
+    "e651afff68f8ddbfaebc1e25c4424a5f6f84d96d68100a85b5956eec06e06eb3"
+    "cf25028c84ccdd34434047db972c5091b3673807d7fa13f6fe4b102f57145515"
+    "e30d67efb899e39f515979ec21b12c3d14eec90aced8ad5498670d1d796695d7"
+    "d16124cbff64b798979c59c2744691fd9d3a8b9d182095eb19b9466d095c3084"
+    "8f27f04d765bb1dc74d5c316aafad347e60d32b2066fbe79b49fc67f7a597978"
+    "77d8ef135c9d69f6e72b8bed61f0e1d287a8cbdb64cb4cd653d0c874fed375be"
+    "20cc0e1e7f1888925ceb31067ad917beb0692a6d335afc481ced64a9073c2a6d"
+    "c80154cf50d3f2c1c8b0fca1762d6154a36a0de15f076d0844a9462f264c9a19"
+    "6d69b4fe79131a33e506da2af7e5c69456572da45d816c961ba05a93acf6cdc8"
+    "9205f7643c02e796f0441ee2459d209bfc10976bc2ac9beaed46fe6b83435306"
+    "3b67c3da7197dcf82311fe57f128c2de6f0b6551cb93fe8695602e54879d68b4"
+    "f0f4be4dd954d6d9bb2927f5a5364b0f2221d109ceb219787479457fcb390116"
+    "91dd2344ea85f94fd63fae643501ea6999e15cc5559b0b00e2bc9c684c157b18"
+    "3fea181f5151d0e89854c3fb0ce1c370ee7f5fe89c142b3907dca5aa4b63206e"
+    "f67f4a2041b1848b24863f3660e0c27df54fd49bf58b18f288fbbd7a3ac9f56a"
+    "9c703a7f4d6fa22617646a7731ed31b0c873a97eb1443e7b903715d653f38ff2"
+    "f67194be920737cada2e0660ffe67ae0f8842965794a563d8fc1645acd0fce5f"
+    "7fbb23cc7a2694630e6452cd862bb97f1eec44cb9e2b7cd00f2fc11af12cad53"
+    "e69c008cde0fa51afcf822d1458bfdd020d56aa1d365326319d3562182b10b71"
+    "495b572327fb6605ea47d5d00e54db99e305def4419eabde66b5a7f8b7ab6533"
+    "4e8a1e1fcfb6fb942cf74c6c525a5d5aaab9511617449b972d92e0ead594dc24"
+    "3d1a39d2b33a3e17be7698d105f596a3004898e5850b1293542b4257b6027cc6"
+    "78cde23e69ea0bf9f4e13779b0d75c33ce3765f34afaecce37f10881269ae309"
+    "28004d8167663a8c708586b2502d6bd6307961efc31ec478ac20475bf50f4c17"
+    "32b4c17baba753609ad2862fb702ef540c94ceea042612eb920616c68736244c"
+    "095118a6cb9ffdb18aeb02c51d626b273318a98147eb7ad36667409f5543a2a2"
+    "3d01b67d9fbb06c4b8cb0d3082966fe5bdf30a008b237fcf6cbe9b4ce260a903"
+    "c8a6e37b42759654a2bf351eda5e9e1a06bca59345545b59726c54f0d9d465ee",
+    /* 2^83 */
+    "3f20a5cc4cdcb9706add10cb2517cadd8b5c82c17164d4699ef3d75bbd92cb75"
+    "378f2b1d732823a68f6ba1a4616d9752c501b4d0a5bfba289f0d1ad1ab758c61"
+    "153bac3fc7e930439f9b9dadc5e060f28223d117c0d86724f8bf3ae58fcbcea4"
+    "cefd06d5c38985877cbf604074a1aad2599b6b20ac174fb33c364a1617a03ad5"
+    "e3eca1c23d2d7f425ea6ae7c584ab8dc0372983ecb69511c79f273279d3e0914"
+    "18ab9e8aa020dd7688dfb19ae54d79f9f91e5dd9d2f4e5cababeb70ca3cc8f0d"
+    "b314452057f7eb82112048bbfad275f4ab9acf3ba68316b837aa2935cc87be07"
+    "d6c4f0e6f167c84db0623d26ba4ef7e9911a36a1f41311441bd595ce8148af10"
+    "7f57387e865e0c7bb20e6fd248c43ef81b50d150b5c632ff70fdd8967181252e"
+    "105575da0a8b6ffe91e8479cbe42bffbfa724daaa0002f3eba7d1306b4ab522f"
+    "db1c1c488b0ce738cd129b31cb45b61880dfe35836deff9050947d2c1eac770d"
+    "32659bb0ada1ab64aaaf50d5808de4f5b4a58da8428e43e4057957ad3da10244"
+    "e8d521ef3d57380ed4abf4e49d15778c0b39fedaf2f19097a284e5f7cef631c7"
+    "3ede70134aca42160bedb25463de149c1d0c9cb2a14caa3daee90ff239999e5c"
+    "aab3559b682f74ed8f78cc505d17c56a713da7c098452bbae6aee6362c912687"
+    "2c0abe67e556ad23be1b8e9b00af5ea4b0b6dbb479116e0c4f804cc2845b688f"
+    "79bf9b5430738bdd329c93136ced5ae307a61bc6dbd66c2731309eff2d072724"
+    "faabff74d2db7b042cb9464f741f18cef7bad73b95a04b971e04d96d3e56c96a"
+    "fa823ec8937439b9d85e569d5d5c82f31a59b39b13fc65acf9ffd30c9b8f3fd3"
+    "7723bc62a73bf1ae29b7ce2cadb2c18ac1382030c9f97d3c78da5da7016b6338"
+    "5be79f64428d73ca47cf43475af8f5a674829141c884b940a835ddb0ee660d3f"
+    "2ae18853cd3cfdd15d9d0578000d8de52e3e9e93cbf28e95be4e2546dedd5a91"
+    "e4ba3b5b2dab0d72591bef19392913a7ed286a9d20db373c19693aedf044ee4b"
+    "120a017679ee4e879cf737712fbd32781e71085572de2e630ac1c08e31414609"
+    "46c36bd3fe37e72efe21094cf7f9452c87c6779e10b024261bf3b04cb91689ab"
+    "1638f45f5b27b281c995307500fa3ac4b232d01a5a78f9208874af1dc8d5a2ab"
+    "48abcbfaad9987f64503931a92a6c335dec865aee498ac1bd0d92a2107d8c0b0"
+    "7e6b9010f3e3e2965dd578bb569dc473b8a2b23c64817a2f4130251ea5cc67bb"
+    "7f908abbdead53db5995034dc6886bc188472c5761627a1c7777528e7ed674d0"
+    "e262e7cd54f80c061785185f61e4b39e4a7e58136fa91a37994102bdec5b79df"
+    "014c05158a16e11c616a59bd4a653de682e15cb261a01db764b511681f4d1fd3"
+    "275e2bffb55d9e8524bf6a551c0f556ebf244dc2f4ae40065439a388150e599f"
+    "e3171768556117e5e76d2d809827d5acf15cc86789895838abfa9cbfb4169f0d"
+    "0baa2a5c886b4149f520f170f6b6b08cee08c4fc18d1208f7ddd8f64c4783e3b"
+    "c29b5bb92638284e712e3d1ea26c2b0a2e4dab68e657d1c1a4a28f180313df2a"
+    "43fb6b59a9f3289d5b5ece98b734724b59dd39173ceaf47312f0500b70aa15f8"
+    "c8ec7b4164e1cfae5c3d81c501064ac6fb0803fbb16b356dc6d3f9aaabe0a506"
+    "ae65bcda9964035fa1bc25ee2fb7fb04669492c50d6e31cbfa22677ef6c99b28"
+    "fce3cc256e335b551b62c69644eb7c049a256099c948874d9865101f444c2f70"
+    "e29c2adf6c1b94129903017399b578db5f4a60dccdd3dfcd68feecae65952837"
+    "eefbbe1f652630ab37bea141ba021f9ede71f54c3ce3c17180d8cb4e65487755"
+    "2947a68e5a2afc359095ee104a59025f24a64f2443bd0510636089f84c79799f"
+    "8c38aa3840307aa2173fe1977c53127933c9a1fd6916f15bab930fc2372ec8ce"
+    "83451016deab7ac4889468d9b1964d3f480db55f22d9b473c1191ffde2f49c5a"
+    "c75c3621535585cee62f20f4eb03aff2d2162aea505f963e55488bac1b99b55b"
+    "37a135c8fc9d38092cf9c3fc1003a29cf029f461af122303dd0dd179aed901fa"
+    "e378e8ab57e646fd28573e445167c4aedeed53c22eb8536ca23092ff318f546a"
+    "26e3782bcf414fc13deee9ea59e8d7ec8c860a04a8539812d803e948ec657d8b"
+    "2773d523a0cc0da552f8f2847c6193bfc33c2c436aa050168c8a2c0c160f1cbc"
+    "4dfebd77e40d535d82a266cddb0f28dd2d4bdbc315682da0bdaaf250566bade2"
+    "67cdb93d2a18fd082a08bce4c4f2376545d75dd5254b0391eea8244572c4604a"
+    "839dba02f94ed9f4064273acd6d69100fef1ad6b03fa6a9ddb0b1d094c281a7d"
+    "c5bab7f4adec477d276545712dc3b534b55880c558cc7b90da80669ce6fcba6a"
+    "a54d09ab3b430679bbce0c5127aa0c1c81be7f8f323405a301cbe24cbc598015"
+    "4579ef69a27dfd2b3e319b5eef2294414f03ba093220e33ef460add3454601bf"
+    "1e0583cee2bdd0107bf51eb3be766a661212cebff8afbc9ccfb2eb55d0788d60"
+    "9829ff2836a202e72a4f018f7dd9da1bc053a7b6423c808b33a06a8f965bddfa"
+    "dda3b0052192830ab1849134c4484c0da880fac24dc01f432548c8b6a5b1294c"
+    "365398494ef798eb8709d9e22e1563d2b16b7089eeeff0b4f4e1a1f8a8ff456f"
+    "c7630af220d919a004e601b60bb10558eabd7f79eb91e8da6f1629f5b6431255"
+    "0041590659fdc3c2ad13cf1b11eb1c0d0c859fd0bc16dd61a7a64ba7b9adb899"
+    "53cabdfddb17328ed1e29c5362967efc4f1746bc552004db6776563d6967f4ab"
+    "7b5b55035f079d66d6977b1df364c222ead04000cf3b182907f138aa0e25f57e"
+    "d4c582b7a137bec5dc00c08f2d64bd1db1aff0d88e74c52ef49f8486ce5e152e"
+    "56a236107bf35cead6092b485724c8490eac24fb287f01e811995d99606054a8"
+    "422b51f76db8d574a49acf3b07b4cbe698a575d12634a5712cbb4805de5fd7e6"
+    "700a720feb52b17417180525b306e05aeb99be379a80ccc9e0443f554594f767"
+    "b01a0934b7bbe3cd8cfd60d102ca73a7aa681e34cee2e62116ea1b1d8c5ddf78"
+    "ece1793ee08a4eb74fb617876f4af890d4d5ef92becdc6a28cc119871d043a17"
+    "792f8408eab36434a4f18c32caf25757f0c4feeee90d4d2b07ea5d9f81b9a4db"
+    "f1dcbf79bded8f4a244ede464ff6f3f006b9eb29da99ba331f3824ecf8b22adf"
+    "aee9f4c36c9dd4454cce9dce6823ed898204bdf572c569eb087926506d3a0bb2"
+    "0573ca0e2eb83a6142cdbf84b351ceec303f980aad82b5bfea95131a8ed65e39"
+    "b65ad4571b4c1a031f5e850d546cc0355250d452948b73e88164706a89573c77"
+    "4acc218b001915e67b9607d07c392533bb78dfaff94580d9f2157d2fa11c1487"
+    "c1070b4a8ef257c31d53b619ea9a1b033c2eb6bf05d6721eb46a595dee004f50"
+    "7d9b2b77297d9ae87bd8adce54b97868b5ea37d51036e7cfd9d7ca00a1db69d1"
+    "6c549d43ddacd24fef6062d5f8702b03f3e017d176ca3baa9eb4dffad1a04cce",
+    /* 2^84 */
+    "4d226672d083f0d05ff85d928d085dcdbbed8cfecf58a28bc0538fba99a53719"
+    "08cc6a39145751e00ff6368816be19d6208052d717593bec5b9f71701a21beb3"
+    "db1b102ee61c23e982730edf70eb919bc5bde54b5fcbebfbe87ca9abb23fb8d6"
+    "d87763be5ade9056308c4a056fe4eafcab8fc26f5725ef95169cdd0b18f4ba72"
+    "7c0416b4f2ed79bee112efe9ed4bd62587f0e1c7f3fa527df9d6b5a5d5719254"
+    "968eadc7c7fd88b10836afa1c87adf08d34855e0f1e4836c4a6f38fc9f05a0c8"
+    "28e5025c7c69f15ea29b1ba4ab3315282d7905fb9ab0d84647f97f5904c3a5ab"
+    "2607fea597c931f70af8d7e9b01c1555fa09c62bb260d2d6a2340ff837402d5d"
+    "fa099118935b23340fe2f94df58454dd5b99ec4c881c796b2d240d9a8c925ab1"
+    "192ec72547cf61b7be33a93da056b6beace54a4e17bd0ab433ca84e3cf7f3f8f"
+    "f27e1cf011328422c05c0c10697e8904d0219ace6f3bd6f8ddae76689d4ef304"
+    "a4c4fb13928da5c2e8ae66100a85554d2a99adf5d2b88e31521ed5b11ab9e097"
+    "9a7ddce8b1b2369dd36aa61c18c6034bff2e11c3b5ae14e23e05a03a22f23026"
+    "af48071228e3234fc10c3ae91f7dcfdff650b2d72785250eac3a988807da92e3"
+    "d17cd94d4d9752f9f8ead80a5d39a3efe48b3edcbbb630f3355475876bc39756"
+    "fe159f53a5f79824770b84d2fca79db582d67b11672aca772221cc5bd6977149"
+    "e2b9f393e57e472d6f9fcf5c0326461c569579bf1da5c6772bb6cc0080413419"
+    "34e3fe22a65f7393f01097c5af24ea2cbfd5b05f2c748a2483a44f6de8be874f"
+    "76e20eba89eb4004f09ea5de7dd3f1618b9dd16b2493d76bdddda68214581718"
+    "06583ee2ebe61767882d4ce248d07b6a4499df0ed91036fa1cc99778184dfb69"
+    "14ab043a9c29f299784f072958b431f2d226566ef9d687f613906c66505561dd"
+    "737e75fe7f5bdd3c57ad6ed385664d57a1f0a1810895ae4fa6e27515a568207d"
+    "f0a2c93a08ebd72c89591ab50ed9d597cff2826673698d4d1fa981b93876020a"
+    "e5de6648ba1a3cc2eb793b876c4ef07d383089fc53e233fdd6643e1495c1ae61"
+    "7c06fb76559d585d55ba4633889a3e226788949ea06caf79d8655a5c0bfd17da"
+    "84a17a63ee69db0c8b402dbc50a69931baabbfc82599719cce0fde17e7c2408c"
+    "25e0f593ac6546851b4c16289bbe34c4920a4c8f93e557a1909ae0edf54de9d5"
+    "40206a7d2ed1bac2dc46e866252d477aefce0c8c6f79b50beb5d878d1c650430"
+    "0e54cfbebbf68fbe82a4f9bed036e534925821ff17758883b4ed9eab252f105c"
+    "108fd2da25b1f49e9d07f50060dce523b56d223cf100aa6af588bf656b274e1e"
+    "f7260f22783006372377ab77572764a3a95dba50e029532a37b9ddc6e0798779"
+    "e576a343169e8d649b1b471a1ac125bbcb985062b55fe7f7e62d2ec2a4c2e4c2"
+    "a298d327e91fd5bc50dccf29366546da265931d85d3f0d164c86f326cd2134fe"
+    "c6a33b1f84ea6d9a38e99234f7aec5401b6ffb0a5f870e01d83cd6ba76f230c5"
+    "157f46b387fd8bb7a2e12fbe828b01b1572e90f442a7fedec669b8415de497cf"
+    "cdaff1a4758d5ec8d906cd8a7b2f1178defd0a1f2ebe25c5bb0824a7d787109e"
+    "fcb091c0ea045be840acfbb9db116afdb39e570991fc322f7bb6ee20f1f80d6e"
+    "d7bbfd67489e45d3f665a50eccb6df2fa94ea864cdf5bfbf67dc7609b40242ad"
+    "4f0fa9159177cc06ebb79e4bf6119d4a9e85d39f49360a755da0171cd14d46d2"
+    "92a1cce361aa30045ce6bb7ce501c9f241d95d751130acae5a030c622a3b2a41"
+    "b425e70bd4db5c5223b51d8a7e71b87565496b74bfab1aeb526428ac3d6e6e10"
+    "a9ad8186d4500e9a41df7439e6b3215d5960e93191052ec649b046cef5cbc900"
+    "86c1917b803ab89b6399651ac12450d9eec940853857765e2c716c8ff9c68c83"
+    "9d5885ca001c0e846799be7a16f41bbcd2520c7758a509c127ca996672661d30"
+    "382413d091b4f7e7a73b82442f1da578e4f328ebde60040b2b93f15c4bd52a86"
+    "39d58135116afee521d80edc3c03a098b9e45e764410180ca38241ef55c82c47"
+    "ebe576fa05852ef9d61bcbabada76f01576d93c8e5b8d517029668729b136cd7"
+    "f822838c76bc2e6c096dd8823d44ee7a0438875dca7091fa7ca878fac415be31"
+    "04c2793a852557783fe67ef8d52bb58e8751733a21a8aadd591e313ea6f9db85"
+    "b1caf5634c4f24ffe445ac6561c9cd72ae006605546383adfb28f261c29a9095"
+    "e1479c51d1ad80fc175b71324408c513a9248b0f236157053298670c1205c2b9"
+    "05fff081dbcd9597520e3888aa45f6d8c9b17b397cc287e5326f40384d40cd2a"
+    "2c17bcfba43ca8fd2d20b1cc9e9ee0455d0a3b71592d6ae11690b16f016f8c2a"
+    "6d9ed5a37dcd313e700c651835640501c90b5c056e054807a41cf597de98d50a"
+    "6d5955b1e5afe4519cfdee0732fe7de8dd78cb952f3ae7077ba0dba3496d567a"
+    "8653093989f7ad6552fedebdd674a0b29873db2085685b557acf7cba940d833b"
+    "30ed8ca8777ae5a586dc761be64c57fb6ba2b997398261cf7ef974d92304d630"
+    "b6115d18ece2f0200e9390def8fe4cffeba9e6bb542784ce03821c71395198d2"
+    "a6163700230f6eb4228d9ed541a66f5bf2642816c8c9f43d0a04f7ebc980401e"
+    "8037b08d68eb736f0a528fb058a72ca2ebe61f233dbe9182aebf2194ef368fad"
+    "9279c059088adb72fd73f33d837a5b932f52490aac40a4673b26401b7ae2e83a"
+    "b28761f3d43a95b03e59133f6f09f4fb873cb1234c77be35e68b70c19cfe4e38"
+    "48c01970a4d1fda667a585883f6b7bc7fc265e9d6c1f7047c39ed122cb32c4cb"
+    "369f98906e406dab386566de4a44b63941549a99b04cec58c0868da66cb9d497"
+    "4576ad27683c64d71b33993702a41e39692fd49ad01d3d64bdce2b182f92f3f2"
+    "878db6333ef232c21212caae963bbce7c4da92a699902f834e3dc0bf16602ac1"
+    "ba18ff220d8577b6ac6cd01acd129f977869bf1f7714c41fb1201f635dea2665"
+    "4d04bd68139955d082fba8115dcd4c68ca929d5bae16f00655cc598f16db06aa"
+    "1fbd8fd38600b5ee8039a3e6f1526e49f431043803fe4ecb50378cc737ee575d"
+    "f6bd8906907fe6554e75244682e9601cec2282fc45db20129a14607d7bbc1962"
+    "2fc2836958ce98b1e44fd9495d757d8bfeca5f834ebaeeaae83fa6d485f4447b"
+    "054507912f32f3545e2e44633b43b0415070acd21184ffa98547cd2a09c19afe"
+    "0c58540ec68db25f0b87ba4781450073914686d098fefe3dce9ce2f0f81e3ecf"
+    "39d2416ccbc53db18fc9f52ac30984a387b50d43a844c4aee9b2a73ea7d7f6cd"
+    "b2db9042061676ef461e9813dc6680b44d27488a5224a88b3a5c49498632f1f1"
+    "999f277b370346c76a8035ae2961b004a2b4fd2e2baa49af2b74915bb44a311e"
+    "297ef9a0b64695dabad91ca69c82e5748dbd7ac3e56b622a431697fa829cade2"
+    "37b58560de3f5ce99c1bf4b8b12a199d01c2659d111f6b06e4b196337f9b3dcb",
+    /* 2^85 */
+    "4f4615c4fd61392779444787c0303a5f35232e5a23359ec3d24504ff1f0bb9d8"
+    "38aaa6f183a3f06773ccc4b9feb934fc8499a276f95fef9992ca82d60d11c808"
+    "3c5556b4bae2581ce0ac8eb795b60ae297c2dccaf4a7f17dcf68cb7402385a00"
+    "205a937ccc972a8f01c850421c0bbce33f6bf8bc233c2688c73da70a7e3a3765"
+    "65b9ae3c849550720a2f135d1a590bec6b791fcb892a082fe4057b9991e8b10a"
+    "0d7bc6964469b86e30a770d7c686b03184d22f79eef618ba85411d13de770eec"
+    "ff4b803c52fe84bc06fa1af8f52f640f19431c45fa10c457463272209b196231"
+    "e06bb9db35609f5a5f17b939ad2841b17cdd4a93fa6ed423e4ed9569bb07d1d1"
+    "f8cbef97994e536a882e4c3f0b919ac1e507561a64d27d8b8d9f28507a2c7be6"
+    "e5dc9bd3f4ed10de7dd7b405796979eac5296c5f1caa103ff16c74ab0517faf3"
+    "a59537b95045d968cc9c523ed17482605d86dee0f7d67a6545dfd6d29a7fef90"
+    "0afa82921bea3b090740e33f0acd26f67b46b074072f80e95dc7aa3d1220483d"
+    "23cf40d85ae5b13f8dab4df249bc41d9d375c9d1f821c896655506bf96a87e00"
+    "37880e1fd13b7716310c1747e56904fb97ca8f484a711feaa1e7c842fceb707e"
+    "83b91863d7700f7ffda152baf3759f273ab08696518227c6d73ed2219701a5a2"
+    "609b1f644c3f301ec679643a47c4a8a2d94f96bc0104de4baadabd1538268d44"
+    "5131e1c392a1cc1670e66c40726f635bb37f87fe9d8a831965f493ca18bc8901"
+    "4d3abd5c971897ab630698e385f6bdf035ed2c0d6ca2000425319088161ed990"
+    "0ac346c95b4955d1c9e6f5781f6ca9fe6dad62669d4a617ecca0db2d1e3e0f8f"
+    "54b2035b7b26efd48ecd5aaa4b6716b033a9779ce0231e1848fad87582faf6e1"
+    "dc6701363134976411c45ecddf236ba0597a430ee5f1804fff231466b79f7b59"
+    "d94e4d38453e87a70959aeeff9dd7c59716bc2bfe7a1891dc23ce101a8661385"
+    "13501fc25f674c59a460be69f26d483f26bce3837c27b34a379565361330c081"
+    "7218a7bb9d56290f6b1082ce8734847f45d82878f37467d566d37008463d658e"
+    "9bbf0ac228131cc18e219593c0b55013b4201b62fb44800b26006a8f070d378a"
+    "4cd96760ec0a6ccc2be973f4641a3df915f495a4bed2913364305a4e77d12168"
+    "db8f78e636ab7af5bd1280c682086222e900e9178e108092bfebdea49ffe924f"
+    "d714432a20f6d4ad2aaed9dfaaaae0068146250f29ce58da101347e23f345641"
+    "70f6e4b69982bc342df53ce80565ad3f3883ec9381a798dd3a168092a7e54111"
+    "df14beb497f693e745db712389ed8afb7c41d86b72b87c8908b8b72c327614e7"
+    "e8957ea5d73ad5e626f355f5af562d769b24c60bc5108e8ce1f87a8d8ea79a12"
+    "61a3c22ddecc5a835ce605ccd9054b4f99f6ca47eddd8a41c5847b7f6f72f624"
+    "e62e4da653d3e62b16d17ee9ed67ef901967502f0d49210217ef5899da3c2d9b"
+    "a12c09480e17403d452abe087c45549abd2de8a12822a72a1860efa5fa61f374"
+    "0f2aae850657fd5d440e6d21f8a4d23244dba3a00aaf6cbceeef162ac2a5965a"
+    "d7dc789c2c0fa3de9b28d8028e6edf4c4b6056f57da3bf6d1909e819bde21d11"
+    "9945092e0cc70526e2c4718542e4421d7a6a82bbc804e068f3a0c5e35f7f4f61"
+    "0fe8d78bb6a0d7fc1a2dd37fa4529d46329dbf84ae1d9ea5c4a6ba4cb68dc500"
+    "5094a7642f32537cd6fe9d34f37708571b8bd1a1465769f57d1e480a6e737699"
+    "806e7949ec45e4fbebe412c1a5150067b5e2273269968e32e04b29107940e728"
+    "69a447e1717bb785f85f3e63463189a3e5a0c94d8318281a807d3ba4a09d18df"
+    "78b387c73d7d1259261d389b2554105ee5278edee9b55872af07a5a7b0b37c34"
+    "0ff20685a3dbaf6507c3e1f0e445d6cdf51b06d4040f3606a70968e1a4793b6e"
+    "2d9f856fc0f190d920203dacb9d4e1a2fbd5ecca2ebdc489617e6b344d8f1921"
+    "2c4ce6c74b87dcf98b23b3ff2ec58f1e0321cb6687b8e1c1c070dd0b2bc54273"
+    "5fb4f62615fdae5fd872464d87273193e625a1ad07468eb383fbc97200db0f88"
+    "b5d3182a06ed9976566151dd0b325a8d165f07649fd1ac56aa53a25ad31a3315"
+    "a68e1d8d160ac53f96c59738da65619be60b693c20e154304a73c4ca97e22318"
+    "62078eff7c38f828bd123bd2be16c2902e359ed3691929426e027d4409459686"
+    "abe6385392634e1de072a7e2c52298e18c34b5547090a899493b90a295d14f6d"
+    "e50ad9945b225929b85a154878c708ca833d3ba56fcce23525e5896839aa65e0"
+    "ebf2af6f04d95543d6b0dce60c5282743b9f1ce3ac66c697610a0f5429d75ac5"
+    "4f7156b8905950269e01c3de758dc65c9d7fb8eba8732cbb9947df7d5068dc76"
+    "ab295d768c9b2a3355c20a590660e9e912e3708e887d2c80c0ccf510ca50417b"
+    "f2e7ebb1cfd13aaf1876ad35af56dfffcb8fd93362e9dc4878321a4a157de30a"
+    "74c55faaa564fa6817f76b4c8ceee7c6f0fa95d76b1bd914cb390c7a5007946c"
+    "11b2c1c8fe9abb865d0f69c538031824f07efd26adc6d38aabc8feffbb440735"
+    "16bd38abaa526f6ebcf2030672683f1ca5c0780c33389eaa3f329b7be9a19e05"
+    "2b10e6e3a696ab53c39f0a9ccb1837ed123460e1972cf94f73c9355828319569"
+    "38804caed46e46df777eeed49e28e996f5b8dfcce9d0f418dcb776296806f87f"
+    "d73c2842adf00034d8d209a51cd8f3269f4a8c2c82d43cee0f45c3c2ab4f70e1"
+    "389a190cc32a101647638824780bbbcb30fe7c5cc0d5c2fb9999e405970dc548"
+    "8eaf840faaffb5b87366b896d6a0e67342e5d25e76d976e317bc06fb6ea8dd38"
+    "45b4c674b3e9352edfa268c9b862c771ca2ea56ee49d3e084b79ec8fec2d7bef"
+    "ed5b9bdd67cf270075fd16338ff8626cfae885446c2922db04119d1fc47a8903"
+    "5cde54346d58ec3175a8f7c2c29157bc6db10c346a88edd6520b468d0fb09cce"
+    "d4e66f7a0de05e43e5e1273464def3de43059cd73882efc0fd86777183671e68"
+    "f75939c14b08a20d1d442a912099a811ddba05919b5d467c689723837a6d46ae"
+    "858140aae1eeae8cce28d44950188cc2f86c66b1a5d61b195c8063471b31afcb"
+    "abc4ea1f7916138cd4000fd9cde733d9560d262bf8cf5c5f991fa1e6c594a405"
+    "a7fb32aeeafcf163cadbeaf9852be6989d64e5ed4c1450ef35496c9f932fb7f3"
+    "3717e4fde4812fecff98b1e476b065ca98805694ca1e0f802552c6623c22fc9b"
+    "8e279eea33f780163f1ca2404363e4342968ed43bf6be98bd53551884108295c"
+    "cccda14a3e65ab183a6fe72db4cbb5d0ba3be14c7ed165f2b65b322599a447cd"
+    "05402630a985cbbe222148de6f9d3d5ae4222857cdb668a5b4aa35f1f5717b5d"
+    "7609f2100e4d1cdd2c9b0d1069cef43b762b5d3839faf30a6b797c9117edefbd"
+    "e0e8c8c2df0b21ddfd39b4e7d3e57e4b3f44ee91c585d2097f86f6786d7de81b"
+    "c561af33cda7555d486b6ad3e29152c31fe5a3504a412fcc62f8047276e4641f",
+    /* 2^86 */
+    "d09b6334fc68b6282cd6807d0180377933dbf1d5c1196640fe8b5a8684e50e6b"
+    "601439f6ec17be49df190fccde3f1ca7ee850ccef188c7f597a883688972a3e3"
+    "9ba8b1304c7220ad0a92921fb56b4e0e4070b3e59d0f96e99a06fa91699d4c0c"
+    "a6331efaf4d725db0a19a5e527f23716ca40bbaf24553ae17daec9ab595427b1"
+    "0b544edcec2a3b6b5cabe0484918d6f57caab8dbbae56040c8d9a16f6cd1d14e"
+    "1f896403cca6d2571626f352a151165bbff3d643f42a6a5e6412ad3a1f0c1e36"
+    "fd9cd8a5fbb0d2f1e371dc72727ed311f2c3437f72c0bd5dc2b25213ec6cf5a0"
+    "6d3c56cb458a281c345703d56ce92a97a1c51021f0fabc728fce697945daf5f5"
+    "042a692779567ba8ea62615a7e89e55f62aaacbc0b8d3e834f5e3f275fc5fe2c"
+    "13ebc675bb51c5cf5064c85c05630376a5e09922a641518934098fb22aaa44b6"
+    "108c9f17af2e094bb080523ced378d24a59b4639b5b4391a79aef034d769b8e8"
+    "48bad2a55326329beb3132ea3d4a2aedc6d0e2697169a874d7f81b718528e4d1"
+    "37cd2d2d3d83165c3bc076749ea6c1160dc961302edf3172cf0d5e76c2babf24"
+    "eebb1e8ea8a72c1b350249e483a5c630be2793e23d45ee7320c22279ddd69b9e"
+    "4c18af7b724fd8cce838f76da471e1d921a703723c21dc7e1683f786987afc27"
+    "0b561889af5da659aff681f35cd5608152f8c3e617114ebfc36f74e097f5d0d0"
+    "3220a190bcb208b55981a88c2b81bc71befe95f8af30d1f75a4ccc4990bce6e8"
+    "ecb6385e35b6a9311f41fad137cca572c90619f1dbe227cf87c5133b881543c9"
+    "19bf4ca5e9b4ab3bb6ccc5b03f054fa66624c6c2b6a1605bf2251d10fd9c6cb5"
+    "20d03bec2e8a548c566442f5f009219fe112d81c5adc9b256b5b099f6da321d5"
+    "8eefa3abb9ec621fa827745a7405a24bd40dbbaaddad3b189ea368281a8d7da5"
+    "40e9393daff4cae09033d1e733a472964b90d1b06435043843d6a25ac600d8ec"
+    "724b2e188c1182963d60b0a047b6d831948f925c2567fdc19e7841eb3ba047ae"
+    "4cc7592a7a6978db6f2c7eca48912191ec3e31b583830aec2f42a66b6d91cfd3"
+    "6d49d550ec52d36cb6195377746e4b5e5c79b66f1601e3da411683484218b8fd"
+    "b1132cdf513c78bd524cd189279dae7459eaa312092cfb54357f4ed7dbae2b5b"
+    "cb90102bec16bae8796b27e63dcdda6aba4a066761f220280201b8ad9dd99b9c"
+    "7ca7006af5a2314e9e93d06ba7a86e9336a5a5041da6e3e28eb0641e70a1ff95"
+    "b81c85a5dc64180952206c9c0eab2d5a8248d05f39ae331b35905b045f80d590"
+    "6a3c4a3462e2e007c243658519894cfe5c12096928e02d96c44e18521910ca94"
+    "16621555de6810b2546876292dcae01bc47cdde714e5f8138f09ddb52facfdd7"
+    "f88e1adaddadde0cbf445c8fc0ca17c04a8712d77f78a54ed98c18d860f509e6"
+    "4d637afd73500c90f28b022e5baa83bca5b54bfa0a9f422dbf5027caebac6f51"
+    "4dabb578e3386237e020c10a7c5c3634b6b6cdf05e8fe503a5a3b6a84ccfb2c5"
+    "6e17a3caf535899eca6204dc017c8794c2ae7670d87783dc1109c43aeca70bc7"
+    "547cdfa92456cbc206ad2dd57709eb5db690763c743509b578c40b6d36172c2a"
+    "fea86a28a0f336e0bed0e81507e2ded29c2e9f7cdff934584ec43afc4ed5bced"
+    "3ea73d3cf8c2587f9a2dc8df3cfae2322810ad7b024851175ecbb19f76acd58c"
+    "4bb9c1491832811ed5cbe6c29b4042d9b77f20243af73315332841222d06f4c1"
+    "bdde27056086ccfb7ae96726f8cd26b83964e109ea1436d0f106ce4480236bc6"
+    "8ddbed6823039c02b18862f4efc632663e47c257b602a5b8035690aa0266fbe1"
+    "f770f933e667520feb99451db936ea895832d74e3d591dd1d90ed5c77be4c33b"
+    "f12a1c34d651d5dec060fb3d06316c3fa09f1295be53e1683d3e46c446f51f00"
+    "c5450b44b0a564927a0571bfc2ca0cbb98be2c72eb509f9e619b50502d7537d4"
+    "47b69ed9e45902e5d73682685094dbbdad97551499c740315640d4495982a7ae"
+    "69129a0db117d62ba189fb8ab0d29058a719d264a42430c615b734b805458c55"
+    "c4ee659c37c4c9dbf8380d8fc4600b65ce9b699dbf0ea46783258a807fe476b4"
+    "eb749d878a2af5bbbba586a9112667095b0545c9d89626f97e5f703ff47eca1e"
+    "f69391a6274d528feb9e3eb8305874ebd8b2bfc038191f38520c62e934785a50"
+    "1ecc5033a78bac4e07780455e76f4ea49746847546e6f0ac8c25c752d5b40b8c"
+    "e03da1677f974835257422fe12124638f2ed04399ab794521543c260557a4ef1"
+    "acd5c43697dccee8e18afc4a493d7601d4bff7687490e72af12a71c853773017"
+    "118dd8c1f1036ec1085e22c880363fcf7cd926c90f714c77e0e4e716ec63098b"
+    "9e98b9d67566ac62d6defd445722972f3e32979044254837e01caee04e38f2b3"
+    "8c842eaa7740363371c59dc6518ab5751882160c097af54cb94c263e2b9b4afd"
+    "c09a570a630f5b22bae2b94ad46a59e14e063cb04fa20c6c0dc819c93508f6d6"
+    "56c2a2c58266ce4a231aa4153bc77a5708628aecc6405b750c3415b3c49f2a05"
+    "316486e30369d8ec81dc2a229b0841ddf5def4943679363d9e734677b33ed22b"
+    "914d89ccaf59c3bc1ec9c58f320f9b23b70d097eb85be9cc5fc90524ebd9b0ee"
+    "6a19c91b3a13d9fdb623d20bac29a486d1c585fc0c4c61b637192dac93d8cf2b"
+    "ddd19cda2d47e911cac0e7492c734f32df5935b2cda76ebf5ecdfb698c333925"
+    "6a7daa2172496dd73d2b602fa23e94f6d236a1c7523eb754355f41ca5f6fa01e"
+    "22c05b35620751baf51665eea7b0db374af9b75773b616e72480e8b14e7f6814"
+    "0bd58c46d0a3648059f92d20b406bc93f81c6e217ce9d7c71bf7a0025666d2a9"
+    "024b36efe31d707826240b0e418dc5caa1d1ef093d678964381d56d5787880fb"
+    "df31e9d0cb755f2d6721bc8ca28914789ec21906ff1ca7dcf8e7f0d123bcf2bc"
+    "fb73d5a8e45a692a70f33bfe6798b4dc1052e84e14cc0e289938ca87ba925704"
+    "9f4568375eff02354767966f90ba64a8b7b363e08a8167c936f37ffbf3a0fb63"
+    "b118e83d9da483e9c78fb586037a9307ebb4e0e4adce0762982b4966788c691b"
+    "d8c4cfa083bb459295163cbd8296b92719619146eca07e20f18fd59e4f17f7ff"
+    "5ce879d1db131d95f77cb98c15eb4804a9353bf8093b70f81f2243a42302658a"
+    "7946f62fd28761058515c97ea51e5b03135d011dce92e1012ff56c16d33546c9"
+    "228840bf7555f9add6e53a14199ae33b8c88f054c00b993704ccf268b6326b71"
+    "6202e074d278e0335daee337c2ac25c4a188551bafe25fb24bb7cea44de36785"
+    "9f78d1a5c71490ffc881df32b05cd9d97a22d18af073999358eda4b217a19b74"
+    "7a97e5256f7cee8ac9934d188e6c01703ad7f57dfae16d56b1c1f4ef8dd7b96f"
+    "343ad2eb4c491d77419dfb1a72c0c0a600b21919e35a4f6c916d7477c1687b6e"
+    "1f3b5d9af93b73a9da2c940268dfa40f65429a15308134abc33ecc212e532184",
+    /* 2^87 */
+    "60eb5bafacb19330fe2ed68f050296b78169cbdc7e86664d3acf7a0370572cd9"
+    "2ae3977f209ae305e09b5f266658c89c1b570654fd59a094328a8bdb28ecaa1a"
+    "89c2140e14981cbcca93c5777e230b3d5c9f9aaccdebf52f51dbe507c68f50ec"
+    "3d52a410e1f5c851f14a5db2fd45a71785c6b43ffeda37afcc092cbcdb0cac1f"
+    "da8af44e0bbb87745c48d21a40aea1fc67deb2a76c20e7f2d7d2726d03555055"
+    "5c36c52941e49ffe3b12e5499de17ba5814b8da8a3a4920dee93f765cd5e8f6a"
+    "32d857e9a4d5e492ba2dfceef28ecff4b7664049094612dd0ef2a0811f30e033"
+    "1ed4d8a1a5659650ea5ae60b40126fc62288cb7cb404d4ba470d8d033572cc3e"
+    "12848e241eec4b70f86d42665fdf6ae6ec66bca88d6cf2f5cad12491fb2c82a2"
+    "5731ad8af72ef371a992516354b494bbb3d251d86cbc2f6448a973a9dfcc9b63"
+    "710c9d7047a3f4b918d596560549e4c6edfdc56866494ffc792ef0d3627e35b0"
+    "062ba42beaa24a52cd5a5b3205f111c4edbea3603373af74c54a9b2d68600190"
+    "3cf7aa80f46a75d455aa6301046a10b92d3b0dd077a92e3c273be161b50bbca7"
+    "8fbe6c5f0d2c7e2605472464bb4d282a7b340697a06ff70772c4eaeff3771594"
+    "78a9235953ea55d09ff27603f285899efdf075676c815eac77450cfcb78b7262"
+    "12fefdb8d380ee46b9e6dfa145408a090b12cabd839bad8d9f8c296fba05ce39"
+    "72c8f0e98d3e2714742831a42f76c4d6878b6b5dc22fa76faf3ccd2d706eec8a"
+    "6d7ce00b4ff148bfc6975961db4da1a9d152708a4dc49c5928c2b3ce812bc263"
+    "8f410c26e50a123cae65ac3878beba7da306855f53cd9e90e1d589c7ec5f0813"
+    "c0f990ff566d3ab466a7bc6123651555da1f4a32896b5638a765a3b6fbbe4d51"
+    "58bbc33e4e80460d2ff801961f663b19d7e28657a6d483a8d215dfba6810d83c"
+    "8468088ea83e37e8fac56bb773eb06ed753828d4be36dceb48f883cfe729f3c9"
+    "4f37d6fe79ac56a49b491a1da89411518892003753026f65911be077bba684bb"
+    "f72051b7e6eda3e377e82484aaec11c9d507520a4d0306f8f06382238fcabc33"
+    "54ebb754591450c748e424f28a4a22fb8ad7c48638bf4470f0a5051aba9e114b"
+    "6bb79f278602033071618478f8b46a7b19037caf2d3f227f1bbf34b868a02d80"
+    "22edc53ce6fdfe475482a15fefc533a43652c1a24e710e082bc0826c13f72493"
+    "366601411e09ad33e482218c6c949cda829aae79678c6e3a5eaf2b9722bde9f6"
+    "1d85aaef3246996c7c63d92060f1c00f0608b2044b9d43440103c31bd86dd0a3"
+    "28478ec7782c9a91e26378f4b33453da8a7e7c9fde6703343397f65b1e4aa3ff"
+    "d00caa071878b29819ca2ad57e7b5f6352d576cb724b682a4e19710efbcf191e"
+    "7a72975699c5df70f0b422f46dccaf35e80cd6a5a6f1609799c2fef266e5fb2c"
+    "a92b5143b003ceea69c5f0d9bc5d544880f15ca3bbbbe2f2234ac2872fad3899"
+    "64a6d41f9055dbc6ba1856324f490c64f98f6ebe6d17788129ceb2b8d9492244"
+    "ab94190adfd12e2514e44331fcc77ab8a745c308446bc4ec278f5fe527da67e0"
+    "341ff94af30ad94c707aecf209756e3ad579e70d1dd53ec53f2aecaf963e0e86"
+    "041acd82e6518c54588313789fd2d8f7f4360f94d7b4e824867882ac2dfacd1b"
+    "ef060c43d06c5d1f6c05dc0cb3fb5f3d1f030077b0358056699d4786cf888940"
+    "87524757bbf1d0b596212f91e2e1ba5c7e2624bef00fca1bc4d7409eb20a6d8e"
+    "02584dfecd3586092ed3893ef667e2e1d409150d5780a96b8b63d840028b094b"
+    "508af271a7b954d91f3e6a665b2999d0f866b0e0a04ceb4be9a2e57888199887"
+    "ba41901a86a33eb3f99e4035ae4ba1f631371cd5fad84a67e2a38b41fb2ca4d2"
+    "b35aa27d9e5e80a6288551487948954b6ff0d8761fef786ee644696b7435c8e1"
+    "bfa4dfab58ff0f8213a115de9462a992aef5aac400f65da1432d1b3d6cb78b1c"
+    "9b791415dc7bfe6e3eb90e1582b4aa8c39f0c27f4cec044fd2cfb5d542860fda"
+    "ed6c32a4860e07b92d5409276aaa277d7045946eb4c79645fa86dccecb9bbf57"
+    "95f8d396725487061d23708ddf970b789fb75da8e183506257493b0ee9c5c1b3"
+    "812ba87235be82da64ccebdd2202e82350627199044220ee90c9c9b2eb7472f6"
+    "3f50dbeb90fdf8f52be230cdc85759a2d6193ae3c57246ef10884f5ae83549ab"
+    "7c24c3a64c5373dadcd31de11d3dcbdee7552e5ceb1c2be89568c6cefcf8370f"
+    "37507c8d48c7db2dc7964c84d57f7896eb1518f09c77a5b4ffc930c143ee7a77"
+    "03f2f0d196004dcf5d55ecd66b6c12d00ea3dc7bda89be3c492bd11cb347ce6b"
+    "2d2cfed4afeffe951b5b1377912793ab909e151b1abaf9821f422394aad31edd"
+    "066ce57199ec77f5573a6a536a807616eb383f0804816968634e56e04a595705"
+    "37d9e3193c043afd62c4605852946a2782b4a32707fcdd0666de397b07632fd4"
+    "9e7ba65d863bb018c275bd155be547e1a9061fe46c012591f3cdc88297c3a12d"
+    "a329c94509cca91a3a06ee8b67ff6bb227474dfa143aae947bba862ae2ecdb8c"
+    "5ea1a4ed9fa7ee7d7edca3c42de1cae5c12650f7123510fbb32536cad1290b69"
+    "d637c2307ef766883dca7d0c3a023d887c882166b5ab622993f06127a12e4b9f"
+    "5816171fbdf7178795e959c02cc654df29113efb44a777ae6336c880ef20bb3a"
+    "7ef4c31a9ec9af1137037fea49d3286ce1e8e3f3088458e02d262b434c74fb1d"
+    "b7f5eea30cdeb21da5f000c0c0ab3b6fd88932c7dd3af36b432040c9859a8183"
+    "39ee79ce0b11a4136e64e5bb8dc051f1ee2fdeebc7545e2ea14b6c65dc4d15e1"
+    "b149c95e5d5546d94f3a2e53c5817a402e6491a5504c1ea46176b72568e13cc1"
+    "ad1138930ecbff2f7ec570a9d18be83a6b1dfc7d405f361b2e77fe28efcf3e4f"
+    "c14065f405bb272c18a3ebc5bdf932fc6e2826cfcdbbd26dc77c3572de22048d"
+    "34effe7f5327c9405a5f961c13f431bdad72ce5d810cb4a9ab3a2e3696f8080a"
+    "823b1eede9b7e125895220c02a609cfa9dbae09ac5db7707da205266ba14d777"
+    "07a708b3924393470053cf46c065f570dfef6770af15f0dcdc7edce527dac784"
+    "b726a8f48babef9635bd43c93be61d84cc9bb5e4255309e0fa3813ebab68cc63"
+    "b7843f4797ef67cd1120afa632d7495c3271b3558bff58f6bf2e7075237e2893"
+    "a6ddf2f3c7cd592c7fa197676b3c46473d6faf72c489aaf0b643c186e65f7ed5"
+    "53945efb117deac89b38328eb1442ed09a8053e019641e19d3da0b7e703882d8"
+    "4fe92d147a7d104ac75ebd8d1005071a9fcb1d79a17e330a5094bab34a373ea3"
+    "21bdcad5ee7ef87b762f5cf1efa433240b36202a18162125021092351d9f1986"
+    "8cd47248c579e0578a8ef47255de99b78e48719709ae5984cfc3f1586cef9857"
+    "d740b49a3dfb161308858d5d33946de8c59d2474f7dc65b7b142ccdaebc01624"
+    "51eee5094829c2f59c5bf3cc141d45fd500a40553d4a6027eb0b66e2e2e6259e",
+    /* 2^88 */
+    "99daa839cbd4c58eedca0948d7957e357568e84e5912f8de1d79444358034cb8"
+    "df5fd72000e1a986744b48b50b80e42e1762a38f3a32a7dbc6e4601b653c688d"
+    "9c52464abdd05db27a32e14952312d0ece931ea0b769148ebe203380f5f732f9"
+    "514685a010bb1233cbfe3ff9ed483f0ec91c4bcaf7f88cbbee4127c551de1d7c"
+    "13fd505b61c977c45382fa84635e416a8505804b4cb6b49aced3b63b197581ec"
+    "475cfed25d089a32449a7c5adeb5fb41324d55fda50fd1fe15f394c7f7efbb69"
+    "7175c9cf5eb565fbe096a7d30be63daf31261e0dc25db8f07edc0f331c2bc84f"
+    "d5150a8e4b184a5e249d7c78de3abd2198119ddf94ae9a3f3b5d97ac0c803172"
+    "f821e635585cd8bb870158726220bae821a816fa9a9a7b7bf74bc920eb1f1eaf"
+    "83dd2787744e1d67364c57efb5f9d3a90e96240786f0baa06f23796f74994b8a"
+    "e15ae772135b507d01a647cb9c5d81bc1e23a1468d50f2267417ef4167e35e69"
+    "5c073ca3fe61aa03a47a49cd11a53cf4f15073635dd497fe643d382c456a6674"
+    "631baf102c3a36b78596557cd7deed866f81e59a0e463f072e4da9dfc0adb7f2"
+    "a2aad5cc63f72fba5a9bb483a926a2c774ab696c4978990c3f12c62380438a25"
+    "6dc59c6a47dcb23606b7125f100760fe90387a11011d0dec038fae6430613e37"
+    "19b7987066c530618667ef75c8624142575fc45ce02da0cc0597d82d0c1e53fa"
+    "5ebc4498d6d5b039c924b1483eaa38827770cdc6dd4ea8a5dc3d2e077a70c747"
+    "f147ff83f828ed4a17b45ce46364dffe13ebffe49a98b812a631bd6edd7ad8b1"
+    "90a54bf6333def3f67ede4894bf4305cab7f2ddd0f4be093798cf24c7c22edc2"
+    "d78a0597cc62614778595854dddb4a4404581db51e2e1d3efd17173949189dff"
+    "9a856dabad022a826a2421b334591d72f03825dbd04e53d9d124df2ba3b20ca6"
+    "100cd678a7862f7c5a3f5b0a03f8ec004d4663466c63e57edc92bbadaf6e46eb"
+    "0cb4d5ff5c080967fdd6d8b4a52a2ca7f9334683bf8612acc7b664508b881386"
+    "5b13f9b9fb66ea9e7d695c1dc07dd284a56f246a5ecf54bffad6248050fca347"
+    "2b2c5cd85c39f5ff35e63de7fcb35d289e90ca8a22b961c2a27aa14091419877"
+    "71087ca6ad394f23974be5548d0ddc40531423c2582f52d64b1755cf97af08a7"
+    "1f5a41a27b20912157565eafc258c43fb293b8d3e4f47647232c3c2f220260ae"
+    "0b4bb462651138322c05da8b5d3c0c12128ce59b7eac596cc4d20bdb8cbfb6eb"
+    "6f6882b79d0e0ab6f4c9d9f53fc94c409876014254e1f4f47ce4b048d8b22a60"
+    "25a49d91cc842ae3997036b472cce9214fb4808d87d19afcf48c2340b9db1ff2"
+    "be8721a9069255c221e48fc6810e2bdac054bb178b96ae821401969faf194090"
+    "d73c98b0e722af67e2203784c887d7ff690c546cd71c7e96aba8db308ddc3b60"
+    "8b1bf2300576b7f36cde14ff38e3e38c0d64fa4e4ad5d52018114091a7ccb556"
+    "a9255bacf145d1eb368e58de81448a6a8cf9a63ee3f6fe8cc36b509241ab6b45"
+    "451cd4f8c02c4f60d1c049041692abf76b228252aa947efba4f39dd573e5f09e"
+    "eec797c7fb2166e5c94b6077fc34ddbf8a743f9d65f7f99b4c084e5c78159bf8"
+    "b6017f4a196ac9d76a40712d4936045256557a74d0ca0d3081320de614ea9269"
+    "dac5e3797b4cd681b11fa14572362b76d0f969d39816254cc9a344ee98a904cb"
+    "9596c60e27bec7d7ac74e1acef57253460f29ab328126ccf81e71b18422398a3"
+    "4217c073414c008ecf3e0b34db272d7851591da719c520f46716643d273ce3aa"
+    "2ddb3288c625caed24dee6f238037b1851ac73f1a1532b93684d093e2596421a"
+    "8e9fc3cabd1b88b3eb1f502a6e0607fa45378b2cab16974b4a7d622912823899"
+    "716d7ef7eb62a3b322ef6e44d6a80a5d4523485816158c7aa6096572994bd45d"
+    "12986efb6a43777a47ced21f2a7633f550d2e9fcfdd12c243bea9adf66834c90"
+    "e3da7972b3082cc952af303f5a0556034dadb7d20587a3b9a4e2e722351a5e36"
+    "77c74ef598dd60b5b9908cd8c3d2ade9ca6c72bdeba506007061f0e400f5a88f"
+    "41cd1da2a83a9df3fa89b90999183bce7a5b086d0a4f36326059c494355c2774"
+    "fe955d211ce6f7506df7cbeae5803bb4d833cdb1c891cf27a964b7b1a3079b5b"
+    "1046c37d52398c1bdb9a1cfa7bc1dceb1c711c95443c4445006e6bbacdf4aa54"
+    "f6e15716465728c2abbb6e9cfa3dd9dfd65b7d9d65404a0ad1103123d5820f0d"
+    "1dc1e7f282c4a08039c53ab0034c710dc427038f56d5938865aabf4c01f046cf"
+    "36ee30b27fc5a747706c1c40fee2ff417c1135ad3c53877662c7bd27258bfd81"
+    "d049c8e9bf024e34c5decf8afc6500cb209f9989f9550bcf5e83c26abdd28e1f"
+    "0917f04373c597440eb2eca8c6087d773cbb1182165140c30ac775c42d835f88"
+    "9b072fcb062ebb7c7786cf795202276582fd9a029d8e455b5a27fea7f8e71d56"
+    "0c6d522c562c91711b7eea8324e3904a29a105d7fd137c40bd52f26ee37871a7"
+    "81c1a34ae376fb1e886ea7a7a7ad682f2edb190d5bb0291f55e7cfe804d13425"
+    "dff91395337aa0b40281748c9082808b904fbf655d85d80652c72b59f2e9f9b8"
+    "1b4a0884822c63cb23ec4e78a337f40e4fbf333ea9337b231404c500c9dd544b"
+    "c9713a8590f28f3dd8c8f532f4a0a9bd0e2094e88268fffdcb7f85f877711673"
+    "c586f1bf4c4333ceb61a61e166e83ab071909df5ccf16843d67a0971fb0af502"
+    "27c9924e958cc1f1b43b477b498ac742fca6c6119d70823a27f161eb48384fa6"
+    "94a9080d2d1583aa2aae073b7785dab25d951421a8d99ca8b77b86fa6a6d406b"
+    "b6f2ddf5fd227dc34c8527a67b952232d7687e3ac6c4a5839bff250d15a38317"
+    "713d7d120cc1aff1ca47655e1d215071f805afa9302b2ca9f45fa0c63e6d55aa"
+    "49a9b44a0b2ce4320e60e34461ce15e22d7457c58d7b46de68f985521c3b2187"
+    "af154821ee9e14262ea9b5946f52a85695f375084746e0eddb419364c15de95a"
+    "ac3f4db2348dd66b2e2b8d85147b3d288d72562ca38f8ed5c08cd5fd9f773d01"
+    "ee9ee7844bf1c82a927fe245c5ec3186160dbe03862e43e5b3613038dec22f57"
+    "442aa1d2a29fb4b5372714049123931bf2ccc83061190e4a785a3ac3d659c1df"
+    "7e8c7b817b3b4ec9ad38b2c931dd6ea50eb29785d082f67b305d8fcc8a462fad"
+    "fbc9f1b523b8fd886166440f71cb70abe4a82cf1bf9552fa6ee89f3dc33cbcb3"
+    "193e17a5db0a942555b17dd46fc9cb762d8233caccb5588583757c4c769394b1"
+    "53c0ea0e59c2cf96212d65f6bb266dcc4f4e5bac987df2474ba34fc8c5ac2947"
+    "d8afc7df9d085164825a3c288b863540cc9242f1c577812533c0fe2d6054d39d"
+    "25bb9076002cd853d0fb36a63b99885faef70973c085fba2ba799943c4196238"
+    "5205a56bb705d10ffe183e2d5df1ce85391e6fe5a9b0fa7b0e03fd8ab19fa692"
+    "6fb6dcd8f47b825027691e1d4d59f9a839bf4de833ce6b175ded663b7bf15e83",
+    /* 2^89 */
+    "08019305d709cacb1a833f33225776d234c82b75e314fe3e18570933a0636ecc"
+    "8d595624c108677e7a4f0b7c6ee48d81ce2e7c6d5c808e400e81a5e3892c6053"
+    "5577157cc991ed727ab1debae6333860dc6ff6328ef79ca87e547e4256b3fef4"
+    "08e954e5c04ca7207c11dc67ccc307240c1b0c2a3ef93844a081186565bf225a"
+    "b8d56da1a6f978501dd0526067e4d760ee0ed1b81799bc9dfa1cbf9a192bd10a"
+    "321a34c26f8975cb72379ba4bfe09870d793b423d9b789cf946d049e68c1f3c1"
+    "4db832d3bcabdd17a7022a0358ca120c344283d10f05785c5d98c0950db3be01"
+    "7a7e29c32e45490e98050445ffd6ef35974d3f4e16720e27febb5e9aa65cac0b"
+    "96d0ed0511c60e04e5046fe4ad978052d7e424ce54047f43767f792d90cc1cde"
+    "dc8ecdabd469089faf80c02a3ec565ed23abe72b4afc511456ff80eac1e13863"
+    "6b1a4fd90925b5754c8ef068c119cc2fec0827465a5beeb36a2e47aa656608e6"
+    "e5193fb4b30ab3d465e53dfb06b86365dae62f1b23ecf88c244e490c875b772b"
+    "075763bf9a9c1ba78e0a43ad4c243491d5494023755fd0bf9feb12e811b8ff19"
+    "b785dfaa58fbfce2a8069ebb824d6362839b0514c3e072b71c4a761f6ee857d2"
+    "891c65e8dc03acf97586224087bc8860d0cddc0ea7c97f8a0b6ed84a3cc43e88"
+    "ffd3a52e17235b7ceb5d6e49bd5af69ae4a6dbb6f70eaca40368328784579678"
+    "6196d68d45a105338158ed104e424034234dfd314a0aa5ad742169be9dfea6d5"
+    "423da74092c328e969f2be0469a0a3e49aad9a2083ecb7bb52c2c1f4ec768e62"
+    "94b039c41210b4d083e711033c707d96bb0f22e2ea21e90ff4e2682b5ff12771"
+    "7bfd69efced7b37d31841829e62b72c8db73cdcc17a974aecf1350c7ed8f9886"
+    "12065dd1ae162612847aacde0c317587cfb67ce0ee2438ab9f04188192f2d39c"
+    "dc2825cdee3d37e3328e81626ea950d1d143b4a23848bdfed6142b65b6bd0860"
+    "ea1b95769f568a0d21fa1144f4a983a3aac11ea6a308a080f906d42b6fcff1ca"
+    "3a24a883fdeaae95c60ce8a98bbe8926d7c8c8a841ac783f19338b7499490103"
+    "12fb5277c9a75ec0119062821fd6ceaf25a18086c73f59fc848eaa41dc3708fe"
+    "cdb9b4f0460118f23ce6d7786712cc0ea9615f0cc0e3086c651b7410238464d1"
+    "9989cdde391df224962d2d5c5268c33fa2fc6174e849b83d8f77a2c3ae3ae457"
+    "5ece18baf821535834d65f6e954afd3bc19731dd4f0b0aa31cebb4c70bb510fa"
+    "77b59802b3a5c69199fcd05cd334238c4d3bb992b12c52e4db32087bcb5947ee"
+    "cb04d5b8ad8dc3965613cdec438762d28d657193626f18dce3270e0ea419913c"
+    "036e3bb5218b9d81c91e65dd1eb75a38eabab436748549b76897d509bdafd31c"
+    "2d0ad8b409956a319f01cb0399838977dfad96a193ad9abfe99fab4e667eba1d"
+    "ede1bad3fb38cdc6b71b5b954f479800c4bf4b8ebf9d0916d99e3f61b6efdf18"
+    "0152ec6c6ef03ce1c807ba44082a81e7fa016487751fc36320b1d9ba2ca16716"
+    "418fb9b0d6e94341b05beca6617805b5ae3cbe7655f4b999a3585d5d89d9e65b"
+    "2fa1f40edd540ebd00a346aeac5c94ca3915d9ef5a6321caf320cf9446544315"
+    "dd2f24c5031bf4178cbe873f845e5ba56e07f3c171c4dc0a7d225c8d59ad1378"
+    "3f11af9a18eeb1aa8752095db90e07b3e5d7861c438d77aadc4983dc70e81a65"
+    "b0e45e93b38feff413c8a7893d3d234b119c450d47e7cea066002e297b20a433"
+    "fc3b13e016752e3edbca13e8dc6302b7e8a1f6e3640f3b9a11867b7dc5cd7b93"
+    "fdd7f39586877722ae26589e2ac37a9f5ec86e413934c6ec9116c417b9a099a2"
+    "cf60f9f14425d8cfb71ceda2e18954a6373212867d85a796a41e15dd72ef9ab6"
+    "635c99390248c60dea04edfe2b875a59a0c5ae1440d5b9a9bc22e3439e05e9e3"
+    "4f90761efcfd9d029b69f49fcc5e6d6e1f8aa096e5b96df86e9033d871819f73"
+    "35811d61e7bda64ccf55e6b7728938c7856bdf6214de03be7d11eefdf5de962c"
+    "116491ed12c166d889022b3f34b20ed4238af570239aae8cab2b6bbb68f22d49"
+    "2a61c17b800669f1f0f2de28fc3c624c8b0342a4ed6ab93863e9ca9f6a5868f8"
+    "a4c8adfc39f95f225ea0eb8d060963ae3ff205239cef40500f5ade71a2522d3a"
+    "3f176cfc36a91fb574abaedb0a3e9296f70a90d03d7f8ddb5cf4f066ddfbfa00"
+    "3b17394b535af7280d22ebd016443f94d29995e09e5316b183852d0be716ec2e"
+    "1c80956538453dfc9b3a4496a93a7e34e08a7bab46e61c70f1c11315b9d38966"
+    "f4edc2090ea01bfde3edd8b55dc02a23ef4463b0c332927f8dbd2a46e2caf58a"
+    "456bdfcad4c80ab9473e264255e4b6563ff598c66057b171edf896a1370dc97c"
+    "269a00c75b4ce15ad4795ebffe99afa8b3c76748f142179395cbd9547e409393"
+    "6c9fc9c19f3c2521e80cd38450dcff1748a14c109ef1fabf5b1cd150fead218b"
+    "6ebf9c8ef50d3e0a8add08a716165ba6e27793b3c803a4ab9589dff920957fad"
+    "4ab32572533a4bcb0166779b2c93d64202b599815bc988fda13927905685f266"
+    "6a0d7869e79e9009255ae970fd3836e50f26f1aedcf6aa914f7bca076ac92698"
+    "18de300665e841d58bcc2b3126b1e27470b3b1ef2a181d1873218ab5b2f03840"
+    "eed4c4f6661f2c1ec4c46956750723277dd35cb20c7673dbd1f9cb9aa9bb35b9"
+    "eeb992e00726348db7f8a8405ac165204ff65802ac609361126529d2178ba835"
+    "849392b0fa5d3862371cc22723b29a4f45549f3aa339be1136179edf7a64d634"
+    "bbf1c17270074eaf2261b623ee5914d7c5169ff2ab77f6763e238124574c70f3"
+    "3dbcb08f80d68966f17344e1c238715856cdd487234a7846d59c9953df25f0f6"
+    "2a15aa8faeb4489d5c9b48669a1eb64343b4f71a010c32b59b95e4188170ba49"
+    "18489276f87b22cd8ad0269e8e305e53ef361b6d6dfd0076232950a2400edd7f"
+    "0e6470d6b6d13b42354cfd7a198706e9b832134c8cbf1e8f1d11c26e3548db2e"
+    "ac3758e569d18da23cce7b16373c5aa1978dca61f3bb47b2505c7fbb8281b0e4"
+    "af64f41a29156802df853930d3883fa6a280067a004e1c97faa0a6fa54aa5c3d"
+    "67945acfdcdfb45b49f27ea56b803e4788a7da772e724732f74ab5919de2dc8e"
+    "e9e70b790c0a0265f38864bc3001d76089ed49c4d7fc4e9df7bbe96ce6483e04"
+    "27fb4daf5893335072ca8f3c176b8580d63ab353c4e8fbbcb657f891e15cde20"
+    "9cb69bde4beacf69e3b4d7d86679c19becbbf9cb18b0a9117cfcf48f5cf83539"
+    "89fd709fc7b52b6c987b6fa559439433292379234ffa600ed48b887fe4702b28"
+    "be0564865982c4b5565ddfa767483996bf13f6e0cc96f79d7e94829e3d43bbc6"
+    "a25b6b86667b401a4d2f6b2c660fe8577ee63f51d5da849212976e845c0b6ebf"
+    "6ff8d38443761fefe24c6ba79035908cf06ff559d55720ce2c71ea30ee01aad3"
+    "c7166043e390f45b0d2109617181ed2c67783082c5a074b96ed63abd141e1c38",
+    /* 2^90 */
+    "3c9fdc000510afbd11da6e08a7fe91c90df8e9fdedbaeb7946fc4513a1d5962c"
+    "beda7b413342315345a2deeb818c336aaf01f0ec2c4f0fb7a71149cc3a0908b3"
+    "767cc74ec7e620bf65f9116006b85ea37cdd2174a879870ff27c66f90a8e9911"
+    "e69b348378999aae5c93afc6ada7167f7c3a195664c38e773be06df4048d8eaa"
+    "f5fd3bb96290bba103602ec14eae7b540ec53d73ce84f480ba7ab1557569637b"
+    "9cd9934d40558dea33effafa3b2ae424d25e920c9d9feb9908c524659a1ae466"
+    "128a03930a945d0ec4cf15ad0c035da03761e75e9d59aef02d80b3900bebe2be"
+    "843e91fca77e438706d243f5688babbd4142b59642891e47912e3738b02eaad1"
+    "82d3741b7007bf9997fae4ead6c8a44951a5c59e1ede66eef3dbcd5a68dcd153"
+    "76870f1c73e387e40d20f4d1adb2dc335e17b6edd427fb97b992453432c17e57"
+    "ec692fb36456d7370aa3cf16b8cf9f5b413110fc539669aa769bfa076b0d87e9"
+    "24f809a669e08851eda964e72c48e0461c1f54838dc0858204139e52898b720a"
+    "a670eb7501f9feee13abe2948a3fe3eea5d04c194f08d0af1d4563e6a2be575f"
+    "cb72aa015e443c10fa55dd086b1cddec80ae71b8b9370167fcdeebad6d8bfc91"
+    "3547ecc53fe03030ad1d23409071efd64ff61d8ae4caad854456000fbc91819c"
+    "935f30dff116adb5a448881b5086776347ee03134b2becc91c0b69786760262e"
+    "4bfe1f86f7c928b1c2a0f17be1a3377e0f339f10635de0aad795f236b7fea051"
+    "4d9de04f47a489a485b1fd57fffdbe60570142be3919af243461cc619de56ec6"
+    "4013e40dd5bc83d0b41da4fad7813f0f7e2c5fa6b65109d9cbd72cb163967c9a"
+    "b6ad75be94b92305469e9cffa009d6cafe850d5e6726250fdd9ca2b73c1eeda4"
+    "9ade49d09d8aa066ee2a1888eb1a4eb714caea48690cbe6517b4ac10edf8a601"
+    "feca12ef06e0f24813feb84d3cc34e259b943cf78cff8abc9d8c86d01927357f"
+    "0a68b0aed09fbde848e6103f460d4e98ad40ff81a15ae1ffc63ebd9326dec806"
+    "66182e9433ae68ee9f7d470913cb144a58ab52252a1df07c910896bffc60ca82"
+    "1c6e85e98dc8e985addef642c40a688b4db0ab02c6a9e89ff746a14078e11aec"
+    "d4e047d013c21ed5113ff79cd9a44a23193e23b23fad202cfdc8e7fa0c9f7bb8"
+    "bfb9e0babd478c70af7e336f53ea5c3d002f2a1b4f65a01c9bc055dcfc13e157"
+    "b0c98ca00a3b0154ba3b656b7a27f18d33e1dbffc6ce224dcadfb176f39a896d"
+    "680184dfadc6fc972506ea4b02c860fc20ba16e1b4de6dca20b91b272c8aaef9"
+    "72903fed239adf95d61891f866e784065ca3058263eacfb246a70004a6b9ad60"
+    "8243f4e6235bc6d092cc637a46934a4878881c614b85cf2ffda9ada47a7751ac"
+    "f0f71430002065f0369853c143b1553f5cd11278372fad23b980c1d435c0dd6a"
+    "77a5f320f4adeaee9da757e708765d46f03605712eae4c05256db12d02c6af44"
+    "dd963140f1661ffa0facb9e7b93c2a4a079f2ac164fe2343b818b884485d322c"
+    "661fd12fd118f885d35a8b4805de00d64be16604ac94befe59748b66d979c6db"
+    "3cbdb7aaaed5624f85a9f31943dc7d8f8b45eb2166a7da309e7bc4120570725a"
+    "0f83cf62822c05c77f04d5462b6aace54f2b2eda373d1cad85480abbb6cec288"
+    "d5aa8738c3c5e3b38662031d4d6f9bf07c35c96f1993750e41fb69321b602243"
+    "b49310c29c82016bd629ebed8fd748ae36852de01406919c5ce3365b2fd642d7"
+    "f7b74ec0724bba424ee1fdbe9821db58a0403eaf40a9df0f1291d45946ef96b2"
+    "75cde569979373832258fb79eed5d680ed8e724f33d0e2e276fc7264a916416a"
+    "eb7840da34882cc152c179d6ee4b8f0e8e62a27b3ade3b8650854a149a4fd412"
+    "930572e3d7d81312ad69a4ee9f8e29c2b5053b2f117f8253ee313b2f6affc40b"
+    "b581f7c39ec1889a59cf429c9a067b39f18eedd443c67f8361038d6a7f33c6a3"
+    "54b04c77502c01b9ccd321bb2a85926eb35e13345c04c23f90c50e2be65124f2"
+    "012834634cdce2c3e30366b4512791c6301e7417164dffc96ca8a6255b207736"
+    "cd5ab4da253b9abf06bb4ba2789cfe685e6e13e9f08f8c68430fd9fd6df3aa81"
+    "6823e3ffc27973c578905ebff5a88f5cbb23891bf544a25c07edf15f26f8cb19"
+    "0d8fc349002ecddbc15cbc7b5782ee1ced0c31bf6d1f054c0cdbb8b7379f5304"
+    "c6dedde5c6ce9d5c83c119856c6f0f03da55e3a7be1247fb17de0290dfb284a4"
+    "f7e730101e22a28e260e6968e853584078d9d93e42fb7ac53e794743a55d0a51"
+    "f5dfda43ed30328bc8af6c1cbb92bc40e1c47ec45651a475280a5885d9d5b0ac"
+    "d44bc7416d6e33938d2189a522fc340765e0bf0d06d393c581d3ddeb6dce18f1"
+    "c72768ed9facb21fa5788c47f5d0f98d12ac0daec903ab72961bcab4cc7b9936"
+    "ee8db3b00e779d73143c77ac3647bdeceadb8cbeab847d5b0067da33f4a89028"
+    "748e6ccb6be9b05049797ce9cd4910d67d8a4be7ef3b0f904073d381f854eed9"
+    "6c73851565023a6c095351831ffdf78b753f7ccf79e65052f7e0f69910a5b67c"
+    "711e3ca16685f888f67ab2ece70d8cb93b471588c6b0f630da394d455a60374d"
+    "1df8694e48ab822f4db192a6ea843197deb0ecc55644d611b291651315c32b48"
+    "48831f5a71a6589a8481589e4faef2e0fc5ee7b373713ad7cce008c488155018"
+    "dab4f8d99f3d7df8cb8d45b9a267480ea506c7d54f276a0dec6867cb3a546eae"
+    "788485f47f840086dfab60f841cc2ba808c29b63ee9f738514056ce9384b9168"
+    "d223d1d3eef6436af0f1394e4f71f3842abed2b7104db214d98dc11e8440bae6"
+    "97f5f942c3c737933878d18b8cea1244bf1803e1ad4969cdf5bf73db49d52f60"
+    "3ad93255536897bf404905bd04d586e23181d2ae142269ed29be0fa50919626f"
+    "bf2ed4680a9b199809dc26833e8da9533c3aab9a5e5f6116f04bf85effc90c4e"
+    "7d32647e4a13e6a8170da7e971291f057708cade80d23468d1bf70c56cfe9c35"
+    "5935e20069139ab075de70694785c782c6c4e309eeaab588c37f0b6e729185bf"
+    "a24a58489bdfdb5e14391c2a036ac1c279641081c5970a87253d4daecdc78df9"
+    "77e5be8c29cabbda1e997d97cf873f2c6df6080ef1f5732b0874b4743d0b20fc"
+    "29953417a3124988532d212cf1e8b9c6b18ac324d31298f9e53e54dedabe90b3"
+    "f8f4cf674fcf72533b453b44e30f6a6c01d7e1e11c0f8731d6222338885cc1b0"
+    "788c73b5e225e4a6fae38db52748b7b7e84747e9f9fc7684b57846e1ed6d3fc0"
+    "9264c21a95682cd7219062a08f129cb695a8c4c48a8af71782c6c194a4bc0035"
+    "d0dadd3e5c704a9a347f2928345de7c34b31bbda94c3290fdb6119b36f09d2e6"
+    "2fa20f6bd92cb6a748040c3d078405c6185849a37b9ed0c72e5f8ebd9d415e50"
+    "acbd901167567f75a00ef2d37064d002a4376135772b351ca41ed329450862e7"
+    "b8189b74096d43eb1d25e10a62b97d080ffc7fe24aa796dff2ec9f8ec9b57814",
+    /* 2^91 */
+    "00dddf7405c7c9eca36fe3dc9510e59c847cfbec7aecd9096668f4badbe8fe77"
+    "9654f1c5506a96fddf9a3101f18c80c6a69e73f7cc8325309c59a698d95a979e"
+    "8ea29fdce58d4559620b0d0071213c5b21ecc733429a654d809428de567737ee"
+    "246f9aff793e00b121eae1d3df1db0a3d4cc534d7cfe2d3290ce00e6a785a1f0"
+    "be41a336171505240a05807cd33bdecabf4c58e00db70db833474861e1c68e73"
+    "6ca1ea3679519db8c55105af35631fb62788914371619f78da7b279c34ec28f4"
+    "ed5ba07cc19a7fe20389cc59ef7b7113e1dc6ea696c3a73b002607ba6109154b"
+    "411d97d6213bc25ee2d183a7ca58b6f94a3c17aa2aab3bcc88dc749ce801d99c"
+    "c57cfaefec51a2e9f27e985036945c22b4ec81025382419b53b4d49957bbdbc4"
+    "c3471821aece307b3b452630ead094d63b47b629fc4abbe1ce7d312ca689498e"
+    "0519cff764c210f029128e70eb830c93b0180cf22a33e23b6d0ccfe7fa6d0c2c"
+    "a95848ac2cc6117a1e57595da89dce969414230663dbe6c701580aa78982a93f"
+    "3046c708bb1c200059fbf51eaa8a2bebbf2ade0ea35f6e2656df0a94dc1c58dd"
+    "89dc421eced46ad075e2afe58df63159a888959b2b52611327f8530d9c88dd60"
+    "c94bcae7fc89a590c92677216cd75633203dc83c5c5d68b117ca7ac6ff23613e"
+    "b683b2f5b900906ebb65b872bab3b4612c70ca7141d90df9f6d303d01fe0c420"
+    "b30dca1afef2384b5ac6fbbb9d08fc6bdf5f3d8350083080ed052fc7455aa679"
+    "cc62f2f2653c3da76b77d55286cca862bc859cfc356227b1f9b2984327390b50"
+    "dadef3df226bdc15d2a167e48dbd39733e39f71dd272e051792f122f2e4d676c"
+    "3f747fcdae60b45d45f91ae64e0e4ea705e77eba5ad03a050b10bf05936577c8"
+    "1fbdf29eb357c44b7e75cefaa3100e8a5989e2953ea781df45b920767dc06013"
+    "9b0723b559872cde25900853675e016b3742e85643d7ba716896de1be789beb3"
+    "7dbefa322c76040fe1d4aa1ddf4d53d74f2a99d6b7e498c92b6b6a348ddc45b1"
+    "c5142f3626a0fa1b6e47d21248af70dfbad7b9d41f72176cd20295a91dcdf0ac"
+    "5d8bdb386f89648d6e660511f2f2096e90a59d5d8373e60adb78150706d97eeb"
+    "29afca983eb9056d89ef2568fedb732faa3850553f143cf1fb584d235b32973a"
+    "f7d844d82c56a16372531d428a051da533bbefb035f72f7d6c725f24a68c6b62"
+    "5fd96bdc8e8c5c27897150a6a2e9a99736067b2aea52a4a8300b21ec1bc46186"
+    "2f2fddf6d5434a3e52aa4b7302074d20a8ab4e7d8ef0836d991350ec6772c1b3"
+    "b5c49d6601b579ac994e84eadc72643fc7268d6158b4b7e81935eec5a4de3bef"
+    "c98615491b00865c03ad78d411a22a1082fb221c3c72f94c581b19ac4bbd8c60"
+    "fa5c2d62c55f2c1a472c793aaa33e049e9119e6e6e9cd6f51087cee7db9e2e86"
+    "6f432db97d6ed4e2560705a3d696e14659df1677a37b8f1ef12fb8cd30f3c43c"
+    "709c3ce640f648d3ca8bc33b3123508ef2b2c6990eab882f6d526fc315c7c03d"
+    "5bbc2da049d4c27161a0606df82670904ea2812b5b15bbe434edc159f97d8fc6"
+    "4bd773b2edd7c12f3732428ee3f82a7c98c4166a758b9ed8c9787a407ca66a97"
+    "d711b25b54fa86d702fee380775e6498472261b559c6bf6ee5808a133828b8c5"
+    "6c3e1b2d0a43f3dd647b2564e595de072681faca957087c46b31da8d96ad4233"
+    "fbebe8fafee6b98b480632c9389dfc938ec59232f8c14afa1685b906fa96987e"
+    "43a24b49de692d462cad4b9fc39e4f12e88e2cbed87744b13aed7503b3e70c0a"
+    "f44ad114ffd645eb38aed64af6676c902d784fc915c7c71ac2cbb011375b9cc9"
+    "333a3858b8c7776bc010e1d4fe49110268d0a32eae97aa3d7c6ce11ab772fc2d"
+    "99a92c640c28a439d3d3fdfd41d38d1929f5f5e2d244ad4a96f5cbdc7be34b3c"
+    "73ca9c4ee9282efb65a4b9393489267b52a45d619db7f82d3f430632a254e8e2"
+    "9f25ca1e74740270c4785951bab60547059df76632b259753f10a8d4d23db259"
+    "82a7718881bf2c4f4f3f623c780351dd2538e9e2dd46f74527e251efc44fd915"
+    "bab859876e307d6fb730e0eb77d132c76a360f5540c4614a438c18d01401cb61"
+    "14b9d0141d0d4232c16a2a8701a60fe66fb0d19e1fe96462d43447ba0e66d904"
+    "1ae36c011b2a84767a9febedbdd9961f5cf81f0827c45591092d1fe2f748901a"
+    "ffe7991c523d537fedc9f68d8147498454c515e75270a486847d1b91e7243207"
+    "f7b41de3a5de2b63ba4102eb04af1e5df65cae4dcbd8ac58a414bd8f7aa3c117"
+    "97443418cc311b50e258c3db0e03f8bfe4c27f05e458cfd1a3ed997d27ec46cc"
+    "9996c6960f3fa3c2c04a3ed225dd9b15972fa1008e4cbf058d05b16b9da289ca"
+    "310cc8434ad7ce42a2692bffd24a299e0448709cdd392d02a1f747924f80498b"
+    "ff8e1602119ed10797ecf8428877a37f1c8f40c632c4b4f499cd6474562cc8eb"
+    "3bba35b9d509da3a0fd1f50866c702a0fcabbd5868cab53cb120d191313c20db"
+    "900ccd398a9b95a9aad4e9d900170455b538163f32255dd84afb160fca2e460f"
+    "98c78260c84f026233a07dccca35e89e5581d52bc2ebf973337c4ccb664bec0d"
+    "1d898be7e98b8c6720f7775b24010ff3fa5f9919fe302e935743f5234629ba27"
+    "c9e47526dcd3a0a8f9cdb58a9150e454294a33d7b7ab09c18d379f30bfd330fe"
+    "147c21ddafa89555a515b90bf5d77051d621557243df89c324c646c743f3c89f"
+    "7af77c94b87cc413bbb088c9b10fb05755d696c9a049edb78603521cdff0aa82"
+    "7618bea2e09dc0aa350344f77a4e092c9ba27604dbd0a35a0c14f0b3cbeaeb96"
+    "4101c33b3834918f50035ec44fc0f88d27df121c978abcb351011f7da6b75dcf"
+    "5e0398bfc3f8f21855a9ade316e4acb232b0de495bd61e85aa8da12c95f1f1dd"
+    "1cd9b7e0b898bd172f2d7507579125e7c3ab87969eed440bd3c775554fcd8c65"
+    "1cb3ff5e26db7a6d78b7183abd4fe91aec45f4bc497050c299c84d4a8c4e55ae"
+    "d0e31d4966dbc800580b3cf511b7542243977ff74978aed726a4ec4c9f4a0803"
+    "eb18ef18a0b29f47c1a8c3fad6136f115c363932b4ee83de176bf9f141a8c87d"
+    "3567e630189533a3a96f6fac775480830a92c8f52be4093c865fc4e66720c821"
+    "db3d1e2270feeebb53376e1afa4189588068199c31e95123d9ac67a2f13d3484"
+    "0202937cd1350550e5621e9135ffa3c4bd1fa0fdbf5c7de954afddf2f379fd12"
+    "4be8e67138934baacc95799625f68c60831c3c91937978f6e5b2379319218041"
+    "78505d60f76cdb1e3b42227ce4f6ced6601cfc6e54cef88fdc8e40773de19330"
+    "7efd024c85ffb9c936814bf1e1fb97d5d2085c8d3ae631f34895506515ab257d"
+    "6923d2a89af21a47e48cb42f469d9c775a1ce4c8e95fc3352791e0af480736b8"
+    "68e25acbae0fb3b54b19bd8aba9e8465624ad95bceef9bfbf955cf59b8a296de"
+    "d6afe72f4332105af73e58e666006409d5ac5f5a2cd4a215f57b8a99e5bc1c62",
+    /* 2^92 */
+    "2e8441a9c69572ea05de527f9f11b7617e2db731f781a9513f8ecef58b865a59"
+    "8e9363806a65174c71d703b07a58da1700a7d4a02f5d45d03b79d9dd44f6a47a"
+    "75073f10f6d6796ed07feb7eef331d25c7b2cfcaf3979ef1a7f5079005dcef5b"
+    "45486ae36d04089e049993407702b85c39b9328be7e1b7bc2db498b33591628c"
+    "87ebd5b65dd799d91bc130cbd0d145d383422db28f445dc58d5c9350f9a7c04f"
+    "cc04c4aba3a6f4e963720f1928070a07745c99f1a66797435a110eab45b25201"
+    "b1cf835f5811ec2340bc4bebb0d6b2618577b6a1a6239800a5fbcef622a69838"
+    "9bc53882dc495cd4136a09a56f413f36b92946cfb5ab26cc6a48c28e4c9724d7"
+    "7be4aa2290e2c69fb78e57329f140568db761d0f21647a54dfaeb8e10d529337"
+    "271369f545ec1793f3b5d90a149a2c3645054e974cf6345783b8cfeac7c4f2d4"
+    "c796c5195e703d349f747a08a1570d3eb2f028ded587b746b2a6b5433fff82f5"
+    "21b8f08cf4098a5b15a0bbfb16d10f3e6a8f7aae89302a591b55d0a9e3be4524"
+    "b6558c2dc46ce8484b6b302d13bc4b2860902131d76cb091be82ff9929b45e31"
+    "95d9778a7e3d06da211be9e24c7798aeff9f081edecbeb3e70e0f73e0518928e"
+    "6ae48391104fefb6497b437d09121123f926762b3c8c14bf6df63039f0228e93"
+    "fb81e12cdd920d5e15571b35351c960f167bb6953cfc461f5a3c91402bbd25d8"
+    "9796935ff10131f84dc2aa2f039fe929343de67fcd66da1c363ffc70b96d1d5f"
+    "d123afd8f22b705193a0ece06074f43bc6afc0fb4eaf6ea4d4bd65338122e695"
+    "9a2748b0dba5b9afb9bc0893909e5900fb6113797fb6a28734e818db72bc893c"
+    "ea716009c8e3752353768d5a64a774e34ca73c1f1e5735bf0f848b005cf59d0f"
+    "edac11c2f8d5a76c13c3b7dc666c376adda71bca3a4b524e1f3dd5258f2adcd4"
+    "16ca3cef054c1aff6aacb71ff302546e759f0c437a871ea58f63b46e737154fb"
+    "f61ca4093137a3ade1c42b37107c47e83bb02d5e1217cc340cab6b1017a3c99b"
+    "cf94c85546a57b17bc2f055aa047022b1770094b7cd6a4fe31f4334b6f081a66"
+    "d059a2c92a8db16f1692cec234ee912d9c18cc8651580e42b51c6c25dca9e826"
+    "7f46e4782d0d07a7cf943aca7b51cdf3ca6ec530f387687eef88d0a97c768c61"
+    "931f0d7111aba1cf45003f68c2e84fd84f5358fc0419b4430ae1447125fec0c9"
+    "61fd73ea084b8dc27536b212017902eb0d29be67cbc16cb7fdb095feed30765d"
+    "30f70a39773bc54200a453feb06f099d8b1a13abee57bbe3be86dda44cace9b5"
+    "b48f4078b681f0f8b112dd1fb6a564fa78759e1e9db2012d4d2b3d39d4977ea3"
+    "b1223bea610c677e2a136d09e2deb5c712e6b6da848de0ca2cd9b6edac2b8f1c"
+    "50c1f636502bb44373558ef75f4a536f246a6a7fb66cc638a0e0d5b658dd79b0"
+    "ae2df9a2da4ccb0c35f1e12ede1dd4e649b3d0ede254b01d353a87d9086da855"
+    "1302cf36076cd792ca3ab7c7c6d477dd80794b468de9c96d0bb6157ee7b23230"
+    "22ecd012bfa087949978dd8795d9da3ab74a4f76f41e5233667182da1443cf5e"
+    "d3aa38c565cc3395bcd6e52fa9e58796f4058ea031f9a0ad782109fb9b6c3e1d"
+    "b2837e6a02b360c2785c7bd9bd77b9462a2268f1598669b592bb39f69486689f"
+    "b05aac511db090082ebb3b7ba12123b30022f66b4efe37289f80ecc38e561789"
+    "ca6578c8f1cc25cabdf36472b3195f04f683ec9511c95c1e2ce3af2d3833a314"
+    "b6fa789b7982dfcf40b476b6a529cb16b0a5d10edf2730e05e470f76fe7c050c"
+    "81be700f0d6cb84581dd1830b14b9a14c2dc5e505b3e58c174b151479b22eb23"
+    "b12d168d6ee3230cacd18950a6877f810fcdad399e610d4387ea6bc92314b3db"
+    "e701878c31613a69e4e50b45580e0469b78141a1bab8b345bbeeeb72ecc0f258"
+    "bbef142ed1030bb788d96e0de5a235798fa2d0f4b0af59b1d3d7e044e48e41f8"
+    "8d9e6db2cae8100fdaae1649425c9b2dd40aeaaba4c3415bc1becddf041a496a"
+    "fd514dc4341ebd7c6153a0bbf0d45cd8208577d39738ef1d7735c4bda3489b21"
+    "9d58ff298af99d442a5229b2a162b18e3c6b0f565a2017f6dc080e173026afca"
+    "e339ff666126ac96485fb0475e11b7e49bfb87eabc22808fc46148803a02f9dd"
+    "eb7ed6d295c8b8a657b5e70dce52de7b9cb26b965dad444ad26d1f37544b4a47"
+    "307c6b0e49f246aec8ab6635ce842de255fe46e630bf1165f1f6deece1381f6c"
+    "861e2727d071e13073616c4a435dfad0c6e65dd9c666b994b16ee0a6de72b4fa"
+    "9b061b22da4767f99b3ed4fe6b73bcce57f8594b75ed7bf9a2d626f91e2bbe14"
+    "5b707d1d1a92b68fb8bad5d2d56b3f216e18a64ff61ef2952b253164aea2c964"
+    "f0f2bd2a20ce903b581b77aaf5776b4ea7e32b6ccfbe0632d68dce28809ce765"
+    "c7f9892704728b9330f2cb0ece25bd1f8015de4a8084b9ac9619f82ff6275394"
+    "70028d0048cb1673205273cbb64b3a061a17060166a46fffcf931c8dfce2782e"
+    "6e6f0208f15c9f82ab37cb9a1809d183d77df6df786e10645fcc0be245f19b20"
+    "3cf2b642a38c3eab8ca9a1b6173846ae748ab5afff3a19657675436906f56c2b"
+    "fb45d4c19f38ece8dd333e45219e5da17e71b28290db74b937bc97159ec15517"
+    "d12f240d0a7e5b7ef9b5663e61513cc8f62045c13410b6055048e352a6d3195f"
+    "535162d538c71995982c466beaeb4e8f07d617754b75604964ade919c07fd916"
+    "fd860b4675bd7325f845979021c1f08db8cfaaad3e3f5415398c6294887eb265"
+    "9188fc9205600568aec087896cac1a284e70cb26415bdf5b8693e386ebd8e77b"
+    "fdcac0911ac5988644614396184f1d6b21fa3aa6e76177d4bcd13e79d3a2b7a7"
+    "4fb2ba0ff0266b5fca34250a4d2bfd2f8399ca2865e4cc5bce465241922bbdb0"
+    "ddc3fdb4295ad39bb94011bca627aa273d9eb0ae9819560e890d227368029665"
+    "0752583e3f012dee787e69f6a7aec068df9b18f22b362d3607fa283d03d21f0d"
+    "9eeccc5ab0e631353e124c77cff3c4b640189c690301bd5bc121bf9309754835"
+    "0f0bdac413ce67dc064ef41f5b27c19aca834dbbb36aff1fd47f264e49836416"
+    "c08170cabadf84e19e2c76d74897131bb45fb4da956c6374380013d8e25e791b"
+    "9151f784af8e53f2c43ab958ac472abf521870c58afc2e9e22159d09062ffb7c"
+    "3d0cbdcd3c55da6d07ebe41482b87e331ccd205067c8b11ded572d82e7bcdb42"
+    "cf0f0e0c63a35046597256bcbb63239fe703572742bb96ef08b35bf70ed7cfae"
+    "7c7ceacbafc9dd50459d78843a0c560e162a40e9c1c663e84d9d0981c3ebe7ec"
+    "5c6dbfb007307f2275cb069573471e420132f395ae259924aa14476b7c903a85"
+    "3983187f26ff6ab6c35fce1a3f5f923d4d2bf04111a080a9c1e4bce12d1a665d"
+    "cc3210b002ca8181de2e7b394a4e58a83b3dce22a4b526553cb167bc401d6a04"
+    "3ca8b84c8f09281b8434868fc7a3d5caf246d28b74346ece10ecc9dcd92f202f",
+    /* 2^93 */
+    "0b115ea5725669741bd31ce3aae693f3e2297bd5c60026af07f11a4331824969"
+    "fb3d1d1cf62d330ee55e536b2a3c897127b32b273895dc87ae5092ec7dea72f3"
+    "47c3d5706289f7bd0cf9366cab116ccb6ce9c4695e62afd0f999b0f916a7ec4c"
+    "45360d21d5960cc55305a43b69f1a187ec2e7fa9d23dfe7a2b76026cbec05462"
+    "e60d8a67f1a1ecdba2116d4c602e38657dc201e611049f8f46aac34a0b018f6e"
+    "ed80c81faac7b604cdfa4e561a1833ceeaaaae0b483c116e8dab666e6602f572"
+    "d03b82ee2573cabf07c9e01c99147d6dabf60606dd8b1a306c28e138653672e8"
+    "1a330193ffc795be1145eabaf491469e85b0f640824d37937d113d2b49378472"
+    "ab13eb434403558afcd5b537ce8e1934d3c834ef6bcc7beed29a981d8adf5dba"
+    "a9e67430a9dcc1ed1e8de9b73fbd265286bb372bd797b63fbfe444a5cd3ab565"
+    "4fc88e814292761341ec1690ede4a8c09d95614e5c2d6de7a04ef1ad0a19d504"
+    "bf92c32fb972e469a6e70f1e758750a5d0046778c7b4c68950a9c0698950cee1"
+    "af2ba345a6fa31e8c8c3ebad7b51da8369567053d81e3c757dba069f81964d79"
+    "bfbc1e0f259d3110e54d75479fa6a3e5fc38b50b233d40d096fa7a14f2840ffc"
+    "810b697bb677117625b83113ae59336bad762dc0eff3ff5e9ad25dfbd96a0d15"
+    "aff83e564d929fae969f79f3e2c998e61686e7c6ca3cdb3709c003b6ea278e9d"
+    "19d4933be7b5c7b45015f21791a18596e953d5e1329a099940c44e452bf24f6f"
+    "a0c29b76c9eaa04d88340fcba5403cfeb919b9007f4d0bbf6cc9f634fd2d1491"
+    "d6853037d682b9534ae4ea6f5ad5bede98a7f4d24745e771d47b3024e13cab68"
+    "858cf9680ada243ce46ce8cd0d080377bd93c093b45175b54e61a3812e751a50"
+    "f32787f4964afdceada7e5c13dc66fae81564c482fd81ee943fb059e30106be2"
+    "aacb821d343fffd2240f1f35dd52c73539f34b57db17f40f2737a21f81be2d3f"
+    "9e6069a9c2b8275beb40c4b5f838d580e42153a5ec63d803487507a9325bff73"
+    "2c42bff445756cebc5a6a4e8c5474a0aed695c6470c6a167f93afa931358597a"
+    "52e2e76cbb1fc688230509a2d5f222e8b2b4f911b4626376dd7780eb54867b52"
+    "4fe9a6520ed99cef5c40599b2117a574ea2f09c02e518a34c0e9b261abff6628"
+    "960bac63a0e721639110eb4cbc0ddef168315d0f072a18b0b9cc8a8473247670"
+    "841aa48e89444d7e9a5a3c4c3d95eeecb6ab501ccaf98b1fdee3f4a4c0440b9f"
+    "c703e3df8539fdc4b6ad8180fcd7b8c12b6f24edc6ce2c01544e1fd18509e010"
+    "cfea0b8a8ec82cc9de5c5a12215fc48fd551a126fb0d0ddebfeff8f37648a080"
+    "f116679545c447cc36933c12914275df2ce1d17879bea4a819cf02fc4fd3ed65"
+    "b80200c576ac9f0eac9cdacbb6867b8e521f74f7516d7336555c181fd1e58411"
+    "052bfad36f451e23843f4b7528628157694220ca19bea77904d745987da40657"
+    "4ebbbf487907c854ff01950d484117623e16e582ab8f22fdb190c1570c1c4376"
+    "1473626258382a0ee8b465241b3f172a74b6d858388c46e3eac74ef64bc68300"
+    "ff5306f791795101518a8a75bfac9076065f1bd5e4a271d980cc8e518211daba"
+    "e3ae9f35f7000e9bb994a30daf67d0540a6970ca24cbda7ea3d580c5eace9500"
+    "a8aa0a6ec1f9a5d8a51a9dfec163a21175d7428234090292046e74cc966a404b"
+    "5fead9ef476f6e4c1797cb542284ab1c2a9ef234914fbe06ffedd197a1a7fb48"
+    "762ce8cf573565e2d8b99f7037e87d7342312dd3da1fd103eb315f5cdae1371b"
+    "f72042083c5d08074c0227cdeb592c39442db837fb52b625a002c25a7ba7e376"
+    "d212bfb41969f5a8d04628fb38c32975b827488b01515874bf5da20f40a2a5d8"
+    "a37ae57c8b63a63673034739a8d40272a922f03cc1e330a41274d6653acdc1d7"
+    "ff7896edaade1680b27c311b82dc07ea73456ebe9f233491067dd5f0e945ca62"
+    "a6cad66dfdc606b9483d7b77b283a8014d79aa02530b3dc60a56abefa8122ff2"
+    "b3c2295fb7700b723a92a8ad869455b9f4e0fedfb79e45ade997346f043cd747"
+    "219c02bd1b68e57efb4a641417405bf8380f51da274e355c48fe524492b5761a"
+    "b6af884aac3ec5b2100df0776f360c8e029becdb062d42f245f0b6eebe6cba1a"
+    "386545af5cc403cf1d723c5e5512635a4ca0b5823d5b28c6d3a2e5d243193387"
+    "3ea4840e7d1f75eb6d5c4cabe8f515df9d53484eab680c00ad2ffbbbf15c9e47"
+    "03b8595616b448ba7ed91eaaaa01f27c6af02edb44dda01e9ad35b429b8b0853"
+    "e76971298d78e78e97bb94f5127c6a78612c962e30c7a29b61a3cc3d399e37ac"
+    "d6cbc481e7ec0cdcfbd20fc4f169101478df35b82bc7d28c197327e769751ebb"
+    "6c45c1dd67f4c338698691da22fcac737598c95cbdf4cce52139431e9d199fe8"
+    "f00c0ecfdeca5ce19beda70bbcd10fa06c8a7215b506c1bafe12516ae9dd929e"
+    "296f4799e3d5fc6345acbaf3d5a2ba6f59d021cb10570c8d4bc1890d79d56efa"
+    "445750974c059f716ef43e62cb36d60c67afcf6fb78909c1330ef26c740f9484"
+    "cc730d018927d61dbc457dcc3ce89f3a41476bcef94e0c0fa9e3cbf58e8c2340"
+    "6a20bdc3f06ce2bcbc690faccc3d914642713f38e148b4e25fcf7177ef019b37"
+    "143906faa2c909dc7fc52ba6fe5e85c3899cecf901b8394dcfa89e19cf969901"
+    "536ef93f49cf7fcb46ad91dae16e17747eaaf83d02a2547ccfc7acdeab46047b"
+    "53b8b453755a1d3ea7a17f09097b43d7b4574b26ebcbad86ac4b8015a366ba25"
+    "6240a721961e928383f5a13c7546f9064b65899237bdff9863222d4b226a9738"
+    "43a4dc55a0f9b37ec75ab3dac48772ba8b44b004560d6f2b515adb71fb2a2e7b"
+    "40101e86727e95d8dd6d39ddcf905819412f0bd192412b73b16c32ec4b95d090"
+    "adf0f5570974b45cacba7225be60ea04bd140b8d64c05b8758e17260148e0ff4"
+    "dcfd8c4c5b5dc80dc6706b6e2cd0c06718558848143cd69b1da77aa60f2bbeca"
+    "7a36f9cd772dca68f529d18415b66d42671e3caa2afbf6581a4437456e017456"
+    "8e55ed681ada4bd96cbf750fe8d6c84aa84f35540896c566532879640ffa2370"
+    "5460e72547d308d6a605cd9fe3dae04c67824e4a991103ca5f57cf2c2c609e61"
+    "efc3922a56e2801bec9900e610f25de9ba3ea9b528b7467706ed16db9869366e"
+    "06202495a4e50f321095b4cf1c354c8a9ed36f89a562ca213e3f415572a6bba3"
+    "52545f375e8dda2ef554adc20e7997c6b3b654143ef0a36e8103554f89236ea6"
+    "7e1547af3157f6afb80ce6e9838f3f55f98b0a28de80cf5c2e7a96bacecdb791"
+    "2629e06d8caff00b8d77428c32ad17caa4d52f37cc2f62da9475dd96661a1163"
+    "02283877f9fadbd2230a648d38568322525c1709ebb5441c8516019f33e5aa68"
+    "03d85278247710308eb63afa054fcf893fb2e4e66e79530a3b07a7da3451bd8c"
+    "8f7a142fd65369c33db465fe5e756995339b76aa1a865fdb67da646fd6eabf18",
+    /* 2^94 */
+    "ded0115422d31c63d32c657be69e2f45408af7bae2e1494963fd7eb6e8d754ab"
+    "3b66303c169f570373d66f1016bb87d1558959574113681ecb7deebbc04de71f"
+    "9b9a1da2950b14d3524890c3833c544656720f7f24d8f575ed4985390b8fe19a"
+    "a96a508b4d805bde143c3496a9a01ef98a192b4e8df914aa9f3b34875beffa6b"
+    "77b79422e80cd361312b44ce7e8fea2a3086aabd0d34a5b75a196ee52e73d20a"
+    "ec98c40e390686b0248c90858c9f5b6e2da2129ac92c6068e1408e68774ba54f"
+    "add373734ea760aa6065d90140e4ace862cb7927089f1091895f27e8546403a7"
+    "16295692184ce1bcf5e0b8868f5ca8f0be07cf37b9b4e21312c351ad6e4f660b"
+    "df454b21f59a4f227d15d57e2d1dc9953d705051aeac461ddc482964b725159c"
+    "6521fad493d1728217c15d50cbfa345a64e71f7f3d6bbb475e826c2108a9b400"
+    "5c8724e96799c9b6622f954a1d8a1acda90896dc6ce619753fff1e350f2a2488"
+    "9dd7e1c7fcbb64a5ddee2f9a09702c9213f2c3776245d246516b3b212ed9c7be"
+    "3f21f29c0c2d899ab94cd0bb9ceed9deebc7477e325380079243bc4c81639074"
+    "ca759e044f85719a4639bde1c16fa2e83a57cb5da2d6a708ef7d948ab9afba31"
+    "b5748168fd4ef7f49ed60722eef2e065431e74b4346f13209d8999cd80ef3a09"
+    "7a143f460fa28e377dc983553f45019c6a26ce80f36d4c5d7462a1fa7420bdcd"
+    "4d98e32e1a7a49c66cb488c760b45d517bb090049724ed214c30c01bdd81b468"
+    "f7e5f2e307e023f814695cbbf1adb71a3d61d75735601236b4c77635569bb632"
+    "a6cf5f593d2639abdaaa0e83848914efa704a9e0eed48164f7771031b4166640"
+    "138b4c1a05efeceba890e5081279546a12f96cfb5a86e629b34b97735bff69cd"
+    "cda9d59c693cfa8875ae87eeeb5b30da8067c6857beb7c20bd32cb7f62a89332"
+    "350ff33ae886727727689fe7d61de49c808e7898b6f846d966c17a65a75ed695"
+    "44e2ab82b68baad9be514b3f5f1bb27a17153f25b50873034ff599e448332313"
+    "e86dabd41bf8bec5947b6eb3b359853cc3456aa66fadd28796deeae2e85459de"
+    "9a8e1e663327356f55d46ada149d3f062a879336f955f9246e2d0ced2347d347"
+    "5edb198af27a5dcd35afe59b1e07c3011863b8b100a4691597dfc3578f2efd6b"
+    "33a5e2897bcf0312c41380029e40557642a5a4fe2c291334f69aee076191596c"
+    "6c50fae35193fa023c62b33e1c519245fc021fb018d78209ccc5fc3f351cbf4d"
+    "b34f918be18423239c49b6c2857712cc82b4bdf702a5814bc0eb593e882d4894"
+    "a87158d5edb4e18ca55788ec194e29088b7bc6366709eaf0ac74a70fa651d7dc"
+    "e584aef6123cf9948b3de7a129e8390d08e5d83623f1a845dff24d8f840967c4"
+    "88e6ea2043a84295000d97c75627e4d38ae324cc4046d1599153e235f1338571"
+    "d02704185a25c8171ceb423079a5912c82d4f6f48c9b6c31001f4de3df62d9d0"
+    "1c23789d8a135562201755bc2de6c85e6faff831575b34e51bfae3b30979e224"
+    "6478e601638025a6fe3247dfbd6dd2463d1770fc5eca6cb92f9a8988ce21f7ce"
+    "b5d65debc2c6d4f3e80b4b34b8cf72e3706ede1a40b5b8550b8b41feba06e777"
+    "0f9df676981a402b2766e7891946af663f8976bb41212d094aa5b4b0afc47e05"
+    "a6defbcce15f811fae393ac529fdd06d5f1e16ed8d6e19d36e7c2b77978bdd4c"
+    "80661fdca432a76ba105e2336ffc57735e0dbf4c2dd60506eff8aab61fb8a320"
+    "6d642e767f1c9d308532c6ae2da6634dbe9453fb9d192ef290d4597b18840146"
+    "70173522febd585dc38400394a4440f5d08663cbc350dd8607169258931da15b"
+    "6abbb9e4b4fbd51b4623ddbdf13c99b202691339b064b3e6c3d3027b100cd90c"
+    "31059fe6bf0cc2398264d44cd2a9e1acca4f0d31f1228dc61e6447aaa07dc27b"
+    "575192fb6ebbe409bba09817a3ae18f6bb2a03e2fee9fb80ea7451370ebae98c"
+    "63fbf4d385867e374912bae1aadda4778f2ad79e1801d8bb48170d776be6a6f8"
+    "9a60a744c86f5668231639c62cbef2c92d7dfa1bda039e78715436cdfa7f51cf"
+    "cf3087000a6ce44b6cc0c1aa7dfc4bbb584e82b2b12c897dcefd48dc86b95600"
+    "1b6075ba5d752399fb3a5c01c2bdd393fed9ff39e1468d0b139bc7f922834a5e"
+    "2a98ee9b8ccec491f5c622a460047b06bd8b9330f2a291adaf9aa236cd7dcbb0"
+    "d7a7b4e7ba7175a4ccc77a61967d6aa96ef6e8f583e4d80c1a9b46d041929733"
+    "70accf9be327b329fcc7340b8ed7fe29fe8a0d0cfe089db42ff887773d7bceec"
+    "2e28397c83ab5f9f60db8a4131b51dd866c6e5b526510e11fff6afd68b84540c"
+    "be8a1dc60584596de9dc0f4ee8e6c5ea60170808395701412e8d06d0e40831b0"
+    "47610b610feb21424ca8a7ebd442516f84979a6aec8bf3c01e75730626e44b16"
+    "d64d866e4e60ca5dd780cac9d7d36cae07a8427d8074ea30ffff0408a0c88763"
+    "6fe721bb7e031a3734ae0b4e9a0691565ec8d4878e4c016a5f628a12b059b385"
+    "1946fe65b69aa5d35322b4af801c992b9e4adbf4b3aa6a95a3692e47aabd737f"
+    "b8b99bbaba2afe6a924250df63797604b1f4ca636e19507effaf6b1586dc8f55"
+    "b1f459eb8ea72fba50fc87038977a9ea4de2de71816b11444bed66e37b15d32a"
+    "1e85bb95366f51c7c72f39d29600c623eff0ddafebb5fa7d957cf6ea089f87aa"
+    "8c12fb6fd74b69a513e2c0ec19b1ea18fd6b899b0e7deba297f9930b8e0d41c6"
+    "2d9bc27e91b9e9b77a105d95681411a1636a8e2df02f361d7c1c467b04c6a4a6"
+    "8508e2d89753689d4bfc9ba3204f610953c3200a5c7cb215bf869820efa67881"
+    "e6a20f54cb53314e5f94ff3a88e681c4f9ab59e70ba4f7dc874fa20fb1245301"
+    "bded62e2b208d83a654b78457d84f3a7a03ab9988bff94107ef3778b494387dc"
+    "8c8f394e2682520bfb974baa8c7c9c56f20d90214f6ee0ce5ce4cc58025df071"
+    "128685fd9328d9fc30f0862a7e6991fe618c8e0ac6005fc98784476f6c9f1eb1"
+    "d12d06b2fb9007bf64e3ea8dd3aee548121226ef53f060a0f05396b8c14fcae5"
+    "4dd2334b983e0a077dd4013b60700d0e1d70a761857b5d8bd12af9fdaafb0ce2"
+    "fbebe429729ad7fe4644dd73c7978c44b5a1a1266f318870df315261f5a3a9f9"
+    "77f47121672e9dba845c6382995d3813a000628d6ac11d81a60f89cb1f8e8ee4"
+    "a6e0408959b0651258be9dc6f5b5596b9afe3a1689782167d5b92781265d666e"
+    "4a4a2c5efce21ee1157fa30f0a0877760fa71826cd6f86be4747f7da27bd9c15"
+    "fc0db8a971c6a40251ce350892fbb929e1b7c67ce6b52f2fd661e071a4924bac"
+    "5cf0a5df3eff3702b3433ac52bd2c59351e2d84619495513e72fe824a71b0959"
+    "384ffd4ffcc1140005cdcc7fb4628df05fddb144a8e050ad69a47a296d5ad313"
+    "5836fcd8d8f17df1ef5dc0fa709e30e9a3766820df36eb7577fb2c015935890f"
+    "c46fe041e1fb733cfc4ac8f8c81d04ed990747fe3d5d866eacaf409bedd0b488",
+    /* 2^95 */
+    "096ab9c79020ab7101f911b6079b1b948d2e00b61ff144fe9350f12b0b0a9e07"
+    "7171842ea591c6f8a41d1f3f5bbd887fd1109f3053097accc9cf6156d3a665d4"
+    "ff2aa8da6701fea83196d5fe52e8d60219ee78eb96d35e568724e7edfe863370"
+    "cb01bfbd8d638124eda40aad15d3a06a48c1c62929226f4827b0965d1de23c1d"
+    "7f69ac55e2045a4bb98005f5dd3eefe8e4c17dfc6ec606651f8e4fea639a080a"
+    "b3f9820d7b44722f361368a2400ed5f1d44f1c2327bb9fdb86e24d7b6d5f664e"
+    "b330f7370b867e4d995c7b697cd0cbff262f0d27ec6c351a0e63e7917b3dfdaf"
+    "272e7cba813b04ec03581432bb6fb757ac68e25152b77514336f0d784a592301"
+    "29d103a7e17c6e587bd0dadbd7ac75f3f83c4977a76ec074ed7a6513cb58e1d8"
+    "3e120a89f26b512455a06655c41d681af9543494c896220691e8f5c3cb0d6047"
+    "904cf0bbfc7cd8d1515558800be623be37bbe70ac5ac1957d9c1973ed2637d76"
+    "c4b0b4fb5ab3e4bb814d9b4dc28afe7f6b1fa0c709d3e29ba2a6f42fb02bb53a"
+    "db2748e1686828d2b898f79fc3ea5dc5a1a848166d18296b13e91e0f34f5d27c"
+    "2a75f5a21acb181e42af2097f3cbc5aab0f97c6bce41e6d0b8e5fa40099d1bac"
+    "191250ba39f4c246b5c5428fcbb79070ad7c0b2c356c5098ca30a51392934342"
+    "203bde473347789707df5fc4fb14b9efe3a9db4c4d4520231f77cac4c47485f1"
+    "4ebd0fa4859246f14c563ccc49dfef9238e4324210c47ffb84ceaa037bf17117"
+    "e6a93c8981b852e84387121fbb338bcc99aac6a82bc9756cb41839ea0ca4f6ff"
+    "6c88a4a78aeb8fa41b8cf19f8ceb06b1e42d6769bb23dbdb7ed656d58c778d54"
+    "7fe65cf757db6cf3ff54c5f83a0e70028438f0b787102d8c9a3d8aeedd9e5040"
+    "9e7a744b30dbe6a316b788a16ae982230397e0cb72ddb05ad216515c806e0fc5"
+    "551fcc83ef2bc7c939e18245b9e9dd221084a652cea9ba00a633224332a37c3f"
+    "b68797b9dc69f059486867e4be255d51af81e68534c75d8fff46d59d95f3ac30"
+    "e4e43523c651251caa607692291fb2e3f63648a71e3dee7053bdf98fb5a6b61a"
+    "365faf71239c0f3552330dcbae6e0c01b90b70dea09d7a7fa3999d3b428b8e41"
+    "0126a4e07236426d5616f3045f9151523f169b9a5ca8a305b390a29d038d47cc"
+    "c9c2366b816a41047b89a0d5a982529a14cf98f8c88b84e6485ef36b9943fbce"
+    "86ef8adea98d0e991b2bf87164f5b395bf8f436a08ae2754490dedced7f26f53"
+    "92eb4f8f0e3a6ec37b3b47d1b0aee5dd57b9fc22701abab23df2663d0b9ec1db"
+    "b919b6edaec0d3d044f4290d7d899c8c9ba646b033643786e2c9307ce0c3bb8b"
+    "a3589bbc9b50877dd0eab9f7548af6dbb8f933114af7f9e1042e322338e38281"
+    "33b4af77cfa8a0e681a467a2c4df23d474e188d5761f9cba8be78067f2915342"
+    "c1ad7bcb2d30457d6c564487d69958d6164102bf8cd36fddaa7b6915384122e7"
+    "2725c5e70a65e67c2dc0a08e92477e62482fe9de5a87d1e14dec7f24368e3701"
+    "11c8cf405093f879367c992c9050fabe5048fb6dd1f5690698c5040147df1772"
+    "7a68351bf9bd522917c6b9e8008da84afd498c1333eb46c5d8126df74cd5569d"
+    "207bbcd76e3b756d0cb3fa7dbc26b2cf15291bb6d4d338d90fb8b9e002a5e7bb"
+    "835372faf9f35d3a3a51b8532500bc4c3fe507bd539e13b939308bf265f1c274"
+    "0359b11c5370765fd26a0b3658c890d8ade7f47d3841ad3a605dd73418b2af62"
+    "3655fb45cd13e2fb210772bec7e6f93388192ae2acf08b7d3a0d7bc5013f4347"
+    "44e3a638988e355c7c89644a8670f64457c01011e50cc462c46d96a750f15845"
+    "d20fe30a3c7b71eb24b7358bb6fd546376e172b45d6dd4a6d6a1339e28821325"
+    "7bd0e3c856e8c1e071a3f8936d0cbae4608598973eeb213b2e108d36cfc9e204"
+    "a7faeb413bc08e3b6bc073fad5fa4e4311a43ad9d2cd25b4827b1ad29ef5cfcc"
+    "70de15b556f78587eeb8e87d2561955660c3135e7c02755bb3e96a86c9fba84a"
+    "bfd2db70b4be2f303addacd54d07654cdbcbbcd74cc8767fc399eb8925ac8e65"
+    "06ca095f0781e1f343e3e0bec062aa8d1fa69a43544421bb1d8d6f9de412dc62"
+    "aeae80f0be9b52bb66e3a1e304938645f3d463103c9f4180b93959d711bfe9b8"
+    "39d9b99c6de8ce512093f86220d4e85f3a885b76727bbbd7e0d50417205de450"
+    "dbd13702c6ee182ddf356f1a0b812dd34e94233b3b4f5f56a37a6bedd284b0b7"
+    "7d71195f6d7c11c84669d24c2c82e1b7fb9626e2ce6b1ec846c230e198361149"
+    "8549924ad97ccc36fd61098826b2394c7a1519d03bfb724cafcf595a1aa9b1b9"
+    "6bf0ad9f1848d7a430b95e37721f9a68a778d1c0c003c797c9a80e37cf6fb0cf"
+    "fca8982cbda4e7cd3bb211800f66e4a7d9ede638c8c40cd760a3e08a527c3a33"
+    "2e9b21aee453edaad9887c19079800d225100c33bdda14d00b69b29aef94e96a"
+    "67f34af263670f4dd7a582e1cb18799b2db38fd5cfca327509d863c2c5efa9f7"
+    "19e068948c21dd28cf7af25af6f48c67d5595dedcf1900818bb11c1ba31920b2"
+    "a4816390bf00c419bd13b860ce11172af1a90ec9fbc18fc6192b7b8ecd9b92dd"
+    "2c148ae8bb6324bb53339e97b277439ebc0d47a5ac4d96dbd5e46f1155f9ba40"
+    "075743456a2825aebff8e23ddd6f9e5b3c246cb3c0592fc8ed803d3c1b196faa"
+    "c830ed8f7ea8019e61705f0be00bfb34fdad368f50fc495589469449a6f29c96"
+    "725a7fcf86b873cf84586456d84ff5db70f9772ba6e8ce50d7562bea1bc83282"
+    "153a42d8ec46545451a8b5267129e96b4b1b251b51f80ea8c9f7aa00c784089a"
+    "c224ea5f0032ca798a62d90d1cafa39e382d0bb7cee0ca27943069d1bd00c79d"
+    "bd379bb4e2dd210f9fdb3bb632e04d32319032b08509868494245db209707145"
+    "e0226632b0508c1470f8adfc9e3c2eddf6bc1339c14b382c7f9a3de6879a99c2"
+    "7000c1e5e5a2ba69afc223ddc86941179e793da7ba2433db4bd4f7386ae9f92f"
+    "2f9cb4c54a2cd8c3912ad4381b22adb9f567b69af5f9454c1635867ca1c5e7c7"
+    "b147e5cb0b98aa15d144d945672126d77a05f8540c547db1adbd2c1d024a0659"
+    "8ffa9820020bec12fc4be6710385937fe2ba99acc3538de83ed495cb37e34635"
+    "64515aff6ffc03322d78695ac76c6f781213044d1918bb8db7764bb7f435fc08"
+    "812bc0533498aaddade449a8d357149cf2aa46f000a0c2c7551b3ebd8bc8eabc"
+    "e700b199c28fbee8d78c61fa61511a65280dfd060862c7d16cb2e744cc9f31c9"
+    "eef90d64c948f37cf309da473cb3fdfd13ffbd48a778ff4fe78b91c293cd34a2"
+    "c87e085ffd96519cabe888572eafdf691b9d7f54a385295a95e778db52d96af3"
+    "fb36d4f4a8f4448c1a7523476cc7dc3d7f3e7316aad821d082b79d678dd20cc9"
+    "b701ea2b5e1f31a5860347292b82fcb70fcde8d18fe9a1f6c197285cf131c5f8"
+    "92e937e4959fff3a191102c3aa06ffd6692378a14922f416225e4b3c6d0f106c",
+};
+
+#endif /* SFMT_JUMP_PARAMS19937_H */
@@ -0,0 +1,68 @@
+#pragma once
+/**
+ * @file SFMT-jump.h
+ *
+ * @brief Jump function for SIMD oriented Fast Mersenne Twister(SFMT)
+ * pseudorandom number generator.
+ *
+ * A jump advances an SFMT state by an arbitrary number of steps
+ * without generating the numbers in between, which allows splitting one
+ * seed into non-overlapping substreams, one per thread or process.
+ *
+ * One step is one 128-bit word of the output sequence, that is, four
+ * outputs of sfmt_genrand_uint32 or two of sfmt_genrand_uint64.
+ *
+ * A jump is computed as q(F)s, where F is the state transition, s is
+ * the current state and q(x) = x^n mod φ(x) is the jump polynomial for
+ * n steps, φ(x) being the minimal polynomial of F.  Jump polynomials
+ * are given as hexadecimal strings, the lowest degree coefficient
+ * first, the same format used by the calc-jump tool.
+ *
+ * Jump polynomials for 2^k steps, SFMT_JUMP_POW2_MIN <= k <=
+ * SFMT_JUMP_POW2_MAX, are precomputed for the configured SFMT_MEXP
+ * (see SFMT-jump-params19937.h); any other jump needs the polynomial
+ * to be computed at run time, which takes a few hundred milliseconds.
+ *
+ * Copyright (C) 2012 Mutsuo Saito, Makoto Matsumoto, Hiroshima
+ * University and The University of Tokyo.
+ * All rights reserved.
+ *
+ * The 3-clause BSD License is applied to this software, see
+ * LICENSE.txt
+ */
+#ifndef SFMT_JUMP_H
+#define SFMT_JUMP_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "SFMT.h"
+
+/** log2 of the distance in steps between two consecutive substreams. */
+#define SFMT_JUMP_STREAM_LOG2 64
+
+/** number of substreams reachable through the precomputed polynomials. */
+#define SFMT_JUMP_STREAM_BITS 32
+
+/** range of the precomputed 2^k jump polynomials. */
+#define SFMT_JUMP_POW2_MIN SFMT_JUMP_STREAM_LOG2
+#define SFMT_JUMP_POW2_MAX (SFMT_JUMP_STREAM_LOG2 + SFMT_JUMP_STREAM_BITS - 1)
+
+/** size of a buffer large enough for any jump string, including the NUL. */
+#define SFMT_JUMP_STRING_SIZE (SFMT_N * 32 + 2)
+
+void sfmt_jump(sfmt_t * sfmt, const char * jump_string);
+void sfmt_jump_pow2(sfmt_t * sfmt, int k);
+void sfmt_jump_steps(sfmt_t * sfmt, uint64_t steps);
+void sfmt_jump_streams(sfmt_t * sfmt, uint64_t count);
+void sfmt_init_substream(sfmt_t * sfmt, uint32_t seed, uint64_t stream);
+int sfmt_calc_jump_string(char * jump_string, int size, const char * minpoly,
+                          uint64_t steps, int k);
+const char * sfmt_get_minpoly_string(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* SFMT_JUMP_H */
@@ -66,6 +66,14 @@ extern "C" {
 
 #include "SFMT-params.h"
 
+/* the AVX backends use the SSE2 data type and the SSE2 code for single words */
+#if defined(HAVE_AVX512) && !defined(HAVE_AVX2)
+  #define HAVE_AVX2 1
+#endif
+#if defined(HAVE_AVX2) && !defined(HAVE_SSE2)
+  #define HAVE_SSE2 1
+#endif
+
 /*------------------------------------------
   128-bit SIMD like data type for standard C
   ------------------------------------------*/
@@ -122,6 +130,10 @@ typedef struct SFMT_T sfmt_t;
 
 void sfmt_fill_array32(sfmt_t * sfmt, uint32_t * array, int size);
 void sfmt_fill_array64(sfmt_t * sfmt, uint64_t * array, int size);
+void sfmt_fill_array_real1(sfmt_t * sfmt, double * array, int size);
+void sfmt_fill_array_real2(sfmt_t * sfmt, double * array, int size);
+void sfmt_fill_array_real3(sfmt_t * sfmt, double * array, int size);
+void sfmt_fill_array_res53(sfmt_t * sfmt, double * array, int size);
 void sfmt_init_gen_rand(sfmt_t * sfmt, uint32_t seed);
 void sfmt_init_by_array(sfmt_t * sfmt, uint32_t * init_key, int key_length);
 const char * sfmt_get_idstring(sfmt_t * sfmt);
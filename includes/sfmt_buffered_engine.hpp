@@ -0,0 +1,196 @@
+#pragma once
+/**
+ * @file sfmt_buffered_engine.hpp
+ *
+ * @brief SFMT as a C++ UniformRandomBitGenerator
+ *
+ * The engine generates sfmt_get_min_array_size64() numbers at a time with
+ * sfmt_fill_array64 and hands them out from the buffer, so it can drive
+ * the <random> distributions without a C call per number.
+ *
+ * Any distribution works with dist(engine), but libstdc++ implements them
+ * in terms of generate_canonical, which is slow. engine.draw(dist) has
+ * faster paths for the uniform, bernoulli and exponential distributions:
+ *
+ * @code
+ * sfmt_buffered_engine engine(1234);
+ * std::uniform_real_distribution<double> dist(40, 56);
+ * double x = engine.draw(dist);
+ * @endcode
+ *
+ * The fast paths draw different numbers than dist(engine) would.
+ */
+#ifndef SFMT_BUFFERED_ENGINE_HPP
+#define SFMT_BUFFERED_ENGINE_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include "sfmt/SFMT.h"
+#include "sfmt/SFMT-jump.h"
+
+class sfmt_buffered_engine {
+public:
+    typedef uint64_t result_type;
+
+    /** values per call to sfmt_fill_array64, sfmt_get_min_array_size64() */
+    static constexpr size_t block_size = SFMT_N64;
+    static constexpr uint32_t default_seed = 5489u;
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    explicit sfmt_buffered_engine(uint32_t value = default_seed) {
+        seed(value);
+    }
+
+    sfmt_buffered_engine(uint32_t value, uint64_t stream) {
+        seed(value, stream);
+    }
+
+    void seed(uint32_t value = default_seed) {
+        sfmt_init_gen_rand(&state, value);
+        pos = block_size;
+    }
+
+    /**
+     * seeds the engine with the stream-th disjoint substream of value,
+     * see sfmt_init_substream
+     */
+    void seed(uint32_t value, uint64_t stream) {
+        sfmt_init_substream(&state, value, stream);
+        pos = block_size;
+    }
+
+    /**
+     * seeds the engine with sfmt_init_by_array from 8 words of seq, as
+     * the <random> engines do
+     */
+    void seed(std::seed_seq& seq) {
+        uint32_t key[8];
+        seq.generate(key, key + 8);
+        sfmt_init_by_array(&state, key, 8);
+        pos = block_size;
+    }
+
+    result_type operator()() {
+        if (pos == block_size) {
+            refill();
+        }
+        return buffer[pos++];
+    }
+
+    /**
+     * same numbers as calling operator() size times
+     */
+    void fill(uint64_t* array, size_t size) {
+        while (size > 0) {
+            if (pos == block_size) {
+                refill();
+            }
+            size_t count = std::min(size, block_size - pos);
+            std::memcpy(array, buffer + pos, count * sizeof(uint64_t));
+            pos += count;
+            array += count;
+            size -= count;
+        }
+    }
+
+    /**
+     * skips z values, whole blocks are skipped with sfmt_jump_steps
+     */
+    void discard(unsigned long long z) {
+        if (z < block_size - pos) {
+            pos += z;
+            return;
+        }
+        z -= block_size - pos;
+        // a block is SFMT_N steps of the 128-bit recursion
+        if (z >= block_size) {
+            sfmt_jump_steps(&state, (z / block_size) * SFMT_N);
+        }
+        refill();
+        pos = z % block_size;
+    }
+
+    /**
+     * a double on [0,1) with 53-bit resolution
+     */
+    double canonical() {
+        return ((*this)() >> 11) * (1.0 / 9007199254740992.0);
+    }
+
+    /**
+     * draws from any <random> distribution, with fast paths for some
+     */
+    template <class Distribution>
+    typename Distribution::result_type draw(Distribution& dist) {
+        return dist(*this);
+    }
+
+    template <class RealType>
+    RealType draw(std::uniform_real_distribution<RealType>& dist) {
+        return dist.a() + RealType(canonical()) * (dist.b() - dist.a());
+    }
+
+    template <class IntType>
+    IntType draw(std::uniform_int_distribution<IntType>& dist) {
+        typedef typename std::make_unsigned<IntType>::type unsigned_type;
+        uint64_t range = uint64_t(unsigned_type(dist.b()) - unsigned_type(dist.a()));
+        if (range == std::numeric_limits<uint64_t>::max()) {
+            return IntType(unsigned_type(dist.a()) + unsigned_type((*this)()));
+        }
+        return IntType(unsigned_type(dist.a()) + unsigned_type(bounded(range + 1)));
+    }
+
+    bool draw(std::bernoulli_distribution& dist) {
+        return canonical() < dist.p();
+    }
+
+    template <class RealType>
+    RealType draw(std::exponential_distribution<RealType>& dist) {
+        return RealType(-std::log1p(-canonical())) / dist.lambda();
+    }
+
+    /**
+     * fills [first, last) with draws from dist
+     */
+    template <class Distribution, class OutputIt>
+    void generate(Distribution& dist, OutputIt first, OutputIt last) {
+        for (; first != last; ++first) {
+            *first = draw(dist);
+        }
+    }
+
+private:
+    void refill() {
+        sfmt_fill_array64(&state, buffer, block_size);
+        pos = 0;
+    }
+
+    /**
+     * uniform integer on [0, n), Lemire's multiply and reject method
+     */
+    uint64_t bounded(uint64_t n) {
+        unsigned __int128 m = (unsigned __int128)(*this)() * n;
+        uint64_t low = uint64_t(m);
+        if (low < n) {
+            uint64_t threshold = -n % n;
+            while (low < threshold) {
+                m = (unsigned __int128)(*this)() * n;
+                low = uint64_t(m);
+            }
+        }
+        return uint64_t(m >> 64);
+    }
+
+    sfmt_t state;
+    alignas(16) uint64_t buffer[block_size];
+    size_t pos;
+};
+
+#endif // SFMT_BUFFERED_ENGINE_HPP
@@ -0,0 +1,219 @@
+#pragma once
+/**
+ * @file sfmt_engine.hpp
+ *
+ * @brief SFMT with the Mersenne exponent as a template parameter
+ *
+ * The C library in src/sfmt is built for the single SFMT_MEXP of the
+ * Makefile. sfmt_engine<MEXP> is the same generator written as a class
+ * template, so that several periods can be used in one program, e.g.
+ * sfmt_engine<607> (2.5 KiB less state per thread than 19937) next to
+ * sfmt_engine<216091> (longer bursts per state refresh).
+ *
+ * The engine is a UniformRandomBitGenerator of 64-bit numbers, and
+ * sfmt_engine<M> draws the same numbers as sfmt_genrand_uint64 with
+ * SFMT_MEXP=M and the same seed. The recursion uses SSE2 when it is
+ * available.
+ */
+#ifndef SFMT_ENGINE_HPP
+#define SFMT_ENGINE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include "sfmt_params.hpp"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+template <int MEXP>
+class sfmt_engine {
+public:
+    typedef uint64_t result_type;
+    typedef sfmt_params<MEXP> params;
+
+    /** size of the state in 128, 32 and 64-bit words */
+    static constexpr int N = MEXP / 128 + 1;
+    static constexpr int N32 = N * 4;
+    static constexpr int N64 = N * 2;
+    static constexpr uint32_t default_seed = 5489u;
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    explicit sfmt_engine(uint32_t value = default_seed) {
+        seed(value);
+    }
+
+    /**
+     * same as sfmt_init_gen_rand
+     */
+    void seed(uint32_t value = default_seed) {
+        state[0] = value;
+        for (int i = 1; i < N32; i++) {
+            state[i] = 1812433253UL * (state[i - 1] ^ (state[i - 1] >> 30)) + i;
+        }
+        idx = N64;
+        period_certification();
+    }
+
+    result_type operator()() {
+        if (idx >= N64) {
+            gen_rand_all();
+            idx = 0;
+        }
+        result_type r = state[2 * idx] | (uint64_t(state[2 * idx + 1]) << 32);
+        ++idx;
+        return r;
+    }
+
+    /**
+     * same numbers as calling operator() size times, a state at a time
+     */
+    void fill(uint64_t* array, size_t size) {
+        while (size > 0) {
+            if (idx >= N64) {
+                gen_rand_all();
+                idx = 0;
+            }
+            size_t count = std::min(size, size_t(N64 - idx));
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+            std::memcpy(array, &state[2 * idx], count * sizeof(uint64_t));
+#else
+            for (size_t j = 0; j < count; ++j) {
+                array[j] = state[2 * (idx + j)] | (uint64_t(state[2 * (idx + j) + 1]) << 32);
+            }
+#endif
+            idx += int(count);
+            array += count;
+            size -= count;
+        }
+    }
+
+    void discard(unsigned long long z) {
+        while (z > 0) {
+            if (idx >= N64) {
+                gen_rand_all();
+                idx = 0;
+            }
+            auto count = std::min(z, (unsigned long long)(N64 - idx));
+            idx += int(count);
+            z -= count;
+        }
+    }
+
+    static const char* idstring() {
+        return params::idstr;
+    }
+
+    /** size of the state in bytes */
+    static constexpr size_t state_size() {
+        return sizeof(uint32_t) * N32;
+    }
+
+private:
+    void period_certification() {
+        uint32_t inner = 0;
+        for (int i = 0; i < 4; i++) {
+            inner ^= state[i] & params::parity[i];
+        }
+        for (int i = 16; i > 0; i >>= 1) {
+            inner ^= inner >> i;
+        }
+        if (inner & 1) {
+            return;
+        }
+        for (int i = 0; i < 4; i++) {
+            uint32_t work = 1;
+            for (int j = 0; j < 32; j++) {
+                if (work & params::parity[i]) {
+                    state[i] ^= work;
+                    return;
+                }
+                work <<= 1;
+            }
+        }
+    }
+
+#if defined(__SSE2__)
+    static __m128i recursion(__m128i a, __m128i b, __m128i r1, __m128i r2, __m128i mask) {
+        __m128i z = _mm_xor_si128(a, _mm_slli_si128(a, params::sl2));
+        z = _mm_xor_si128(z, _mm_and_si128(_mm_srli_epi32(b, params::sr1), mask));
+        z = _mm_xor_si128(z, _mm_srli_si128(r1, params::sr2));
+        return _mm_xor_si128(z, _mm_slli_epi32(r2, params::sl1));
+    }
+
+    void gen_rand_all() {
+        const __m128i mask = _mm_set_epi32(int(params::msk[3]), int(params::msk[2]),
+                                           int(params::msk[1]), int(params::msk[0]));
+        __m128i* p = reinterpret_cast<__m128i*>(state);
+        __m128i r1 = p[N - 2];
+        __m128i r2 = p[N - 1];
+        int i = 0;
+        for (; i < N - params::pos1; i++) {
+            p[i] = recursion(p[i], p[i + params::pos1], r1, r2, mask);
+            r1 = r2;
+            r2 = p[i];
+        }
+        for (; i < N; i++) {
+            p[i] = recursion(p[i], p[i + params::pos1 - N], r1, r2, mask);
+            r1 = r2;
+            r2 = p[i];
+        }
+    }
+#else
+    /**
+     * 128-bit shifts by shift bytes, as the SSE2 byte shifts
+     */
+    static void lshift128(uint32_t* out, const uint32_t* in, int shift) {
+        uint64_t th = (uint64_t(in[3]) << 32) | in[2];
+        uint64_t tl = (uint64_t(in[1]) << 32) | in[0];
+        uint64_t oh = th << (shift * 8);
+        uint64_t ol = tl << (shift * 8);
+        oh |= tl >> (64 - shift * 8);
+        out[0] = uint32_t(ol);
+        out[1] = uint32_t(ol >> 32);
+        out[2] = uint32_t(oh);
+        out[3] = uint32_t(oh >> 32);
+    }
+
+    static void rshift128(uint32_t* out, const uint32_t* in, int shift) {
+        uint64_t th = (uint64_t(in[3]) << 32) | in[2];
+        uint64_t tl = (uint64_t(in[1]) << 32) | in[0];
+        uint64_t oh = th >> (shift * 8);
+        uint64_t ol = tl >> (shift * 8);
+        ol |= th << (64 - shift * 8);
+        out[0] = uint32_t(ol);
+        out[1] = uint32_t(ol >> 32);
+        out[2] = uint32_t(oh);
+        out[3] = uint32_t(oh >> 32);
+    }
+
+    void gen_rand_all() {
+        int r1 = N - 2;
+        int r2 = N - 1;
+        for (int i = 0; i < N; i++) {
+            int j = i + params::pos1 < N ? i + params::pos1 : i + params::pos1 - N;
+            uint32_t x[4], y[4];
+            uint32_t* a = &state[4 * i];
+            const uint32_t* b = &state[4 * j];
+            lshift128(x, a, params::sl2);
+            rshift128(y, &state[4 * r1], params::sr2);
+            for (int k = 0; k < 4; k++) {
+                a[k] = a[k] ^ x[k] ^ ((b[k] >> params::sr1) & params::msk[k]) ^ y[k]
+                    ^ (state[4 * r2 + k] << params::sl1);
+            }
+            r1 = r2;
+            r2 = i;
+        }
+    }
+#endif
+
+    alignas(16) uint32_t state[N32];
+    int idx;
+};
+
+#endif // SFMT_ENGINE_HPP
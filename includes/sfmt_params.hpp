@@ -0,0 +1,136 @@
+#pragma once
+/**
+ * @file sfmt_params.hpp
+ *
+ * @brief the SFMT parameter sets of includes/sfmt/SFMT-paramsXXXX.h as
+ * traits, so that engines of several periods can be used in one program
+ */
+#ifndef SFMT_PARAMS_HPP
+#define SFMT_PARAMS_HPP
+
+#include <cstdint>
+
+template <int MEXP>
+struct sfmt_params;
+
+template <>
+struct sfmt_params<607> {
+    static constexpr int pos1 = 2;
+    static constexpr int sl1 = 15;
+    static constexpr int sl2 = 3;
+    static constexpr int sr1 = 13;
+    static constexpr int sr2 = 3;
+    static constexpr uint32_t msk[4] = {0xfdff37ffU, 0xef7f3f7dU, 0xff777b7dU, 0x7ff7fb2fU};
+    static constexpr uint32_t parity[4] = {0x00000001U, 0x00000000U, 0x00000000U, 0x5986f054U};
+    static constexpr const char* idstr = "SFMT-607:2-15-3-13-3:fdff37ff-ef7f3f7d-ff777b7d-7ff7fb2f";
+};
+
+template <>
+struct sfmt_params<1279> {
+    static constexpr int pos1 = 7;
+    static constexpr int sl1 = 14;
+    static constexpr int sl2 = 3;
+    static constexpr int sr1 = 5;
+    static constexpr int sr2 = 1;
+    static constexpr uint32_t msk[4] = {0xf7fefffdU, 0x7fefcfffU, 0xaff3ef3fU, 0xb5ffff7fU};
+    static constexpr uint32_t parity[4] = {0x00000001U, 0x00000000U, 0x00000000U, 0x20000000U};
+    static constexpr const char* idstr = "SFMT-1279:7-14-3-5-1:f7fefffd-7fefcfff-aff3ef3f-b5ffff7f";
+};
+
+template <>
+struct sfmt_params<2281> {
+    static constexpr int pos1 = 12;
+    static constexpr int sl1 = 19;
+    static constexpr int sl2 = 1;
+    static constexpr int sr1 = 5;
+    static constexpr int sr2 = 1;
+    static constexpr uint32_t msk[4] = {0xbff7ffbfU, 0xfdfffffeU, 0xf7ffef7fU, 0xf2f7cbbfU};
+    static constexpr uint32_t parity[4] = {0x00000001U, 0x00000000U, 0x00000000U, 0x41dfa600U};
+    static constexpr const char* idstr = "SFMT-2281:12-19-1-5-1:bff7ffbf-fdfffffe-f7ffef7f-f2f7cbbf";
+};
+
+template <>
+struct sfmt_params<4253> {
+    static constexpr int pos1 = 17;
+    static constexpr int sl1 = 20;
+    static constexpr int sl2 = 1;
+    static constexpr int sr1 = 7;
+    static constexpr int sr2 = 1;
+    static constexpr uint32_t msk[4] = {0x9f7bffffU, 0x9fffff5fU, 0x3efffffbU, 0xfffff7bbU};
+    static constexpr uint32_t parity[4] = {0xa8000001U, 0xaf5390a3U, 0xb740b3f8U, 0x6c11486dU};
+    static constexpr const char* idstr = "SFMT-4253:17-20-1-7-1:9f7bffff-9fffff5f-3efffffb-fffff7bb";
+};
+
+template <>
+struct sfmt_params<11213> {
+    static constexpr int pos1 = 68;
+    static constexpr int sl1 = 14;
+    static constexpr int sl2 = 3;
+    static constexpr int sr1 = 7;
+    static constexpr int sr2 = 3;
+    static constexpr uint32_t msk[4] = {0xeffff7fbU, 0xffffffefU, 0xdfdfbfffU, 0x7fffdbfdU};
+    static constexpr uint32_t parity[4] = {0x00000001U, 0x00000000U, 0xe8148000U, 0xd0c7afa3U};
+    static constexpr const char* idstr = "SFMT-11213:68-14-3-7-3:effff7fb-ffffffef-dfdfbfff-7fffdbfd";
+};
+
+template <>
+struct sfmt_params<19937> {
+    static constexpr int pos1 = 122;
+    static constexpr int sl1 = 18;
+    static constexpr int sl2 = 1;
+    static constexpr int sr1 = 11;
+    static constexpr int sr2 = 1;
+    static constexpr uint32_t msk[4] = {0xdfffffefU, 0xddfecb7fU, 0xbffaffffU, 0xbffffff6U};
+    static constexpr uint32_t parity[4] = {0x00000001U, 0x00000000U, 0x00000000U, 0x13c9e684U};
+    static constexpr const char* idstr = "SFMT-19937:122-18-1-11-1:dfffffef-ddfecb7f-bffaffff-bffffff6";
+};
+
+template <>
+struct sfmt_params<44497> {
+    static constexpr int pos1 = 330;
+    static constexpr int sl1 = 5;
+    static constexpr int sl2 = 3;
+    static constexpr int sr1 = 9;
+    static constexpr int sr2 = 3;
+    static constexpr uint32_t msk[4] = {0xeffffffbU, 0xdfbebfffU, 0xbfbf7befU, 0x9ffd7bffU};
+    static constexpr uint32_t parity[4] = {0x00000001U, 0x00000000U, 0xa3ac4000U, 0xecc1327aU};
+    static constexpr const char* idstr = "SFMT-44497:330-5-3-9-3:effffffb-dfbebfff-bfbf7bef-9ffd7bff";
+};
+
+template <>
+struct sfmt_params<86243> {
+    static constexpr int pos1 = 366;
+    static constexpr int sl1 = 6;
+    static constexpr int sl2 = 7;
+    static constexpr int sr1 = 19;
+    static constexpr int sr2 = 1;
+    static constexpr uint32_t msk[4] = {0xfdbffbffU, 0xbff7ff3fU, 0xfd77efffU, 0xbf9ff3ffU};
+    static constexpr uint32_t parity[4] = {0x00000001U, 0x00000000U, 0x00000000U, 0xe9528d85U};
+    static constexpr const char* idstr = "SFMT-86243:366-6-7-19-1:fdbffbff-bff7ff3f-fd77efff-bf9ff3ff";
+};
+
+template <>
+struct sfmt_params<132049> {
+    static constexpr int pos1 = 110;
+    static constexpr int sl1 = 19;
+    static constexpr int sl2 = 1;
+    static constexpr int sr1 = 21;
+    static constexpr int sr2 = 1;
+    static constexpr uint32_t msk[4] = {0xffffbb5fU, 0xfb6ebf95U, 0xfffefffaU, 0xcff77fffU};
+    static constexpr uint32_t parity[4] = {0x00000001U, 0x00000000U, 0xcb520000U, 0xc7e91c7dU};
+    static constexpr const char* idstr = "SFMT-132049:110-19-1-21-1:ffffbb5f-fb6ebf95-fffefffa-cff77fff";
+};
+
+template <>
+struct sfmt_params<216091> {
+    static constexpr int pos1 = 627;
+    static constexpr int sl1 = 11;
+    static constexpr int sl2 = 3;
+    static constexpr int sr1 = 10;
+    static constexpr int sr2 = 1;
+    static constexpr uint32_t msk[4] = {0xbff7bff7U, 0xbfffffffU, 0xbffffa7fU, 0xffddfbfbU};
+    static constexpr uint32_t parity[4] = {0xf8000001U, 0x89e80709U, 0x3bd2b64bU, 0x0c64b1e4U};
+    static constexpr const char* idstr = "SFMT-216091:627-11-3-10-1:bff7bff7-bfffffff-bffffa7f-ffddfbfb";
+};
+
+#endif // SFMT_PARAMS_HPP
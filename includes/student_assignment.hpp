@@ -0,0 +1,73 @@
+#pragma once
+/**
+ * @file student_assignment.hpp
+ *
+ * @brief the problem of counting_371: the languages of 10 students and 4
+ * professors, and the two restrictions on assigning a professor to each
+ * student
+ *
+ * An assignment gives the professor of each student, a number in [0, 4).
+ * counting_371 estimates how many of the 4^10 assignments satisfy
+ * language_matches() alone, and both it and student_count_check().
+ */
+#ifndef STUDENT_ASSIGNMENT_HPP
+#define STUDENT_ASSIGNMENT_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// bit flags
+static const uint8_t SPANISH    = 1;
+static const uint8_t ENGLISH    = 2;
+static const uint8_t FRENCH     = 4;
+static const uint8_t PORTUGUESE = 8;
+
+static constexpr std::array<size_t, 10> students = {{SPANISH | ENGLISH,          // Maria
+                                                     ENGLISH | FRENCH,           // Sophie
+                                                     SPANISH | PORTUGUESE,       // Liliana
+                                                     ENGLISH | PORTUGUESE,       // Lucia
+                                                     FRENCH,                     // Monique
+                                                     SPANISH | ENGLISH | FRENCH, // Rodrigo
+                                                     ENGLISH,                    // John
+                                                     PORTUGUESE | SPANISH,       // Neymar
+                                                     FRENCH | PORTUGUESE,        // Jacques
+                                                     SPANISH} };                 // Juan
+
+static constexpr std::array<size_t, 4> professors = {{ENGLISH | FRENCH | SPANISH, // Tom
+                                                      ENGLISH | PORTUGUESE,       // Luciana
+                                                      ENGLISH | FRENCH,           // Gerard
+                                                      SPANISH | FRENCH} };        // Silvia
+
+// solution is a NumStudents vector of integers in [0, NumProfessors)
+typedef std::array<size_t, students.size()> Solution_Type;
+
+// predicate that tells whether a solution is in the set S1, with S1 being
+// the set of assignments where the student shares at least one language with the professor
+static inline bool language_matches(const Solution_Type& assignment) {
+    for (size_t student = 0; student < assignment.size(); ++student) {
+        auto professor = assignment[student];
+
+        if (0 == (professors[professor] & students[student])) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// predicate that tells whether a solution is in the set S2, with S2 being the set
+// of assignments where each processor has at least one student and no more than 4
+static inline bool student_count_check(const Solution_Type& assignment) {
+    std::array<size_t, professors.size()> counts = {0};
+    for (auto professor : assignment) {
+        ++counts[professor];
+    }
+    return std::find_if(counts.begin(), counts.end(),
+                        [](size_t count) {
+                            return count == 0 || count > 4;
+                        }) == counts.end();
+}
+
+#endif // STUDENT_ASSIGNMENT_HPP
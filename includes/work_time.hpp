@@ -0,0 +1,39 @@
+#pragma once
+/**
+ * @file work_time.hpp
+ *
+ * @brief the project of total_work_time_estimation: ten tasks of uniform
+ * random durations and their precedences, and the time it takes
+ *
+ * Task i + 1 lasts between task_durations[i][0] and task_durations[i][1].
+ * Tasks 2 and 3 follow 1, 4 and 5 follow 2 and 3, 6 and 7 follow 3, 8
+ * follows 4 to 7, 9 follows 5, and 10 follows 7, 8 and 9; the work is done
+ * when 10 is, and total_work_time() is the longest path through these
+ * precedences.
+ */
+#ifndef WORK_TIME_HPP
+#define WORK_TIME_HPP
+
+#include <algorithm>
+#include <cstddef>
+
+static constexpr size_t task_durations[10][2] = {
+    {40, 56}, {24, 32}, {20, 40}, {16, 48}, {10, 30},
+    {15, 30}, {20, 25}, {30, 50}, {40, 60}, {8, 16}
+};
+
+// finish time of the last task, given the duration of each task
+static inline double total_work_time(double x1, double x2, double x3, double x4, double x5,
+                                     double x6, double x7, double x8, double x9, double x10) {
+    auto t2f = x1 + x2;
+    auto t3f = x1 + x3;
+    auto t4f = std::max(t2f, t3f) + x4;
+    auto t5f = std::max(t2f, t3f) + x5;
+    auto t6f = t3f + x6;
+    auto t7f = t3f + x7;
+    auto t8f = std::max({t4f, t5f, t6f, t7f}) + x8;
+    auto t9f = t5f + x9;
+    return std::max({t7f, t8f, t9f}) + x10;
+}
+
+#endif // WORK_TIME_HPP
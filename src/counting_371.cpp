@@ -9,7 +9,14 @@
 #include <numeric>
 #include <functional>
 #include <array>
+#include <memory>
+#include <stdexcept>
+#include <string>
 #include "sfmt/SFMT.h"
+#include "sfmt/SFMT-jump.h"
+#include "monte_carlo.hpp"
+#include "student_assignment.hpp"
+#include "perf_counters.hpp"
 
 #include <boost/math/distributions/normal.hpp>
 
@@ -45,27 +52,46 @@ std::array<size_t, NumStudents> random_assignment(sfmt_t& rnd_state) {
     return assignment;
 }
 
-template <size_t r,
-          size_t K,
-          typename SolutionMaker,
-          typename SetFunction>
-auto montecarlo_couting(size_t N,
-                        SolutionMaker solution_maker,
-                        std::array<SetFunction, K> subsets,
-                        double delta) {
+struct solution_count {
     size_t S = 0;
 
-    for (size_t i = 0; i < N; ++i) {
-        auto solution = solution_maker();
-        if (std::find_if_not(subsets.begin(),
-                             subsets.end(),
-                             [&solution](const SetFunction& subsets) {
-                                 return subsets(solution);
-                             }) == subsets.end()) {
-            ++S;
+    void merge(const solution_count& other) {
+        S += other.S;
+    }
+};
+
+// counts the random solutions that are in all the subsets
+template <size_t NumStudents, size_t NumProfesors, size_t K>
+struct counting_kernel {
+    typedef sfmt_t state_type;
+
+    std::array<typename Set_Function<NumStudents>::type, K> subsets;
+
+    state_type make_state(size_t worker) const {
+        sfmt_t rnd_state;
+        // one seed, a disjoint substream for each worker
+        sfmt_init_substream(&rnd_state, 54321, worker);
+        return rnd_state;
+    }
+
+    void operator()(sfmt_t& rnd_state, size_t begin, size_t end, solution_count& acc) const {
+        for (size_t i = begin; i < end; ++i) {
+            auto solution = random_assignment<NumStudents, NumProfesors>(rnd_state);
+            if (std::find_if_not(subsets.begin(),
+                                 subsets.end(),
+                                 [&solution](const typename Set_Function<NumStudents>::type& subset) {
+                                     return subset(solution);
+                                 }) == subsets.end()) {
+                ++acc.S;
+            }
         }
     }
+};
 
+template <size_t r>
+auto montecarlo_couting(size_t N,
+                        size_t S,
+                        double delta) {
     auto Cn = r * S / N;
     auto VCn = Cn * (r - Cn) / (N - 1);
     auto StdDev = std::sqrt(VCn);
@@ -82,72 +108,56 @@ auto montecarlo_couting(size_t N,
 template <size_t NumStudents, size_t NumProfesors, size_t K>
 auto students_assignment(size_t N,
                          const std::array<typename Set_Function<NumStudents>::type, K>& set_functions,
+                         perf_counters* counters = nullptr,
                          double delta = 0.05) {
-    sfmt_t rnd_state;
-    sfmt_init_gen_rand(&rnd_state, 54321);
+    typedef counting_kernel<NumStudents, NumProfesors, K> kernel;
+    monte_carlo_runner<kernel, solution_count> runner(kernel{set_functions});
+    runner.set_perf_counters(counters);
 
     // cardinality of the solution space
     constexpr size_t r = power(NumProfesors, NumStudents);
 
-    return montecarlo_couting<r, K>(N,
-                                    [&rnd_state]() {
-                                        return random_assignment<NumStudents, NumProfesors>(rnd_state);
-                                    },
-                                    set_functions,
-                                    delta);
+    return montecarlo_couting<r>(N, runner.run(N).S, delta);
 }
 
 
 int main(int argc, char * argv[]) {
-    auto N = 1000;
-
-    if (argc > 1) {
-        N = std::stoll(argv[1]);
-    }
-
-    // bit flags
-    const uint8_t SPANISH    = 1;
-    const uint8_t ENGLISH    = 2;
-    const uint8_t FRENCH     = 4;
-    const uint8_t PORTUGUESE = 8;
-
-    std::array<size_t, 10> students = {{SPANISH | ENGLISH,          // Maria
-                                        ENGLISH | FRENCH,           // Sophie
-                                        SPANISH | PORTUGUESE,       // Liliana
-                                        ENGLISH | PORTUGUESE,       // Lucia
-                                        FRENCH,                     // Monique
-                                        SPANISH | ENGLISH | FRENCH, // Rodrigo
-                                        ENGLISH,                    // John
-                                        PORTUGUESE | SPANISH,       // Neymar
-                                        FRENCH | PORTUGUESE,        // Jacques
-                                        SPANISH} };                 // Juan
-
-    std::array<size_t, 4> professors = {{ENGLISH | FRENCH | SPANISH, // Tom
-                                         ENGLISH | PORTUGUESE,       // Luciana
-                                         ENGLISH | FRENCH,           // Gerard
-                                         SPANISH | FRENCH} };        // Silvia
-
-    // solution is a NumStudents vector of integers in [0, NumProfessors)
-    typedef std::array<size_t, students.size()> Solution_Type;
-
-    // predicate that tells whether a solution is in the set S1, with S1 being
-    // the set of assignments where the student shares at least one language with the professor
-    auto language_matches = [&](const Solution_Type& assignment) {
-        for (size_t student = 0; student < assignment.size(); ++student) {
-            auto professor = assignment[student];
-
-            if (0 == (professors[professor] & students[student])) {
-                return false;
+    size_t N = 1000;
+    bool count_perf = false;
+    auto usage = [&] {
+        std::cerr << "Usage: " << argv[0] << " [<N>] [--perf-counters]" << std::endl;
+        return 1;
+    };
+    for (int i = 1; i < argc; ++i) {
+        std::string arg{ argv[i] };
+        try {
+            if (arg == "--perf-counters") {
+                count_perf = true;
+            } else if (arg.rfind("--", 0) != 0) {
+                auto value = std::stoll(arg);
+                if (value < 1) {
+                    throw std::out_of_range(arg);
+                }
+                N = value;
+            } else {
+                throw std::invalid_argument(arg);
             }
+        } catch (std::invalid_argument& e) {
+            return usage();
+        } catch (std::out_of_range& e) {
+            return usage();
         }
-
-        return true;
+    }
+    // counters of the kernel calls of a run, on the threads of the shared pool
+    auto make_counters = [count_perf] {
+        return count_perf ? std::make_unique<perf_counters>(work_stealing_pool::shared().size()) : nullptr;
     };
 
     {
         std::cout << "\nCounting with only one restriction" << std::endl;
+        auto counters = make_counters();
         auto begin_tp = chrono::steady_clock::now();
-        auto [Cn, VCn, StdDev, errorAC, errorN] = students_assignment<students.size(), professors.size(),  1>(N, {language_matches});
+        auto [Cn, VCn, StdDev, errorAC, errorN] = students_assignment<students.size(), professors.size(),  1>(N, {language_matches}, counters.get());
         auto duration = chrono::duration_cast<float_milliseconds>(chrono::steady_clock::now() - begin_tp);
         std::cout << "samples : " << N << " (10^" << (int)std::log10(N) << ")" << std::endl;
         std::cout << "time    : " << std::fixed << std::setprecision(3) << duration.count() << " ms" << std::endl;
@@ -156,25 +166,16 @@ int main(int argc, char * argv[]) {
         std::cout << "StdDev  : " << (size_t)StdDev << std::endl;
         std::cout << "Error AC: " << (size_t)errorAC << std::endl;
         std::cout << "Error N : " << (size_t)errorN << std::endl;
-    }
-
-    // predicate that tells whether a solution is in the set S2, with S2 being the set
-    // of assignments where each processor has at least one student and no more than 4
-    auto student_count_check = [&](const Solution_Type& assignment) {
-        std::array<size_t, professors.size()> counts = {0};
-        for (auto professor : assignment) {
-            ++counts[professor];
+        if (counters) {
+            counters->print(std::cout);
         }
-        return std::find_if(counts.begin(), counts.end(),
-                            [](size_t count) {
-                                return count == 0 || count > 4;
-                            }) == counts.end();
-    };
+    }
 
     {
         std::cout << "\nCounting with 2 restrictions" << std::endl;
+        auto counters = make_counters();
         auto begin_tp = chrono::steady_clock::now();
-        auto [Cn, VCn, StdDev, errorAC, errorN] = students_assignment<students.size(), professors.size(), 2>(N, {language_matches, student_count_check});
+        auto [Cn, VCn, StdDev, errorAC, errorN] = students_assignment<students.size(), professors.size(), 2>(N, {language_matches, student_count_check}, counters.get());
         auto duration = chrono::duration_cast<float_milliseconds>(chrono::steady_clock::now() - begin_tp);
         std::cout << "samples : " << N << " (10^" << (int)std::log10(N) << ")" << std::endl;
         std::cout << "time    : " << std::fixed << std::setprecision(3) << duration.count() << " ms" << std::endl;
@@ -183,6 +184,9 @@ int main(int argc, char * argv[]) {
         std::cout << "StdDev  : " << (size_t)StdDev << std::endl;
         std::cout << "Error AC: " << (size_t)errorAC << std::endl;
         std::cout << "Error N : " << (size_t)errorN << std::endl;
+        if (counters) {
+            counters->print(std::cout);
+        }
     }
 
     return 0;
@@ -2,88 +2,346 @@
 #include <iomanip>
 #include <chrono>
 #include <tuple>
-#include <thread>
 #include <vector>
 #include <cmath>
 #include <algorithm>
 #include <numeric>
 #include <functional>
 #include <array>
+#include <memory>
+#include <string>
+#include <spawn.h>
+#include <sys/wait.h>
 #include "sfmt/SFMT.h"
+#include "sfmt/SFMT-jump.h"
+#include "hypersphere.hpp"
+#include "qmc.hpp"
+#include "monte_carlo.hpp"
+#include "checkpoint.hpp"
+#include "distributed.hpp"
+#include "perf_counters.hpp"
+#include "progress.hpp"
+#include "running_moments.hpp"
 
 namespace chrono = std::chrono;
 
-typedef std::array<double, 6> M_Vector;
+// points per call to sfmt_fill_array_real1, 6 * block_points must be a multiple of 4
+static const size_t block_points = 1024;
+static const uint32_t sfmt_seed = 10000;
+// fewer points leave a replicate with no estimate of its own
+static const size_t min_replicate_points = 8;
 
-static const M_Vector hs_center{ {0.45, 0.5, 0.6, 0.6, 0.5, 0.45} };
-static const double hs_radius = 0.35;
-static const double hs_sqradius = hs_radius * hs_radius;
+enum class point_source {
+    sfmt,
+    sobol,       // owen scrambled
+    sobol_shift, // digital shift
+    halton       // random digit scrambling
+};
+
+struct hit_count {
+    size_t hits = 0;
+
+    void merge(const hit_count& other) {
+        hits += other.hits;
+    }
+};
+
+// pseudo-random points, the SFMT stream of each chunk is seeded with
+// (seed, chunk), so the result does not depend on the number of threads
+struct sfmt_kernel {
+    typedef sfmt_t state_type;
+
+    bool extra_restrictions;
+
+    // the stream of run(), run_ordered() seeds each chunk instead
+    state_type make_state(size_t worker) const {
+        sfmt_t rnd_state;
+        sfmt_init_substream(&rnd_state, sfmt_seed, worker);
+        return rnd_state;
+    }
+
+    void seed_chunk(sfmt_t& rnd_state, size_t chunk) const {
+        uint32_t key[] = { sfmt_seed, 0, uint32_t(chunk), uint32_t(uint64_t(chunk) >> 32) };
+        sfmt_init_by_array(&rnd_state, key, 4);
+    }
+
+    void operator()(sfmt_t& rnd_state, size_t begin, size_t end, hit_count& acc) const {
+        // points are drawn in blocks, same numbers as sfmt_genrand_real1,
+        // coordinate d of point j is block[d * block_points + j]
+        alignas(64) double block[6 * block_points];
+        for (; begin < end; begin += block_points) {
+            sfmt_fill_array_real1(&rnd_state, block, 6 * block_points);
+            acc.hits += count_in_region(block, block_points, std::min(block_points, end - begin), extra_restrictions);
+        }
+    }
+};
+
+// hits of each replicate of a quasi-random sequence
+struct replicate_hits {
+    std::vector<size_t> hits;
+
+    void merge(const replicate_hits& other) {
+        hits.resize(std::max(hits.size(), other.hits.size()));
+        for (size_t r = 0; r < other.hits.size(); ++r) {
+            hits[r] += other.hits[r];
+        }
+    }
+};
+
+// sample s is point s % n of replicate s / n
+struct qmc_kernel {
+    struct state_type {};
+
+    size_t n;
+    size_t replicates;
+    point_source source;
+    bool extra_restrictions;
+
+    state_type make_state(size_t) const {
+        return state_type{};
+    }
+
+    void operator()(state_type&, size_t begin, size_t end, replicate_hits& acc) const {
+        acc.hits.resize(replicates);
+        while (begin < end) {
+            auto r = begin / n;
+            auto last = std::min(end, (r + 1) * n);
+            auto seed = 10000 + r;
+            if (source == point_source::halton) {
+                acc.hits[r] += count_hits(halton_sequence(6, true, seed), begin - r * n, last - r * n);
+            } else {
+                auto scramble = source == point_source::sobol ? sobol_sequence::owen : sobol_sequence::digital_shift;
+                acc.hits[r] += count_hits(sobol_sequence(6, scramble, seed), begin - r * n, last - r * n);
+            }
+            begin = last;
+        }
+    }
+
+    // counts the hits of the points [begin, end) of a replicate
+    template <class Sequence>
+    size_t count_hits(Sequence&& seq, size_t begin, size_t end) const {
+        std::vector<double> block(6 * block_points);
+        size_t acc = 0;
+        seq.seek(begin);
+        for (; begin < end; begin += block_points) {
+            auto count = std::min(block_points, end - begin);
+            seq.fill(block.data(), count);
+            for (size_t j = 0; j < count; ++j) {
+                acc += in_region(&block[6 * j], extra_restrictions);
+            }
+        }
+        return acc;
+    }
+};
+
+struct progress_options {
+    bool enabled = false;
+    std::string path; // stderr if empty
+    chrono::seconds interval{10};
+
+    std::unique_ptr<progress_monitor> make_monitor(size_t workers) const {
+        return enabled ? std::make_unique<progress_monitor>(workers, path, interval) : nullptr;
+    }
+};
+
+// moments of the hit indicator, for the progress reports
+static running_moments hit_moments(size_t hits, size_t samples) {
+    double p = double(hits) / samples;
+    return running_moments(samples, p, samples * p * (1 - p));
+}
+
+// randomized quasi-Monte Carlo: the error comes from independent
+// replicates of N / replicates points
+static void run_qmc_simulation(const size_t N,
+    const bool extra_restrictions,
+    const point_source source,
+    const size_t replicates,
+    const progress_options& progress,
+    const bool count_perf) {
+    typedef chrono::duration<long double, std::milli> float_milliseconds;
+
+    const size_t n = N / replicates;
+    monte_carlo_runner<qmc_kernel, replicate_hits> runner(qmc_kernel{n, replicates, source, extra_restrictions});
+    auto monitor = progress.make_monitor(runner.num_workers());
+    if (monitor) {
+        monitor->set_target(n * replicates);
+        runner.set_progress(monitor.get(), [](const replicate_hits& acc, size_t samples) {
+            return hit_moments(std::accumulate(acc.hits.begin(), acc.hits.end(), size_t(0)), samples);
+        });
+    }
+    std::unique_ptr<perf_counters> counters;
+    if (count_perf) {
+        counters.reset(new perf_counters(runner.num_workers()));
+        runner.set_perf_counters(counters.get());
+    }
+
+    chrono::steady_clock::time_point begin_tp = chrono::steady_clock::now();
+
+    auto result = runner.run(n * replicates);
+
+    std::vector<double> lambdas(replicates);
+    for (size_t r = 0; r < replicates; ++r) {
+        lambdas[r] = double(result.hits[r]) / n;
+    }
+    auto lambda_hat = std::accumulate(lambdas.begin(), lambdas.end(), 0.0) / replicates;
+    auto variance = 0.0;
+    for (auto lambda : lambdas) {
+        variance += (lambda - lambda_hat) * (lambda - lambda_hat);
+    }
+    variance = variance / (replicates - 1) / replicates;
+
+    auto duration = chrono::duration_cast<float_milliseconds>(chrono::steady_clock::now() - begin_tp);
+
+    std::cout << "samples:   " << n * replicates << " (10^" << std::log10(n * replicates) << "), "
+              << replicates << " replicates" << std::endl;
+    std::cout << "λ(R):      " << std::scientific << std::setprecision(5) << lambda_hat << std::endl;
+    std::cout << "Var[λ(R)]: " << std::scientific << std::setprecision(5) << variance << std::endl;
+    std::cout << "stddev:    " << std::scientific << std::setprecision(5) << std::sqrt(variance) << std::endl;
+    std::cout << "time:      " << std::fixed << std::setprecision(3) << duration.count() << " ms" << std::endl;
+    if (counters) {
+        counters->print(std::cout);
+    }
+}
+
+struct checkpoint_options {
+    std::string path; // no checkpoints if empty
+    bool resume = false;
+    chrono::seconds interval{60};
+};
+
+// the run of the SFMT points, for checkpoints and workers
+static std::string sfmt_tag(const bool extra_restrictions) {
+    return extra_restrictions ? "integration_231/sfmt-soa" : "integration_231/sfmt-soa/no-extra-restrictions";
+}
 
 static void run_simulation(const size_t N,
-    const size_t num_threads,
-    const bool extra_restrictions) {
+    const bool extra_restrictions,
+    const checkpoint_options& checkpoints,
+    const progress_options& progress,
+    const bool count_perf) {
     typedef chrono::duration<long double, std::milli> float_milliseconds;
 
-    std::vector<std::thread> threads;
-    std::vector<double> partial_results(num_threads);
+    monte_carlo_runner<sfmt_kernel, hit_count> runner(sfmt_kernel{extra_restrictions});
+    auto monitor = progress.make_monitor(runner.num_workers());
+    if (monitor) {
+        monitor->set_target(N);
+        runner.set_progress(monitor.get(), [](const hit_count& acc, size_t samples) {
+            return hit_moments(acc.hits, samples);
+        });
+    }
+    std::unique_ptr<perf_counters> counters;
+    if (count_perf) {
+        counters.reset(new perf_counters(runner.num_workers()));
+        runner.set_perf_counters(counters.get());
+    }
+    std::string tag = sfmt_tag(extra_restrictions);
+    if (checkpoints.resume) {
+        auto saved = checkpoint_resume(runner, checkpoints.path, tag);
+        // another N would start over, or estimate from other samples
+        if (saved.target != N) {
+            throw std::runtime_error("checkpoint: " + checkpoints.path + " is of a run of " +
+                                     std::to_string(saved.target) + " samples, not " + std::to_string(N));
+        }
+        std::cout << "resumed:   " << saved.samples() << " samples from " << checkpoints.path << std::endl;
+        if (monitor) {
+            monitor->set_base(saved.samples(), hit_moments(saved.result.hits, saved.samples()));
+        }
+    }
+    std::unique_ptr<checkpoint_writer> writer;
+    if (!checkpoints.path.empty()) {
+        writer.reset(new checkpoint_writer(checkpoints.path));
+    }
 
     chrono::steady_clock::time_point begin_tp = chrono::steady_clock::now();
 
-    for (size_t i = 0; i < num_threads; ++i) {
-        threads.emplace_back([&, i] {
-            sfmt_t rnd_state;
-            sfmt_init_gen_rand(&rnd_state, (i + 1) * 10000);
-
-            auto acc = 0lu;
-            for (auto beg = i * N / num_threads, end = (i + 1) * N / num_threads;
-                beg < end;
-                ++beg) {
-                M_Vector point{ {sfmt_genrand_real1(&rnd_state),
-                                sfmt_genrand_real1(&rnd_state),
-                                sfmt_genrand_real1(&rnd_state),
-                                sfmt_genrand_real1(&rnd_state),
-                                sfmt_genrand_real1(&rnd_state),
-                                sfmt_genrand_real1(&rnd_state)} };
-                M_Vector distance_vector{ {point[0] - hs_center[0],
-                                          point[1] - hs_center[1],
-                                          point[2] - hs_center[2],
-                                          point[3] - hs_center[3],
-                                          point[4] - hs_center[4],
-                                          point[5] - hs_center[5]} };
-                auto sq_distance = std::inner_product(distance_vector.begin(), distance_vector.end(), distance_vector.begin(), 0.0);
-
-                if (sq_distance <= hs_sqradius &&
-                    (!extra_restrictions || (3 * point[0] + 7 * point[3] <= 5 &&
-                        point[2] + point[3] <= 1 &&
-                        point[0] - point[1] - point[4] + point[5] >= 0))) {
-                    acc += 1;
-                }
-            }
-            partial_results[i] = acc;
-            });
+    auto lambda_hat = double(run_checkpointed(runner, N, tag, writer.get(), checkpoints.interval).hits) / N;
+
+    auto variance = lambda_hat * (1 - lambda_hat) / (N - 1);
+
+    auto duration = chrono::duration_cast<float_milliseconds>(chrono::steady_clock::now() - begin_tp);
+
+    std::cout << "samples:   " << N << " (10^" << std::log10(N) << ")" << std::endl;
+    std::cout << "λ(R):      " << std::scientific << std::setprecision(5) << lambda_hat << std::endl;
+    std::cout << "Var[λ(R)]: " << std::scientific << std::setprecision(5) << variance << std::endl;
+    std::cout << "stddev:    " << std::scientific << std::setprecision(5) << std::sqrt(variance) << std::endl;
+    std::cout << "time:      " << std::fixed << std::setprecision(3) << duration.count() << " ms" << std::endl;
+    if (counters) {
+        counters->print(std::cout);
     }
+}
+
+struct distributed_options {
+    std::string coordinator; // address to listen on for workers
+    std::string worker;      // address of the coordinator to work for
+    size_t local_workers = 0;
+};
+
+// the run of the SFMT points by the worker processes of a coordinator, with
+// the result of run_simulation whatever workers take part
+static void run_coordinator(const size_t N,
+    const bool extra_restrictions,
+    const distributed_options& distributed,
+    const char* program) {
+    typedef chrono::duration<long double, std::milli> float_milliseconds;
+
+    distributed_coordinator<hit_count> coordinator(distributed.coordinator, sfmt_tag(extra_restrictions),
+                                                   monte_carlo_runner<sfmt_kernel, hit_count>::ordered_chunk_size);
 
-    for (auto& t : threads) {
-        t.join();
+    // workers of this program on this host, more can join from anywhere
+    std::vector<pid_t> children;
+    for (size_t i = 0; i < distributed.local_workers; ++i) {
+        std::vector<std::string> args{ program, std::to_string(N), "--worker=" + distributed.coordinator };
+        if (!extra_restrictions) {
+            args.push_back("--no-extra-restrictions");
+        }
+        std::vector<char*> child_argv;
+        for (auto& arg : args) {
+            child_argv.push_back(&arg[0]);
+        }
+        child_argv.push_back(nullptr);
+        pid_t pid;
+        if (::posix_spawn(&pid, "/proc/self/exe", nullptr, nullptr, child_argv.data(), environ) == 0) {
+            children.push_back(pid);
+        } else {
+            std::cerr << "Cannot start a local worker" << std::endl;
+        }
     }
+    std::cerr << "waiting for workers on " << distributed.coordinator << std::endl;
+
+    chrono::steady_clock::time_point begin_tp = chrono::steady_clock::now();
 
-    auto lambda_hat = std::accumulate(partial_results.begin(), partial_results.end(), 0.0);
-    lambda_hat = lambda_hat / N;
+    auto lambda_hat = double(coordinator.run(N).hits) / N;
 
     auto variance = lambda_hat * (1 - lambda_hat) / (N - 1);
 
     auto duration = chrono::duration_cast<float_milliseconds>(chrono::steady_clock::now() - begin_tp);
 
+    for (auto pid : children) {
+        ::waitpid(pid, nullptr, 0);
+    }
+
     std::cout << "samples:   " << N << " (10^" << std::log10(N) << ")" << std::endl;
     std::cout << "λ(R):      " << std::scientific << std::setprecision(5) << lambda_hat << std::endl;
     std::cout << "Var[λ(R)]: " << std::scientific << std::setprecision(5) << variance << std::endl;
     std::cout << "stddev:    " << std::scientific << std::setprecision(5) << std::sqrt(variance) << std::endl;
     std::cout << "time:      " << std::fixed << std::setprecision(3) << duration.count() << " ms" << std::endl;
+    std::cout << "workers:   " << coordinator.worker_count() << ", " << coordinator.dropped_count()
+              << " dropped with chunks computed again" << std::endl;
+}
+
+// computes chunks of the SFMT points for the coordinator at address
+static void run_worker(const bool extra_restrictions, const std::string& address) {
+    monte_carlo_runner<sfmt_kernel, hit_count> runner(sfmt_kernel{extra_restrictions});
+    distributed_work(runner, address, sfmt_tag(extra_restrictions));
 }
 
 int main(int argc, char* argv[]) {
-    if (argc < 2 || argc > 3) {
-        std::cerr << "Usage: " << argv[0] << " <N> [--no-extra-restrictions]" << std::endl;
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <N> [--no-extra-restrictions]"
+                  << " [--sobol | --sobol-shift | --halton] [--replicates=<R>]"
+                  << " [--checkpoint=<file>] [--checkpoint-interval=<s>] [--resume]"
+                  << " [--progress[=<file>]] [--progress-interval=<s>] [--perf-counters]"
+                  << " [--coordinator=<address> [--local-workers=<n>] | --worker=<address>]" << std::endl;
         return 1;
     }
 
@@ -97,11 +355,123 @@ int main(int argc, char* argv[]) {
     }
 
     bool extra_restrictions = true;
-    if (argc == 3) {
-        extra_restrictions = std::string{ "--no-extra-restrictions" } != argv[2];
+    auto source = point_source::sfmt;
+    size_t replicates = 16;
+    checkpoint_options checkpoints;
+    progress_options progress;
+    bool count_perf = false;
+    distributed_options distributed;
+    for (int i = 2; i < argc; ++i) {
+        std::string arg{ argv[i] };
+        if (arg == "--no-extra-restrictions") {
+            extra_restrictions = false;
+        } else if (arg == "--sobol") {
+            source = point_source::sobol;
+        } else if (arg == "--sobol-shift") {
+            source = point_source::sobol_shift;
+        } else if (arg == "--halton") {
+            source = point_source::halton;
+        } else if (arg.rfind("--replicates=", 0) == 0) {
+            try {
+                replicates = std::stoll(arg.substr(13));
+            } catch (std::invalid_argument& e) {
+                replicates = 0;
+            }
+            if (replicates < 2) {
+                std::cerr << "Invalid argument: " << arg << std::endl;
+                return 1;
+            }
+        } else if (arg.rfind("--checkpoint=", 0) == 0) {
+            checkpoints.path = arg.substr(13);
+        } else if (arg.rfind("--checkpoint-interval=", 0) == 0) {
+            try {
+                checkpoints.interval = chrono::seconds(std::stoll(arg.substr(22)));
+            } catch (std::invalid_argument& e) {
+                std::cerr << "Invalid argument: " << arg << std::endl;
+                return 1;
+            }
+        } else if (arg == "--resume") {
+            checkpoints.resume = true;
+        } else if (arg == "--progress" || arg.rfind("--progress=", 0) == 0) {
+            progress.enabled = true;
+            progress.path = arg.size() > 10 ? arg.substr(11) : "";
+        } else if (arg.rfind("--progress-interval=", 0) == 0) {
+            try {
+                progress.interval = chrono::seconds(std::stoll(arg.substr(20)));
+            } catch (std::invalid_argument& e) {
+                progress.interval = chrono::seconds(0);
+            }
+            if (progress.interval.count() < 1) {
+                std::cerr << "Invalid argument: " << arg << std::endl;
+                return 1;
+            }
+        } else if (arg == "--perf-counters") {
+            count_perf = true;
+        } else if (arg.rfind("--coordinator=", 0) == 0) {
+            distributed.coordinator = arg.substr(14);
+        } else if (arg.rfind("--worker=", 0) == 0) {
+            distributed.worker = arg.substr(9);
+        } else if (arg.rfind("--local-workers=", 0) == 0) {
+            try {
+                distributed.local_workers = std::stoll(arg.substr(16));
+            } catch (std::invalid_argument& e) {
+                std::cerr << "Invalid argument: " << arg << std::endl;
+                return 1;
+            }
+        } else {
+            std::cerr << "Invalid argument: " << arg << std::endl;
+            return 1;
+        }
+    }
+
+    if ((checkpoints.resume || !checkpoints.path.empty()) &&
+        (source != point_source::sfmt || checkpoints.path.empty())) {
+        std::cerr << "Checkpoints need --checkpoint=<file> and the SFMT points" << std::endl;
+        return 1;
+    }
+
+    bool distributing = !distributed.coordinator.empty() || !distributed.worker.empty();
+    if (distributing && (source != point_source::sfmt || !checkpoints.path.empty() || progress.enabled || count_perf ||
+                         (!distributed.coordinator.empty() && !distributed.worker.empty()))) {
+        std::cerr << "--coordinator and --worker are for the SFMT points, without checkpoints,"
+                  << " progress or perf counters, and exclude each other" << std::endl;
+        return 1;
+    }
+    if (distributed.local_workers && distributed.coordinator.empty()) {
+        std::cerr << "--local-workers needs --coordinator=<address>" << std::endl;
+        return 1;
+    }
+    if (distributing) {
+        try {
+            if (!distributed.worker.empty()) {
+                run_worker(extra_restrictions, distributed.worker);
+            } else {
+                run_coordinator(N, extra_restrictions, distributed, argv[0]);
+            }
+        } catch (std::runtime_error& e) {
+            std::cerr << e.what() << std::endl;
+            return 1;
+        }
+        return 0;
     }
 
-    auto hw = std::thread::hardware_concurrency();
-    run_simulation(N, hw, extra_restrictions);
+    // starts the threads before the measurements
+    work_stealing_pool::shared();
+    if (source == point_source::sfmt) {
+        try {
+            run_simulation(N, extra_restrictions, checkpoints, progress, count_perf);
+        } catch (std::runtime_error& e) {
+            std::cerr << e.what() << std::endl;
+            return 1;
+        }
+    } else if (N / replicates < min_replicate_points) {
+        std::cerr << "At least " << min_replicate_points << " points per replicate" << std::endl;
+        return 1;
+    } else if (N / replicates > sobol_sequence::max_points) {
+        std::cerr << "At most " << sobol_sequence::max_points << " points per replicate" << std::endl;
+        return 1;
+    } else {
+        run_qmc_simulation(N, extra_restrictions, source, replicates, progress, count_perf);
+    }
     return 0;
 }
@@ -0,0 +1,448 @@
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <chrono>
+#include <atomic>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <cmath>
+#include <cstring>
+#include "sfmt/SFMT.h"
+#include "sfmt_buffered_engine.hpp"
+#include "ziggurat.hpp"
+#include "cone_integrand.hpp"
+#include "normal_quantile.hpp"
+#include "hypersphere.hpp"
+#include "work_time.hpp"
+#include "student_assignment.hpp"
+
+#include <boost/math/distributions/normal.hpp>
+#include <boost/math/distributions/students_t.hpp>
+
+namespace chrono = std::chrono;
+namespace math = boost::math;
+
+// time per sample of the kernels of the simulations, each alone on inputs
+// drawn beforehand, and a check of their results against plain reference
+// implementations, as JSON: make bench-kernels, or kernel_bench
+// [--repetitions=<n>] [--min-time=<ms>] [--filter=<substring>] [--output=<file>]
+//
+// A repetition runs the kernel over all the inputs as many times as fit in
+// the minimum time; the statistics are over the repetitions. The exit
+// status is 1 if a kernel disagrees with its reference.
+
+// samples of the inputs of a kernel, which stay in L2 for every kernel
+static const size_t input_samples = 1 << 14;
+
+static const uint32_t input_seed = 4321;
+
+// the results of every pass end here, so that they are not optimized away
+static std::atomic<uint64_t> result_sink(0);
+
+template <class T>
+static uint64_t bits_of(T value) {
+    uint64_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(T));
+    return bits;
+}
+
+struct kernel_case {
+    std::string kernel;
+    std::string program; // where the simulations use it
+    // one pass over the inputs, the result goes to sink
+    std::function<void(uint64_t& sink)> pass;
+    // the samples for which the kernel and the reference disagree
+    std::function<size_t()> check;
+};
+
+struct statistics {
+    double median;
+    double mean;
+    double stddev;
+    double min;
+    double ci; // half-width of the 95% confidence interval of the mean
+};
+
+static std::vector<double> uniform_inputs(sfmt_t& rnd_state, size_t count) {
+    std::vector<double> values(count);
+    for (auto& v : values) {
+        v = sfmt_genrand_real1(&rnd_state);
+    }
+    return values;
+}
+
+static std::vector<kernel_case> all_cases() {
+    std::vector<kernel_case> cases;
+    sfmt_t rnd_state;
+    sfmt_init_gen_rand(&rnd_state, input_seed);
+
+    // points of the unit square
+    auto square = std::make_shared<std::vector<double>>(uniform_inputs(rnd_state, 2 * input_samples));
+    cases.push_back(kernel_case{"K_fn", "integration_261, va_simulation_411",
+        [square](uint64_t& sink) {
+            const auto& in = *square;
+            double sum = 0.0;
+            for (size_t i = 0; i < input_samples; ++i) {
+                sum += K_fn(Vector2{{in[2 * i], in[2 * i + 1]}});
+            }
+            sink ^= bits_of(sum);
+        },
+        [square] {
+            const auto& in = *square;
+            size_t mismatches = 0;
+            for (size_t i = 0; i < input_samples; ++i) {
+                double d = std::hypot(in[2 * i] - 0.5, in[2 * i + 1] - 0.5);
+                double reference = d <= 0.4 ? 8.0 * (1 - d / 0.4) : 0.0;
+                mismatches += std::abs(K_fn(Vector2{{in[2 * i], in[2 * i + 1]}}) - reference) > 1e-12;
+            }
+            return mismatches;
+        }});
+
+    // radii with density 2r and normal directions, as toss_point draws them
+    auto polar = std::make_shared<std::vector<double>>(3 * input_samples);
+    {
+        sfmt_buffered_engine engine(input_seed);
+        ziggurat_normal normal(engine);
+        for (size_t i = 0; i < input_samples; ++i) {
+            (*polar)[3 * i] = std::sqrt(engine.canonical());
+            (*polar)[3 * i + 1] = normal();
+            (*polar)[3 * i + 2] = normal();
+        }
+    }
+    cases.push_back(kernel_case{"circle_point", "va_simulation_411 (toss_point)",
+        [polar](uint64_t& sink) {
+            const auto& in = *polar;
+            double sum = 0.0;
+            for (size_t i = 0; i < input_samples; ++i) {
+                auto point = circle_point(in[3 * i], in[3 * i + 1], in[3 * i + 2]);
+                sum += point[0] + point[1];
+            }
+            sink ^= bits_of(sum);
+        },
+        [polar] {
+            const auto& in = *polar;
+            size_t mismatches = 0;
+            for (size_t i = 0; i < input_samples; ++i) {
+                double angle = std::atan2(in[3 * i + 2], in[3 * i + 1]);
+                auto point = circle_point(in[3 * i], in[3 * i + 1], in[3 * i + 2]);
+                mismatches += std::abs(point[0] - (0.5 + 0.4 * in[3 * i] * std::cos(angle))) > 1e-12 ||
+                              std::abs(point[1] - (0.5 + 0.4 * in[3 * i] * std::sin(angle))) > 1e-12;
+            }
+            return mismatches;
+        }});
+
+    // probabilities in (0,1)
+    auto probabilities = std::make_shared<std::vector<double>>(input_samples);
+    for (auto& p : *probabilities) {
+        p = sfmt_genrand_real3(&rnd_state);
+    }
+    cases.push_back(kernel_case{"normal_cdf_inverse", "va_simulation_411 (USE_INVERSE_TRANSFORM)",
+        [probabilities](uint64_t& sink) {
+            double sum = 0.0;
+            for (auto p : *probabilities) {
+                sum += normal_cdf_inverse(p);
+            }
+            sink ^= bits_of(sum);
+        },
+        [probabilities] {
+            math::normal ndist;
+            size_t mismatches = 0;
+            for (auto p : *probabilities) {
+                // the bound of Abramowitz and Stegun 26.2.23
+                mismatches += std::abs(normal_cdf_inverse(p) - math::quantile(ndist, p)) >= 4.5e-4;
+            }
+            return mismatches;
+        }});
+
+    // points of the unit hypercube
+    auto hypercube = std::make_shared<std::vector<double>>(uniform_inputs(rnd_state, 6 * input_samples));
+    for (bool extra_restrictions : {true, false}) {
+        cases.push_back(kernel_case{extra_restrictions ? "in_region" : "in_region (hypersphere only)",
+            "integration_231, randomgen_481",
+            [hypercube, extra_restrictions](uint64_t& sink) {
+                const auto& in = *hypercube;
+                uint64_t hits = 0;
+                for (size_t i = 0; i < input_samples; ++i) {
+                    hits += in_region(&in[6 * i], extra_restrictions);
+                }
+                sink ^= hits;
+            },
+            [hypercube, extra_restrictions] {
+                const auto& in = *hypercube;
+                size_t mismatches = 0;
+                for (size_t i = 0; i < input_samples; ++i) {
+                    const double* x = &in[6 * i];
+                    double sq_distance = 0.0;
+                    for (size_t d = 0; d < 6; ++d) {
+                        sq_distance += (x[d] - hs_center[d]) * (x[d] - hs_center[d]);
+                    }
+                    double margins[] = { hs_sqradius - sq_distance,
+                                         5 - (3 * x[0] + 7 * x[3]),
+                                         1 - (x[2] + x[3]),
+                                         x[0] - x[1] - x[4] + x[5] };
+                    bool reference = margins[0] >= 0;
+                    bool near_boundary = std::abs(margins[0]) < 1e-12;
+                    if (extra_restrictions) {
+                        for (size_t c = 1; c < 4; ++c) {
+                            reference = reference && margins[c] >= 0;
+                            near_boundary = near_boundary || std::abs(margins[c]) < 1e-12;
+                        }
+                    }
+                    // a different order of the sums may round a point on
+                    // the boundary to the other side
+                    mismatches += in_region(x, extra_restrictions) != reference && !near_boundary;
+                }
+                return mismatches;
+            }});
+    }
+
+    for (bool extra_restrictions : {true, false}) {
+        cases.push_back(kernel_case{extra_restrictions ? "count_in_region" : "count_in_region (hypersphere only)",
+            "integration_231",
+            [hypercube, extra_restrictions](uint64_t& sink) {
+                // the same numbers as six coordinate arrays
+                sink ^= count_in_region(hypercube->data(), input_samples, input_samples, extra_restrictions);
+            },
+            [hypercube, extra_restrictions] {
+                // the vectors must count exactly the points of in_region, in
+                // whole vectors and in the remainder
+                const auto& in = *hypercube;
+                size_t mismatches = 0;
+                for (size_t count : {input_samples, input_samples - 37, size_t(5)}) {
+                    size_t reference = 0;
+                    for (size_t i = 0; i < count; ++i) {
+                        double x[6];
+                        for (size_t d = 0; d < 6; ++d) {
+                            x[d] = in[d * input_samples + i];
+                        }
+                        reference += in_region(x, extra_restrictions);
+                    }
+                    mismatches += count_in_region(in.data(), input_samples, count, extra_restrictions) != reference;
+                }
+                return mismatches;
+            }});
+    }
+
+    // durations of the tasks, as T1() ... T10() draw them
+    auto durations = std::make_shared<std::vector<double>>(uniform_inputs(rnd_state, 10 * input_samples));
+    for (size_t i = 0; i < durations->size(); ++i) {
+        auto& bounds = task_durations[i % 10];
+        (*durations)[i] = bounds[0] + (*durations)[i] * (bounds[1] - bounds[0]);
+    }
+    cases.push_back(kernel_case{"total_work_time", "total_work_time_estimation (estimate_range)",
+        [durations](uint64_t& sink) {
+            const auto& in = *durations;
+            double sum = 0.0;
+            for (size_t i = 0; i < input_samples; ++i) {
+                const double* x = &in[10 * i];
+                sum += total_work_time(x[0], x[1], x[2], x[3], x[4], x[5], x[6], x[7], x[8], x[9]);
+            }
+            sink ^= bits_of(sum);
+        },
+        [durations] {
+            // every path from task 1 to task 10, numbered from 0
+            static const std::vector<std::vector<size_t>> paths = {
+                {0, 1, 3, 7, 9}, {0, 2, 3, 7, 9}, {0, 1, 4, 7, 9}, {0, 2, 4, 7, 9}, {0, 2, 5, 7, 9},
+                {0, 2, 6, 7, 9}, {0, 2, 6, 9}, {0, 1, 4, 8, 9}, {0, 2, 4, 8, 9}
+            };
+            const auto& in = *durations;
+            size_t mismatches = 0;
+            for (size_t i = 0; i < input_samples; ++i) {
+                const double* x = &in[10 * i];
+                double reference = 0.0;
+                for (auto& path : paths) {
+                    double length = 0.0;
+                    for (auto task : path) {
+                        length += x[task];
+                    }
+                    reference = std::max(reference, length);
+                }
+                double t = total_work_time(x[0], x[1], x[2], x[3], x[4], x[5], x[6], x[7], x[8], x[9]);
+                mismatches += std::abs(t - reference) > 1e-12 * reference;
+            }
+            return mismatches;
+        }});
+
+    // assignments of a professor to each student, as random_assignment draws them
+    auto assignments = std::make_shared<std::vector<Solution_Type>>(input_samples);
+    for (auto& assignment : *assignments) {
+        for (auto& professor : assignment) {
+            professor = sfmt_genrand_uint32(&rnd_state) % professors.size();
+        }
+    }
+    cases.push_back(kernel_case{"language_matches", "counting_371",
+        [assignments](uint64_t& sink) {
+            uint64_t count = 0;
+            for (auto& assignment : *assignments) {
+                count += language_matches(assignment);
+            }
+            sink ^= count;
+        },
+        [assignments] {
+            size_t mismatches = 0;
+            for (auto& assignment : *assignments) {
+                bool reference = true;
+                for (size_t s = 0; s < students.size(); ++s) {
+                    bool shared = false;
+                    for (uint8_t language : {SPANISH, ENGLISH, FRENCH, PORTUGUESE}) {
+                        shared = shared || ((students[s] & language) && (professors[assignment[s]] & language));
+                    }
+                    reference = reference && shared;
+                }
+                mismatches += language_matches(assignment) != reference;
+            }
+            return mismatches;
+        }});
+    cases.push_back(kernel_case{"student_count_check", "counting_371",
+        [assignments](uint64_t& sink) {
+            uint64_t count = 0;
+            for (auto& assignment : *assignments) {
+                count += student_count_check(assignment);
+            }
+            sink ^= count;
+        },
+        [assignments] {
+            size_t mismatches = 0;
+            for (auto& assignment : *assignments) {
+                bool reference = true;
+                for (size_t p = 0; p < professors.size(); ++p) {
+                    auto n = std::count(assignment.begin(), assignment.end(), p);
+                    reference = reference && n >= 1 && n <= 4;
+                }
+                mismatches += student_count_check(assignment) != reference;
+            }
+            return mismatches;
+        }});
+
+    return cases;
+}
+
+// ns per sample of each repetition
+static std::vector<double> run_case(const kernel_case& kc, size_t repetitions, chrono::milliseconds min_time) {
+    typedef chrono::duration<double, std::nano> float_nanoseconds;
+
+    uint64_t sink = 0;
+    kc.pass(sink); // warm up
+
+    std::vector<double> ns_per_sample(repetitions);
+    for (auto& ns : ns_per_sample) {
+        size_t passes = 0;
+        auto begin_tp = chrono::steady_clock::now();
+        auto elapsed = float_nanoseconds::zero();
+        do {
+            kc.pass(sink);
+            ++passes;
+            elapsed = chrono::steady_clock::now() - begin_tp;
+        } while (elapsed < min_time);
+        ns = elapsed.count() / (passes * input_samples);
+    }
+    result_sink ^= sink;
+    return ns_per_sample;
+}
+
+static statistics summarize(std::vector<double> values) {
+    std::sort(values.begin(), values.end());
+    size_t n = values.size();
+    statistics s;
+    s.median = n % 2 ? values[n / 2] : (values[n / 2 - 1] + values[n / 2]) / 2;
+    s.mean = std::accumulate(values.begin(), values.end(), 0.0) / n;
+    s.min = values.front();
+    double sum_sq = 0.0;
+    for (auto v : values) {
+        sum_sq += (v - s.mean) * (v - s.mean);
+    }
+    s.stddev = n > 1 ? std::sqrt(sum_sq / (n - 1)) : 0.0;
+    s.ci = n > 1 ? math::quantile(math::students_t(n - 1), 0.975) * s.stddev / std::sqrt(n) : 0.0;
+    return s;
+}
+
+static std::string json_string(const std::string& s) {
+    std::string out = "\"";
+    for (char c : s) {
+        if (c == '"' || c == '\\') {
+            out += '\\';
+        }
+        out += c;
+    }
+    return out + "\"";
+}
+
+int main(int argc, char* argv[]) {
+    size_t repetitions = 20;
+    auto min_time = chrono::milliseconds(20);
+    std::string filter;
+    std::string output_file;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg{ argv[i] };
+        try {
+            if (arg.rfind("--repetitions=", 0) == 0) {
+                repetitions = std::stoll(arg.substr(14));
+                if (repetitions < 1) {
+                    throw std::invalid_argument(arg);
+                }
+            } else if (arg.rfind("--min-time=", 0) == 0) {
+                min_time = chrono::milliseconds(std::stoll(arg.substr(11)));
+            } else if (arg.rfind("--filter=", 0) == 0) {
+                filter = arg.substr(9);
+            } else if (arg.rfind("--output=", 0) == 0) {
+                output_file = arg.substr(9);
+            } else {
+                throw std::invalid_argument(arg);
+            }
+        } catch (std::invalid_argument& e) {
+            std::cerr << "Usage: " << argv[0] << " [--repetitions=<n>] [--min-time=<ms>]"
+                      << " [--filter=<substring>] [--output=<file>]" << std::endl;
+            return 1;
+        }
+    }
+
+    std::ofstream file;
+    if (!output_file.empty()) {
+        file.open(output_file);
+        if (!file) {
+            std::cerr << "Cannot write " << output_file << std::endl;
+            return 1;
+        }
+    }
+    std::ostream& out = output_file.empty() ? std::cout : file;
+
+    out << "{" << std::endl;
+    out << "  \"input_samples\": " << input_samples << "," << std::endl;
+    out << "  \"repetitions\": " << repetitions << "," << std::endl;
+    out << "  \"min_time_ms\": " << min_time.count() << "," << std::endl;
+    out << "  \"results\": [";
+
+    bool first = true;
+    bool all_match = true;
+    for (auto& kc : all_cases()) {
+        if (kc.kernel.find(filter) == std::string::npos) {
+            continue;
+        }
+        size_t mismatches = kc.check();
+        all_match = all_match && mismatches == 0;
+        auto s = summarize(run_case(kc, repetitions, min_time));
+
+        out << (first ? "" : ",") << std::endl;
+        out << "    {\"kernel\": " << json_string(kc.kernel)
+            << ", \"program\": " << json_string(kc.program)
+            << std::fixed << std::setprecision(4)
+            << ", \"ns_per_sample\": " << s.median
+            << ", \"mean\": " << s.mean
+            << ", \"stddev\": " << s.stddev
+            << ", \"min\": " << s.min
+            << ", \"ci95\": " << s.ci
+            << ", \"mismatches\": " << mismatches << "}";
+        first = false;
+        std::cerr << kc.kernel << ": " << std::setprecision(3) << s.median << " ns/sample (mean "
+                  << s.mean << " ± " << s.ci << "), "
+                  << (mismatches ? std::to_string(mismatches) + " samples differ from the reference" : "reference ok")
+                  << std::endl;
+    }
+    out << std::endl << "  ]" << std::endl << "}" << std::endl;
+    return all_match ? 0 : 1;
+}
@@ -0,0 +1,204 @@
+/**
+ * @file calc-sobol.cpp
+ *
+ * @brief computes the Sobol direction numbers shipped in qmc-sobol-params.h
+ *
+ * Dimension 1 is the van der Corput sequence. Dimension d >= 2 takes the
+ * next primitive polynomial over GF(2), in order of degree and then of
+ * coefficients, and initial direction numbers m_1 ... m_s chosen among
+ * random candidates to minimize the t-values of the two-dimensional
+ * projections (d, j), j < d, for the first 2^m points, m <= MAX_M. This
+ * is the criterion of S. Joe and F. Y. Kuo, "Constructing Sobol sequences
+ * with better two-dimensional projections", SIAM J. Sci. Comput. 30, 2008,
+ * but the numbers are not theirs. The search is deterministic:
+ *
+ * @verbatim
+ c++ -O3 -std=c++17 src/qmc/calc-sobol.cpp -o calc-sobol
+ ./calc-sobol > includes/qmc-sobol-params.h
+@endverbatim
+ */
+
+#include <cstdio>
+#include <cstdint>
+#include <vector>
+#include <random>
+#include <algorithm>
+
+static const int DIMENSIONS = 64;
+static const int BITS = 32;
+static const int MAX_M = 12;
+static const int CANDIDATES = 2048;
+
+struct dimension {
+    int degree;
+    uint32_t a;
+    std::vector<uint32_t> m;
+    uint32_t v[BITS];
+};
+
+// order of x modulo the polynomial of the given degree, 0 if x^k never is 1
+static bool is_primitive(uint32_t poly, int degree) {
+    uint32_t period = (1u << degree) - 1;
+    uint32_t x = 1;
+    for (uint32_t k = 1; k <= period; ++k) {
+        x <<= 1;
+        if (x & (1u << degree)) {
+            x ^= poly;
+        }
+        if (x == 1) {
+            return k == period;
+        }
+    }
+    return false;
+}
+
+static void direction_numbers(dimension& dim) {
+    int s = dim.degree;
+    for (int k = 0; k < BITS; ++k) {
+        if (k < s) {
+            dim.v[k] = dim.m[k] << (BITS - 1 - k);
+        } else {
+            dim.v[k] = dim.v[k - s] ^ (dim.v[k - s] >> s);
+            for (int j = 1; j < s; ++j) {
+                if ((dim.a >> (s - 1 - j)) & 1) {
+                    dim.v[k] ^= dim.v[k - j];
+                }
+            }
+        }
+    }
+}
+
+// rows[i] = digit i of the outputs as a function of the m lowest index bits
+static void rows(const dimension& dim, int m, uint32_t* out) {
+    for (int i = 0; i < m; ++i) {
+        out[i] = 0;
+        for (int k = 0; k < m; ++k) {
+            out[i] |= ((dim.v[k] >> (BITS - 1 - i)) & 1u) << k;
+        }
+    }
+}
+
+// t-value of the first 2^m points of the projection on two dimensions
+static int t_value(const dimension& x, const dimension& y, int m) {
+    uint32_t rx[BITS], ry[BITS];
+    rows(x, m, rx);
+    rows(y, m, ry);
+    int strength = m;
+    for (int d1 = 0; d1 <= m && d1 < strength; ++d1) {
+        // gaussian elimination of the first d1 rows of x, then rows of y
+        uint32_t basis[BITS];
+        int size = 0;
+        auto insert = [&](uint32_t r) {
+            for (int b = 0; b < size; ++b) {
+                r = std::min(r, r ^ basis[b]);
+            }
+            if (r == 0) {
+                return false;
+            }
+            basis[size++] = r;
+            std::sort(basis, basis + size, [](uint32_t p, uint32_t q) { return p > q; });
+            return true;
+        };
+        for (int i = 0; i < d1; ++i) {
+            insert(rx[i]);
+        }
+        int d2 = 0;
+        while (d1 + d2 < m && insert(ry[d2])) {
+            ++d2;
+        }
+        strength = std::min(strength, d1 + d2);
+    }
+    return m - strength;
+}
+
+int main() {
+    std::vector<dimension> dims;
+    dimension first{1, 0, {1}, {}};
+    for (int k = 0; k < BITS; ++k) {
+        first.v[k] = 1u << (BITS - 1 - k);
+    }
+    dims.push_back(first);
+
+    std::mt19937 rng(20240611);
+    int degree = 1;
+    uint32_t next_a = 0;
+    while ((int)dims.size() < DIMENSIONS) {
+        // next primitive polynomial x^s + a_1 x^(s-1) + ... + a_(s-1) x + 1
+        uint32_t poly = 0;
+        uint32_t a = 0;
+        for (;;) {
+            if (next_a >= (1u << (degree - 1))) {
+                ++degree;
+                next_a = 0;
+            }
+            a = next_a++;
+            poly = (1u << degree) | (a << 1) | 1u;
+            if (is_primitive(poly, degree)) {
+                break;
+            }
+        }
+
+        dimension best{degree, a, {}, {}};
+        int best_max = 1 << 30;
+        long best_sum = 1l << 40;
+        for (int c = 0; c < CANDIDATES; ++c) {
+            dimension dim{degree, a, std::vector<uint32_t>(degree), {}};
+            for (int k = 0; k < degree; ++k) {
+                dim.m[k] = (rng() % (1u << (k + 1))) | 1u; // odd and below 2^(k+1)
+            }
+            direction_numbers(dim);
+            int max_t = 0;
+            long sum_t = 0;
+            for (auto& other : dims) {
+                for (int m = 1; m <= MAX_M; ++m) {
+                    int t = t_value(other, dim, m);
+                    max_t = std::max(max_t, t);
+                    sum_t += t;
+                }
+            }
+            if (max_t < best_max || (max_t == best_max && sum_t < best_sum)) {
+                best = dim;
+                best_max = max_t;
+                best_sum = sum_t;
+            }
+        }
+        dims.push_back(best);
+        fprintf(stderr, "dimension %zu: degree %d, max t %d, sum t %ld\n", dims.size(), degree, best_max, best_sum);
+    }
+
+    int max_degree = 0;
+    for (auto& dim : dims) {
+        max_degree = std::max(max_degree, dim.degree);
+    }
+
+    printf("#pragma once\n");
+    printf("#ifndef QMC_SOBOL_PARAMS_H\n");
+    printf("#define QMC_SOBOL_PARAMS_H\n\n");
+    printf("/* generated by calc-sobol, do not edit */\n\n");
+    printf("#define SOBOL_MAX_DIMENSION %d\n", DIMENSIONS);
+    printf("#define SOBOL_MAX_DEGREE %d\n\n", max_degree);
+    printf("/* degree s, coefficients a_1 ... a_(s-1) of the primitive polynomial\n");
+    printf("   (a_1 is the highest bit) and initial direction numbers m_1 ... m_s;\n");
+    printf("   dimension 1 is the van der Corput sequence */\n");
+    printf("static const unsigned sobol_degree[SOBOL_MAX_DIMENSION] = {");
+    for (size_t d = 0; d < dims.size(); ++d) {
+        printf("%s%d,", d % 16 == 0 ? "\n    " : " ", dims[d].degree);
+    }
+    printf("\n};\n\n");
+    printf("static const unsigned sobol_a[SOBOL_MAX_DIMENSION] = {");
+    for (size_t d = 0; d < dims.size(); ++d) {
+        printf("%s%u,", d % 16 == 0 ? "\n    " : " ", dims[d].a);
+    }
+    printf("\n};\n\n");
+    printf("static const unsigned sobol_m[SOBOL_MAX_DIMENSION][SOBOL_MAX_DEGREE] = {\n");
+    for (auto& dim : dims) {
+        printf("    {");
+        for (int k = 0; k < dim.degree; ++k) {
+            printf("%s%u", k ? ", " : "", dim.m[k]);
+        }
+        printf("},\n");
+    }
+    printf("};\n\n");
+    printf("#endif /* QMC_SOBOL_PARAMS_H */\n");
+    return 0;
+}
@@ -0,0 +1,113 @@
+/**
+ * @file qrng-server.cpp
+ *
+ * @brief local stand-in for a remote QRNG service, serves Philox numbers
+ * with the protocol of qrng_socket.hpp
+ *
+ * Each response waits the given latency and then as long as the given
+ * bandwidth takes to send it, so that the prefetching of randomgen_481
+ * can be measured on a machine with no network:
+ *
+ * @verbatim
+ make qrng-server
+ build/bin/release/qrng-server --port=5489 --latency=20 --rate=10 &
+ make CURRENT=randomgen_481 CXXFLAGS=-DUSE_QRNG
+ build/bin/release/randomgen_481 1000000 --qrng-server=localhost:5489
+@endverbatim
+ */
+
+#include <iostream>
+#include <string>
+#include <thread>
+#include <chrono>
+#include <vector>
+#include <atomic>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include "philox.hpp"
+#include "qrng_socket.hpp"
+
+namespace chrono = std::chrono;
+
+struct server_options {
+    uint16_t port = 5489;
+    chrono::microseconds latency{0};
+    double rate = 0.0; // MB/s, 0 is unlimited
+    uint64_t seed = 10000;
+};
+
+// one connection, one stream of the Philox numbers of the seed
+static void serve(int fd, uint64_t stream, const server_options& options) {
+    std::vector<double> values;
+    uint64_t block = 0;
+    uint32_t count;
+    while (qrng_socket_recv_all(fd, &count, sizeof(count))) {
+        // two per block, the second value of an odd count is dropped
+        count = std::min(count, QRNG_SOCKET_MAX_REQUEST);
+        uint32_t blocks = (count + 1) / 2;
+        values.resize(2 * blocks);
+        philox4x32_fill_res53(options.seed, stream, block, values.data(), blocks);
+        block += blocks;
+
+        auto delay = options.latency;
+        if (options.rate > 0) {
+            delay += chrono::microseconds(int64_t(count * sizeof(double) / options.rate));
+        }
+        std::this_thread::sleep_for(delay);
+
+        if (!qrng_socket_send_all(fd, &count, sizeof(count)) ||
+            !qrng_socket_send_all(fd, values.data(), count * sizeof(double))) {
+            break;
+        }
+    }
+    ::close(fd);
+}
+
+int main(int argc, char* argv[]) {
+    server_options options;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg{ argv[i] };
+        try {
+            if (arg.rfind("--port=", 0) == 0) {
+                options.port = uint16_t(std::stoul(arg.substr(7)));
+            } else if (arg.rfind("--latency=", 0) == 0) {
+                options.latency = chrono::microseconds(int64_t(std::stod(arg.substr(10)) * 1000));
+            } else if (arg.rfind("--rate=", 0) == 0) {
+                options.rate = std::stod(arg.substr(7));
+            } else if (arg.rfind("--seed=", 0) == 0) {
+                options.seed = std::stoull(arg.substr(7));
+            } else {
+                throw std::invalid_argument(arg);
+            }
+        } catch (std::invalid_argument& e) {
+            std::cerr << "Usage: " << argv[0] << " [--port=<port>] [--latency=<ms>] [--rate=<MB/s>] [--seed=<seed>]"
+                      << std::endl;
+            return 1;
+        }
+    }
+
+    int listener = ::socket(AF_INET, SOCK_STREAM, 0);
+    int one = 1;
+    ::setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    address.sin_port = htons(options.port);
+    if (listener < 0 ||
+        ::bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+        ::listen(listener, 16) != 0) {
+        std::cerr << "Cannot listen on port " << options.port << std::endl;
+        return 1;
+    }
+    std::cerr << "serving on port " << options.port << std::endl;
+
+    uint64_t stream = 0;
+    for (;;) {
+        int fd = ::accept(listener, nullptr, nullptr);
+        if (fd < 0) {
+            continue;
+        }
+        std::thread(serve, fd, stream++, options).detach();
+    }
+}
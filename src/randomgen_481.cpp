@@ -12,32 +12,71 @@
 #include <functional>
 #include <array>
 #include <shared_mutex>
+#include <memory>
+#include <cstdio>
+#include <cstdlib>
 #include "sfmt/SFMT.h"
-
+#include "sfmt/SFMT-jump.h"
+#include "random_table.hpp"
+#include "random_prefetch.hpp"
+#include "qrng_socket.hpp"
+#include "hypersphere.hpp"
+#include "monte_carlo.hpp"
+#include "perf_counters.hpp"
 
 #include <libQRNG.h>
 
 namespace chrono = std::chrono;
 
-typedef std::array<double, 6> M_Vector;
+// points per call to sfmt_fill_array_real1, 6 * block_points must be a multiple of 4
+static const size_t block_points = 1024;
 
-static const M_Vector hs_center{ {0.45, 0.5, 0.6, 0.6, 0.5, 0.45} };
-static const double hs_radius = 0.35;
-static const double hs_sqradius = hs_radius * hs_radius;
+// the mapped random table, each thread reads the slice of its samples
+static const random_table* qrng_table = nullptr;
+static auto table_overflow = random_table_slice::fail;
+static const uint64_t table_seed = 10000;
 
-static std::vector<double> qrng_state;
-//static std::atomic_size_t qrng_table_ptr{0};
-static size_t qrng_table_ptr = 0;
-static double qrng_rand_from_table() {
-    return qrng_state[qrng_table_ptr++];
+#ifdef USE_TABLE
+static bool table_reused() {
+    return table_overflow == random_table_slice::rotate || table_overflow == random_table_slice::xor_scramble;
 }
 
+// the passes over a reused table are independent replicates, their spread
+// is the error of λ and the effective sample size is the number of
+// independent points with the same variance
+static void print_pass_statistics(const std::vector<size_t>& pass_hits,
+    const size_t N,
+    const double lambda_hat) {
+    const size_t pass_samples = std::max<size_t>(qrng_table->size() / 6, 1);
+    const size_t full_passes = N / pass_samples;
+    std::cout << "passes:    " << std::fixed << std::setprecision(2) << double(N) / pass_samples
+              << " over " << pass_samples << " samples" << std::endl;
+    if (full_passes < 2) {
+        std::cout << "(no variance between passes, N is less than two passes)" << std::endl;
+        return;
+    }
 
-struct QRNG {
-    double nums[10000];
-    int max = 0;
-    int ptr = 0;
+    std::vector<double> lambdas(full_passes);
+    for (size_t p = 0; p < full_passes; ++p) {
+        lambdas[p] = double(pass_hits[p]) / pass_samples;
+    }
+    auto mean = std::accumulate(lambdas.begin(), lambdas.end(), 0.0) / full_passes;
+    auto variance = 0.0;
+    for (auto lambda : lambdas) {
+        variance += (lambda - mean) * (lambda - mean);
+    }
+    variance = variance / (full_passes - 1) / full_passes;
 
+    std::cout << "Var[λ(R)]: " << std::scientific << std::setprecision(5) << variance
+              << " (between " << full_passes << " passes)" << std::endl;
+    std::cout << "n_eff:     " << std::scientific << std::setprecision(5)
+              << (variance > 0 ? lambda_hat * (1 - lambda_hat) / variance : INFINITY) << std::endl;
+}
+#endif
+
+
+// libQRNG as the source of a random_prefetcher, one connection for the process
+struct QRNG {
     QRNG(const char *user, const char *password) {
         int res = qrng_connect(user, password);
         if (res != QRNG_SUCCESS) {
@@ -45,79 +84,138 @@ struct QRNG {
         }
     }
 
-    double operator()() {
-        while (ptr == max) {
-            int res = qrng_get_double_array(nums, sizeof(nums)/sizeof(nums[0]), &max);
-            if (res != QRNG_SUCCESS) {
-                throw std::runtime_error(qrng_error_strings[res]);
-            }
-            ptr = 0;
+    QRNG(const QRNG&) = delete;
+    QRNG& operator=(const QRNG&) = delete;
+
+    ~QRNG() {
+        qrng_disconnect();
+    }
+
+    size_t operator()(double* out, size_t count) {
+        int max = 0;
+        int res = qrng_get_double_array(out, int(count), &max);
+        if (res != QRNG_SUCCESS) {
+            throw std::runtime_error(qrng_error_strings[res]);
         }
-        return nums[ptr++];
+        return max;
     }
 };
 
-static __thread QRNG gen;
+#ifdef USE_QRNG
+// remote numbers, fetched by a background thread while the simulation runs
+static random_prefetcher* qrng_pool = nullptr;
+#endif
 
-static void run_simulation(const size_t N,
-    const size_t num_threads,
-    const bool extra_restrictions) {
-    typedef chrono::duration<long double, std::milli> float_milliseconds;
+struct hit_count {
+    size_t hits = 0;
+#ifdef USE_TABLE
+    std::vector<size_t> pass_hits; // by pass over the table
+#endif
 
-    std::vector<std::thread> threads;
-    std::vector<double> partial_results(num_threads);
+    void merge(const hit_count& other) {
+        hits += other.hits;
+#ifdef USE_TABLE
+        pass_hits.resize(std::max(pass_hits.size(), other.pass_hits.size()));
+        for (size_t p = 0; p < other.pass_hits.size(); ++p) {
+            pass_hits[p] += other.pass_hits[p];
+        }
+#endif
+    }
+};
 
-    chrono::steady_clock::time_point begin_tp = chrono::steady_clock::now();
+struct region_kernel {
+#if defined(USE_QRNG)
+    typedef std::unique_ptr<random_prefetcher::consumer> state_type;
+#elif defined(USE_TABLE)
+    struct state_type {};
+#else
+    struct state_type {
+        sfmt_t rnd_state;
+        // points are drawn in blocks, same numbers as sfmt_genrand_real1
+        std::vector<double> block;
+        size_t pos;
+    };
+#endif
 
-    for (size_t i = 0; i < num_threads; ++i) {
-        threads.emplace_back([&, i] {
-            sfmt_t rnd_state;
-            sfmt_init_gen_rand(&rnd_state, (i + 1) * 10000);
-            auto acc = 0lu;
-            for (auto beg = i * N / num_threads, end = (i + 1) * N / num_threads;
-                beg < end;
-                ++beg) {
-#ifdef USE_TABLE
-                M_Vector point{ {qrng_rand_from_table(),
-                                 qrng_rand_from_table(),
-                                 qrng_rand_from_table(),
-                                 qrng_rand_from_table(),
-                                 qrng_rand_from_table(),
-                                 qrng_rand_from_table()} };
+    bool extra_restrictions;
 
+    state_type make_state([[maybe_unused]] size_t worker) const {
+#if defined(USE_QRNG)
+        return state_type(new random_prefetcher::consumer(*qrng_pool));
+#elif defined(USE_TABLE)
+        return state_type{};
 #else
-                M_Vector point{ {sfmt_genrand_real1(&rnd_state),
-                                 sfmt_genrand_real1(&rnd_state),
-                                 sfmt_genrand_real1(&rnd_state),
-                                 sfmt_genrand_real1(&rnd_state),
-                                 sfmt_genrand_real1(&rnd_state),
-                                 sfmt_genrand_real1(&rnd_state)} };
+        state_type state{ {}, std::vector<double>(6 * block_points), 6 * block_points };
+        // one seed, a disjoint substream for each worker
+        sfmt_init_substream(&state.rnd_state, 10000, worker);
+        return state;
 #endif
-                M_Vector distance_vector{ {point[0] - hs_center[0],
-                                          point[1] - hs_center[1],
-                                          point[2] - hs_center[2],
-                                          point[3] - hs_center[3],
-                                          point[4] - hs_center[4],
-                                          point[5] - hs_center[5]} };
-                auto sq_distance = std::inner_product(distance_vector.begin(), distance_vector.end(), distance_vector.begin(), 0.0);
-
-                if (sq_distance <= hs_sqradius &&
-                    (!extra_restrictions || (3 * point[0] + 7 * point[3] <= 5 &&
-                        point[2] + point[3] <= 1 &&
-                        point[0] - point[1] - point[4] + point[5] >= 0))) {
-                    acc += 1;
-                }
+    }
+
+    void operator()([[maybe_unused]] state_type& state, size_t begin, size_t end, hit_count& acc) const {
+#if defined(USE_QRNG)
+        auto& qrng = *state;
+#elif defined(USE_TABLE)
+        // sample j is always the values 6j ... 6j+5 of the table
+        random_table_slice slice(*qrng_table, 6, begin, end, table_overflow, table_seed);
+        const size_t pass_samples = std::max<size_t>(qrng_table->size() / 6, 1);
+        acc.pass_hits.resize(std::max(acc.pass_hits.size(), (end + pass_samples - 1) / pass_samples));
+#else
+        auto& block = state.block;
+        auto& pos = state.pos;
+#endif
+        for (auto beg = begin; beg < end; ++beg) {
+#if defined(USE_QRNG)
+            M_Vector point{ {qrng(), qrng(), qrng(), qrng(), qrng(), qrng()} };
+
+#elif defined(USE_TABLE)
+            auto values = slice.next();
+            M_Vector point{ {values[0],
+                             values[1],
+                             values[2],
+                             values[3],
+                             values[4],
+                             values[5]} };
+
+#else
+            if (pos == block.size()) {
+                sfmt_fill_array_real1(&state.rnd_state, block.data(), block.size());
+                pos = 0;
             }
-            partial_results[i] = acc;
-        });
+            M_Vector point{ {block[pos],
+                             block[pos + 1],
+                             block[pos + 2],
+                             block[pos + 3],
+                             block[pos + 4],
+                             block[pos + 5]} };
+            pos += 6;
+#endif
+            if (in_region(point.data(), extra_restrictions)) {
+                acc.hits += 1;
+#ifdef USE_TABLE
+                acc.pass_hits[beg / pass_samples] += 1;
+#endif
+            }
+        }
     }
+};
+
+static void run_simulation(const size_t N,
+    const bool extra_restrictions,
+    const bool count_perf) {
+    typedef chrono::duration<long double, std::milli> float_milliseconds;
 
-    for (auto& t : threads) {
-        t.join();
+    monte_carlo_runner<region_kernel, hit_count> runner(region_kernel{extra_restrictions});
+    std::unique_ptr<perf_counters> counters;
+    if (count_perf) {
+        counters.reset(new perf_counters(runner.num_workers()));
+        runner.set_perf_counters(counters.get());
     }
 
-    auto lambda_hat = std::accumulate(partial_results.begin(), partial_results.end(), 0.0);
-    lambda_hat = lambda_hat / N;
+    chrono::steady_clock::time_point begin_tp = chrono::steady_clock::now();
+
+    auto result = runner.run(N);
+    auto lambda_hat = double(result.hits) / N;
 
     auto variance = lambda_hat * (1 - lambda_hat) / (N - 1);
 
@@ -128,13 +226,87 @@ static void run_simulation(const size_t N,
     std::cout << "Var[λ(R)]: " << std::scientific << std::setprecision(5) << variance << std::endl;
     std::cout << "stddev:    " << std::scientific << std::setprecision(5) << std::sqrt(variance) << std::endl;
     std::cout << "time:      " << std::fixed << std::setprecision(3) << duration.count() << " ms" << std::endl;
+    if (counters) {
+        counters->print(std::cout);
+    }
+#ifdef USE_TABLE
+    if (table_reused()) {
+        print_pass_statistics(result.pass_hits, N, lambda_hat);
+    }
+#endif
+}
+
+#ifdef USE_QRNG
+// fetches from --qrng-server=<host:port>, the stand-in of src/qrng/qrng-server.cpp,
+// or from libQRNG with the credentials of QRNG_USER and QRNG_PASSWORD
+static int run_qrng(const size_t N, int argc, char* argv[]) {
+    std::string server;
+    size_t low_watermark = 2;
+    size_t high_watermark = 8;
+    bool count_perf = false;
+    for (int i = 2; i < argc; ++i) {
+        std::string arg{ argv[i] };
+        char colon;
+        if (arg.rfind("--qrng-server=", 0) == 0) {
+            server = arg.substr(14);
+        } else if (arg == "--perf-counters") {
+            count_perf = true;
+        } else if (arg.rfind("--prefetch=", 0) == 0 &&
+                   std::sscanf(arg.c_str() + 11, "%zu%c%zu", &low_watermark, &colon, &high_watermark) == 3 &&
+                   colon == ':' && low_watermark < high_watermark) {
+        } else {
+            std::cerr << "Invalid argument: " << arg << std::endl;
+            return 1;
+        }
+    }
+
+    try {
+        random_prefetcher::fetch_function fetch;
+        if (!server.empty()) {
+            auto colon = server.rfind(':');
+            auto host = server.substr(0, colon);
+            auto port = colon == std::string::npos ? 5489 : std::stoi(server.substr(colon + 1));
+            auto source = std::make_shared<qrng_socket_source>(host, port);
+            fetch = [source](double* out, size_t count) { return (*source)(out, count); };
+        } else {
+            const char* user = std::getenv("QRNG_USER");
+            const char* password = std::getenv("QRNG_PASSWORD");
+            if (!user || !password) {
+                std::cerr << "Set QRNG_USER and QRNG_PASSWORD, or use --qrng-server" << std::endl;
+                return 1;
+            }
+            auto source = std::make_shared<QRNG>(user, password);
+            fetch = [source](double* out, size_t count) { return (*source)(out, count); };
+        }
+
+        random_prefetcher pool(fetch, 10000, low_watermark, high_watermark);
+        qrng_pool = &pool;
+        run_simulation(N, true, count_perf);
+        qrng_pool = nullptr;
+
+        std::cout << "qrng:      " << pool.fetch_count() << " buffers, " << pool.stall_count() << " stalls, "
+                  << std::fixed << std::setprecision(3) << pool.stall_time().count() / 1e6 << " ms stalled" << std::endl;
+    } catch (std::runtime_error& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
 }
+#endif
 
 int main(int argc, char* argv[]) {
+#ifdef USE_QRNG
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <N> [--qrng-server=<host:port>] [--prefetch=<low>:<high>] [--perf-counters]" << std::endl;
+        return 1;
+    }
+#else
     if (argc < 3) {
-        std::cerr << "Usage: " << argv[0] << " <N> <random_numbers_file>" << std::endl;
+        std::cerr << "Usage: " << argv[0] << " <N> <random_table_file>"
+                  << " [--table-fallback | --table-reuse=<rotate|xor>] [--perf-counters]" << std::endl;
         return 1;
     }
+#endif
 
     size_t N;
     try {
@@ -145,24 +317,57 @@ int main(int argc, char* argv[]) {
         return 1;
     }
 
-    std::ifstream rnd_file(argv[2]);
-    if (!rnd_file.is_open()) {
-        std::cerr << "Could not open file: " << argv[2] << std::endl;
+#ifdef USE_QRNG
+    return run_qrng(N, argc, argv);
+#endif
+    // text files of numbers are converted with `make rnd-table`
+    std::unique_ptr<random_table> table;
+    try {
+        table.reset(new random_table(argv[2]));
+    } catch (std::runtime_error& e) {
+        std::cerr << e.what() << std::endl;
         return 1;
     }
+    if (table->size() < 6) {
+        std::cerr << argv[2] << " has fewer than the 6 values of a sample" << std::endl;
+        return 1;
+    }
+    qrng_table = table.get();
 
-    qrng_state.reserve(10000000);
-
-    while (rnd_file.good()) {
-        double rnd;
-        rnd_file >> rnd;
-        qrng_state.push_back(rnd);
+    bool count_perf = false;
+    for (int i = 3; i < argc; ++i) {
+        std::string arg{ argv[i] };
+        if (arg == "--perf-counters") {
+            count_perf = true;
+        } else if (arg == "--table-fallback") {
+            // the samples past the end of the table use Philox
+            table_overflow = random_table_slice::philox_fallback;
+        } else if (arg == "--table-reuse=rotate") {
+            // passes over the table with random shifts modulo 1
+            table_overflow = random_table_slice::rotate;
+        } else if (arg == "--table-reuse=xor") {
+            // passes over the table with random digital xors
+            table_overflow = random_table_slice::xor_scramble;
+        } else {
+            std::cerr << "Invalid argument: " << arg << std::endl;
+            return 1;
+        }
     }
 
-    auto hw = std::thread::hardware_concurrency();
 #ifdef USE_TABLE
-    hw = 1;
+    auto fallback = random_table_slice::fallback_samples(table->size(), 6, 0, N);
+    if (fallback && table_overflow == random_table_slice::fail) {
+        std::cerr << "The table has " << table->size() / 6 << " samples, use --table-fallback to draw "
+                  << fallback << " more from Philox or --table-reuse to reuse it" << std::endl;
+        return 1;
+    }
+    if (fallback && table_overflow == random_table_slice::philox_fallback) {
+        std::cout << "fallback:  " << fallback << " samples from Philox" << std::endl;
+    }
 #endif
-    run_simulation(N, hw, true);
+
+    // starts the threads before the measurements
+    work_stealing_pool::shared();
+    run_simulation(N, true, count_perf);
     return 0;
 }
@@ -0,0 +1,392 @@
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <random>
+#include <numeric>
+#include <cstring>
+#include <cstdlib>
+#include "sfmt/SFMT.h"
+#include "sfmt_buffered_engine.hpp"
+#include "sfmt_engine.hpp"
+#include "philox.hpp"
+#include "ziggurat.hpp"
+#include "mt19937.h" // modified to be thread safe
+
+namespace chrono = std::chrono;
+
+// throughput of every random number generator in the tree, scalar calls
+// against bulk fills, from 1 thread up to the hardware concurrency, as JSON:
+// make bench-rng, or rng_bench [--duration=<ms>] [--threads=<max>]
+// [--filter=<substring>] [--output=<file>]
+
+#if defined(HAVE_AVX512)
+static const char* sfmt_backend = "avx512";
+#elif defined(HAVE_AVX2)
+static const char* sfmt_backend = "avx2";
+#elif defined(HAVE_SSE2)
+static const char* sfmt_backend = "sse2";
+#elif defined(HAVE_NEON)
+static const char* sfmt_backend = "neon";
+#elif defined(HAVE_ALTIVEC)
+static const char* sfmt_backend = "altivec";
+#else
+static const char* sfmt_backend = "c";
+#endif
+
+// values per batch, a batch is the unit of work between clock reads
+static const size_t batch_size = 4096;
+
+// the values of every thread end here, so that they are not optimized away
+static std::atomic<uint64_t> result_sink(0);
+
+// generates one batch and returns the number of values, sink keeps the
+// values from being optimized away
+typedef std::function<size_t(uint64_t& sink)> batch_function;
+
+struct bench_case {
+    std::string generator;
+    std::string path;   // scalar or bulk
+    std::string output; // uint32, uint64 or double
+    size_t value_size;
+    // builds the state of a thread and its batch function
+    std::function<batch_function(uint32_t seed)> make;
+};
+
+struct measurement {
+    size_t threads;
+    size_t values;
+    double seconds;
+};
+
+template <class T>
+static uint64_t bits_of(T value) {
+    uint64_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(T));
+    return bits;
+}
+
+// make builds the state of a thread and returns a callable giving one value,
+// only the batch goes through std::function so that calls inline
+template <class T, class Make>
+static bench_case scalar_case(const std::string& generator, const std::string& output, Make make) {
+    return bench_case{generator, "scalar", output, sizeof(T), [make](uint32_t seed) -> batch_function {
+        auto next = std::make_shared<decltype(make(seed))>(make(seed));
+        return [next](uint64_t& sink) {
+            auto& next_value = *next;
+            uint64_t acc = 0; // local, sink could alias the state
+            for (size_t j = 0; j < batch_size; ++j) {
+                acc ^= bits_of<T>(next_value());
+            }
+            sink ^= acc;
+            return batch_size;
+        };
+    }};
+}
+
+// make returns a callable filling an array of values
+template <class T, class Make>
+static bench_case bulk_case(const std::string& generator, const std::string& output, Make make) {
+    return bench_case{generator, "bulk", output, sizeof(T), [make](uint32_t seed) -> batch_function {
+        auto fill = std::make_shared<decltype(make(seed))>(make(seed));
+        auto block = std::make_shared<std::vector<T>>(batch_size); // 16-byte aligned, as SFMT requires
+        return [fill, block](uint64_t& sink) {
+            (*fill)(block->data(), block->size());
+            sink ^= bits_of<T>((*block)[batch_size - 1]);
+            return batch_size;
+        };
+    }};
+}
+
+static std::vector<bench_case> all_cases() {
+    std::vector<bench_case> cases;
+
+    // SFMT, C library
+    auto sfmt = [](uint32_t seed) {
+        auto state = std::make_shared<sfmt_t>();
+        sfmt_init_gen_rand(state.get(), seed);
+        return state;
+    };
+    cases.push_back(scalar_case<uint32_t>("sfmt_genrand_uint32", "uint32", [=](uint32_t seed) {
+        auto state = sfmt(seed);
+        return [state] { return sfmt_genrand_uint32(state.get()); };
+    }));
+    cases.push_back(scalar_case<uint64_t>("sfmt_genrand_uint64", "uint64", [=](uint32_t seed) {
+        auto state = sfmt(seed);
+        return [state] { return sfmt_genrand_uint64(state.get()); };
+    }));
+    cases.push_back(scalar_case<double>("sfmt_genrand_real1", "double", [=](uint32_t seed) {
+        auto state = sfmt(seed);
+        return [state] { return sfmt_genrand_real1(state.get()); };
+    }));
+    cases.push_back(scalar_case<double>("sfmt_genrand_res53", "double", [=](uint32_t seed) {
+        auto state = sfmt(seed);
+        return [state] { return sfmt_genrand_res53(state.get()); };
+    }));
+    cases.push_back(bulk_case<uint32_t>("sfmt_fill_array32", "uint32", [=](uint32_t seed) {
+        auto state = sfmt(seed);
+        return [state](uint32_t* out, size_t n) { sfmt_fill_array32(state.get(), out, int(n)); };
+    }));
+    cases.push_back(bulk_case<uint64_t>("sfmt_fill_array64", "uint64", [=](uint32_t seed) {
+        auto state = sfmt(seed);
+        return [state](uint64_t* out, size_t n) { sfmt_fill_array64(state.get(), out, int(n)); };
+    }));
+    cases.push_back(bulk_case<double>("sfmt_fill_array_real1", "double", [=](uint32_t seed) {
+        auto state = sfmt(seed);
+        return [state](double* out, size_t n) { sfmt_fill_array_real1(state.get(), out, int(n)); };
+    }));
+    cases.push_back(bulk_case<double>("sfmt_fill_array_res53", "double", [=](uint32_t seed) {
+        auto state = sfmt(seed);
+        return [state](double* out, size_t n) { sfmt_fill_array_res53(state.get(), out, int(n)); };
+    }));
+
+    // C++ engines over SFMT
+    cases.push_back(scalar_case<uint64_t>("sfmt_buffered_engine", "uint64", [](uint32_t seed) {
+        auto engine = std::make_shared<sfmt_buffered_engine>(seed);
+        return [engine] { return (*engine)(); };
+    }));
+    cases.push_back(scalar_case<double>("sfmt_buffered_engine::canonical", "double", [](uint32_t seed) {
+        auto engine = std::make_shared<sfmt_buffered_engine>(seed);
+        return [engine] { return engine->canonical(); };
+    }));
+    cases.push_back(bulk_case<uint64_t>("sfmt_buffered_engine::fill", "uint64", [](uint32_t seed) {
+        auto engine = std::make_shared<sfmt_buffered_engine>(seed);
+        return [engine](uint64_t* out, size_t n) { engine->fill(out, n); };
+    }));
+    cases.push_back(scalar_case<uint64_t>("sfmt_engine<607>", "uint64", [](uint32_t seed) {
+        auto engine = std::make_shared<sfmt_engine<607>>(seed);
+        return [engine] { return (*engine)(); };
+    }));
+    cases.push_back(scalar_case<uint64_t>("sfmt_engine<19937>", "uint64", [](uint32_t seed) {
+        auto engine = std::make_shared<sfmt_engine<19937>>(seed);
+        return [engine] { return (*engine)(); };
+    }));
+    cases.push_back(bulk_case<uint64_t>("sfmt_engine<19937>::fill", "uint64", [](uint32_t seed) {
+        auto engine = std::make_shared<sfmt_engine<19937>>(seed);
+        return [engine](uint64_t* out, size_t n) { engine->fill(out, n); };
+    }));
+    cases.push_back(scalar_case<uint64_t>("sfmt_engine<216091>", "uint64", [](uint32_t seed) {
+        auto engine = std::make_shared<sfmt_engine<216091>>(seed);
+        return [engine] { return (*engine)(); };
+    }));
+
+    // Philox, stateless: the seed is the key, the counter advances per batch
+    cases.push_back(bulk_case<uint32_t>("philox4x32_fill", "uint32", [](uint32_t seed) {
+        auto block = std::make_shared<uint64_t>(0);
+        return [seed, block](uint32_t* out, size_t n) {
+            philox4x32_fill(seed, 0, *block, out, n / 4);
+            *block += n / 4;
+        };
+    }));
+    cases.push_back(bulk_case<double>("philox4x32_fill_real1", "double", [](uint32_t seed) {
+        auto block = std::make_shared<uint64_t>(0);
+        return [seed, block](double* out, size_t n) {
+            philox4x32_fill_real1(seed, 0, *block, out, n / 4);
+            *block += n / 4;
+        };
+    }));
+    cases.push_back(scalar_case<uint32_t>("philox4x32_10", "uint32", [](uint32_t seed) {
+        // one block for every four values
+        struct philox_state {
+            philox4x32_key key;
+            uint64_t block;
+            philox4x32_ctr values;
+            unsigned pos;
+        };
+        auto state = std::make_shared<philox_state>(philox_state{philox4x32_make_key(seed), 0, {}, 4});
+        return [state] {
+            if (state->pos == 4) {
+                state->values = philox4x32_10(philox4x32_make_ctr(0, state->block++), state->key);
+                state->pos = 0;
+            }
+            return state->values[state->pos++];
+        };
+    }));
+
+    // normal numbers
+    cases.push_back(bulk_case<double>("ziggurat_normal::fill", "double", [](uint32_t seed) {
+        auto engine = std::make_shared<sfmt_buffered_engine>(seed);
+        auto normal = std::make_shared<ziggurat_normal>(*engine);
+        return [engine, normal](double* out, size_t n) { normal->fill(out, n); };
+    }));
+
+    // mt19937.h, thread local state
+    cases.push_back(scalar_case<double>("mt19937.h genrand", "double", [](uint32_t seed) {
+        sgenrand(seed);
+        return [] { return genrand(); };
+    }));
+
+    // standard library
+    cases.push_back(scalar_case<uint32_t>("std::mt19937", "uint32", [](uint32_t seed) {
+        auto engine = std::make_shared<std::mt19937>(seed);
+        return [engine] { return uint32_t((*engine)()); };
+    }));
+    cases.push_back(scalar_case<uint64_t>("std::mt19937_64", "uint64", [](uint32_t seed) {
+        auto engine = std::make_shared<std::mt19937_64>(seed);
+        return [engine] { return uint64_t((*engine)()); };
+    }));
+    cases.push_back(scalar_case<double>("std::mt19937 uniform_real_distribution", "double", [](uint32_t seed) {
+        auto engine = std::make_shared<std::mt19937>(seed);
+        auto dist = std::make_shared<std::uniform_real_distribution<double>>(0.0, 1.0);
+        return [engine, dist] { return (*dist)(*engine); };
+    }));
+    // as the old rand_test, glibc rand() locks a shared state
+    cases.push_back(scalar_case<uint32_t>("rand", "uint32", [](uint32_t seed) {
+        srand(seed);
+        return [] { return uint32_t(rand()); };
+    }));
+
+    return cases;
+}
+
+// runs a case on num_threads threads at the same time for duration
+static measurement run_case(const bench_case& bc, size_t num_threads, chrono::milliseconds duration) {
+    typedef chrono::duration<double> float_seconds;
+
+    std::vector<std::thread> threads;
+    std::vector<size_t> values(num_threads);
+    std::vector<double> seconds(num_threads);
+    std::atomic<size_t> ready(0);
+
+    for (size_t i = 0; i < num_threads; ++i) {
+        threads.emplace_back([&, i] {
+            auto batch = bc.make((i+1)*10000);
+            uint64_t sink = 0;
+            batch(sink); // warm up
+
+            ready++;
+            while (ready < num_threads) {
+                std::this_thread::yield();
+            }
+
+            size_t count = 0;
+            auto begin_tp = chrono::steady_clock::now();
+            auto elapsed = float_seconds::zero();
+            do {
+                count += batch(sink);
+                elapsed = chrono::steady_clock::now() - begin_tp;
+            } while (elapsed < duration);
+
+            values[i] = count;
+            seconds[i] = elapsed.count();
+            result_sink ^= sink;
+        });
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    return measurement{num_threads,
+                       std::accumulate(values.begin(), values.end(), size_t(0)),
+                       *std::max_element(seconds.begin(), seconds.end())};
+}
+
+static std::string json_string(const std::string& s) {
+    std::string out = "\"";
+    for (char c : s) {
+        if (c == '"' || c == '\\') {
+            out += '\\';
+        }
+        out += c;
+    }
+    return out + "\"";
+}
+
+int main(int argc, char* argv[]) {
+    auto duration = chrono::milliseconds(200);
+    size_t max_threads = std::max(1u, std::thread::hardware_concurrency());
+    std::string filter;
+    std::string output_file;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg{ argv[i] };
+        try {
+            if (arg.rfind("--duration=", 0) == 0) {
+                duration = chrono::milliseconds(std::stoll(arg.substr(11)));
+            } else if (arg.rfind("--threads=", 0) == 0) {
+                auto value = std::stoll(arg.substr(10));
+                if (value < 1) {
+                    throw std::invalid_argument(arg);
+                }
+                max_threads = value;
+            } else if (arg.rfind("--filter=", 0) == 0) {
+                filter = arg.substr(9);
+            } else if (arg.rfind("--output=", 0) == 0) {
+                output_file = arg.substr(9);
+            } else {
+                throw std::invalid_argument(arg);
+            }
+        } catch (std::invalid_argument& e) {
+            std::cerr << "Usage: " << argv[0] << " [--duration=<ms>] [--threads=<max>]"
+                      << " [--filter=<substring>] [--output=<file>]" << std::endl;
+            return 1;
+        }
+    }
+
+    std::vector<size_t> thread_counts;
+    for (size_t n = 1; n < max_threads; n *= 2) {
+        thread_counts.push_back(n);
+    }
+    thread_counts.push_back(max_threads);
+
+    std::ofstream file;
+    if (!output_file.empty()) {
+        file.open(output_file);
+        if (!file) {
+            std::cerr << "Cannot write " << output_file << std::endl;
+            return 1;
+        }
+    }
+    std::ostream& out = output_file.empty() ? std::cout : file;
+
+    sfmt_t rnd_state;
+    sfmt_init_gen_rand(&rnd_state, 1234);
+
+    out << "{" << std::endl;
+    out << "  \"hardware_concurrency\": " << std::thread::hardware_concurrency() << "," << std::endl;
+    out << "  \"sfmt_backend\": " << json_string(sfmt_backend) << "," << std::endl;
+    out << "  \"sfmt_id\": " << json_string(sfmt_get_idstring(&rnd_state)) << "," << std::endl;
+    out << "  \"duration_ms\": " << duration.count() << "," << std::endl;
+    out << "  \"results\": [";
+
+    bool first = true;
+    for (auto& bc : all_cases()) {
+        if (bc.generator.find(filter) == std::string::npos) {
+            continue;
+        }
+        double single_thread = 0.0;
+        for (auto num_threads : thread_counts) {
+            auto m = run_case(bc, num_threads, duration);
+            double values_per_second = m.values / m.seconds;
+            if (num_threads == 1) {
+                single_thread = values_per_second;
+            }
+            // time per value of one thread
+            double ns_per_value = 1e9 * m.seconds * num_threads / m.values;
+            double efficiency = values_per_second / (single_thread * num_threads);
+
+            out << (first ? "" : ",") << std::endl;
+            out << "    {\"generator\": " << json_string(bc.generator)
+                << ", \"path\": " << json_string(bc.path)
+                << ", \"output\": " << json_string(bc.output)
+                << ", \"threads\": " << num_threads
+                << std::fixed << std::setprecision(4)
+                << ", \"ns_per_value\": " << ns_per_value
+                << ", \"gb_per_s\": " << values_per_second * bc.value_size / 1e9
+                << ", \"scaling_efficiency\": " << efficiency << "}";
+            first = false;
+            std::cerr << bc.generator << " (" << num_threads << " threads): "
+                      << std::setprecision(3) << ns_per_value << " ns/value" << std::endl;
+        }
+    }
+    out << std::endl << "  ]" << std::endl << "}" << std::endl;
+    return 0;
+}
@@ -0,0 +1,446 @@
+/**
+ * @file SFMT-jump.c
+ *
+ * @brief do jump using jump polynomial.
+ *
+ * Copyright (C) 2012 Mutsuo Saito, Makoto Matsumoto, Hiroshima
+ * University and The University of Tokyo.
+ * All rights reserved.
+ *
+ * The 3-clause BSD License is applied to this software, see
+ * LICENSE.txt
+ */
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include <ctype.h>
+#include <assert.h>
+#include "sfmt/SFMT.h"
+#include "sfmt/SFMT-params.h"
+#include "sfmt/SFMT-common.h"
+#include "sfmt/SFMT-jump.h"
+
+/* calc-jump is built with SFMT_JUMP_NO_PARAMS to bootstrap the tables */
+#if !defined(SFMT_JUMP_NO_PARAMS)
+  #if SFMT_MEXP == 19937
+    #include "sfmt/SFMT-jump-params19937.h"
+  #else
+    #error "No precomputed jump polynomials for this SFMT_MEXP, generate them with calc-jump."
+  #endif
+#endif
+
+/** number of 64-bit words of a polynomial of degree up to 128 * SFMT_N */
+#define POLY_WORDS (SFMT_N * 2 + 1)
+
+/** jumps shorter than this are done by generating the numbers */
+#define DIRECT_STEPS_LIMIT ((uint64_t)SFMT_MEXP * SFMT_N / 2)
+
+/*----------------
+  STATIC FUNCTIONS
+  ----------------*/
+inline static void next_state(sfmt_t * sfmt);
+inline static void add(sfmt_t * dest, const sfmt_t * src);
+static void rotate(sfmt_t * sfmt, int start);
+static void step_directly(sfmt_t * sfmt, uint64_t steps);
+static int poly_from_hex(uint64_t * poly, const char * hex);
+static void poly_to_hex(char * hex, const uint64_t * poly, int length);
+static void poly_xor_shifted(uint64_t * dest, const uint64_t * src,
+                             int words, int shift);
+static void poly_reduce(uint64_t * poly, int degree,
+                        const uint64_t * mod, int mod_degree);
+static void poly_sqrmod(uint64_t * poly, const uint64_t * mod, int mod_degree);
+static void poly_mulxmod(uint64_t * poly, const uint64_t * mod, int mod_degree);
+inline static uint64_t spread32(uint32_t x);
+
+/**
+ * Generates one 128-bit word, treating the state array as a ring
+ * buffer whose oldest word is at (idx / 4) % SFMT_N.
+ * @param sfmt SFMT internal state
+ */
+inline static void next_state(sfmt_t * sfmt) {
+    int idx = (sfmt->idx / 4) % SFMT_N;
+    w128_t * pstate = sfmt->state;
+
+    do_recursion(&pstate[idx],
+                 &pstate[idx],
+                 &pstate[(idx + SFMT_POS1) % SFMT_N],
+                 &pstate[(idx + SFMT_N - 2) % SFMT_N],
+                 &pstate[(idx + SFMT_N - 1) % SFMT_N]);
+    sfmt->idx = sfmt->idx + 4;
+}
+
+/**
+ * Adds (xor) the ring buffer of src to the state array of dest, aligning
+ * the oldest word of src with the first word of dest.
+ * @param dest destination state, must have idx 0
+ * @param src source state
+ */
+inline static void add(sfmt_t * dest, const sfmt_t * src) {
+    int sp = (src->idx / 4) % SFMT_N;
+    int i;
+
+    for (i = 0; i < SFMT_N - sp; i++) {
+        dest->state[i].u64[0] ^= src->state[i + sp].u64[0];
+        dest->state[i].u64[1] ^= src->state[i + sp].u64[1];
+    }
+    for (; i < SFMT_N; i++) {
+        dest->state[i].u64[0] ^= src->state[i + sp - SFMT_N].u64[0];
+        dest->state[i].u64[1] ^= src->state[i + sp - SFMT_N].u64[1];
+    }
+}
+
+/**
+ * Rotates the state array so that the word at start becomes the first.
+ * @param sfmt SFMT internal state
+ * @param start index of the oldest word
+ */
+static void rotate(sfmt_t * sfmt, int start) {
+    w128_t work[SFMT_N];
+
+    if (start == 0) {
+        return;
+    }
+    memcpy(work, sfmt->state + start, sizeof(w128_t) * (SFMT_N - start));
+    memcpy(work + SFMT_N - start, sfmt->state, sizeof(w128_t) * start);
+    memcpy(sfmt->state, work, sizeof(work));
+}
+
+/**
+ * Advances the state by generating (and discarding) the words.
+ * @param sfmt SFMT internal state
+ * @param steps number of 128-bit words to skip
+ */
+static void step_directly(sfmt_t * sfmt, uint64_t steps) {
+    int index = sfmt->idx;
+
+    for (; steps >= SFMT_N; steps -= SFMT_N) {
+        sfmt_gen_rand_all(sfmt);
+    }
+    sfmt->idx = SFMT_N32;
+    for (; steps > 0; steps--) {
+        next_state(sfmt);
+    }
+    rotate(sfmt, (sfmt->idx / 4) % SFMT_N);
+    sfmt->idx = index;
+}
+
+/**
+ * Parses a jump string.
+ * @param poly output polynomial, POLY_WORDS words
+ * @param hex hexadecimal string, lowest degree coefficient first
+ * @return number of coefficients read, or -1 if the string is invalid
+ */
+static int poly_from_hex(uint64_t * poly, const char * hex) {
+    int i;
+    int bits;
+
+    memset(poly, 0, sizeof(uint64_t) * POLY_WORDS);
+    for (i = 0; hex[i] != '\0'; i++) {
+        if (i >= POLY_WORDS * 16 || !isxdigit((unsigned char)hex[i])) {
+            return -1;
+        }
+        bits = tolower((unsigned char)hex[i]);
+        if (bits >= 'a' && bits <= 'f') {
+            bits = bits - 'a' + 10;
+        } else {
+            bits = bits - '0';
+        }
+        poly[i / 16] |= (uint64_t)bits << (4 * (i % 16));
+    }
+    return i * 4;
+}
+
+/**
+ * Formats a polynomial as a jump string.
+ * @param hex output string, at least length / 4 + 2 characters
+ * @param poly the polynomial
+ * @param length number of coefficients to write
+ */
+static void poly_to_hex(char * hex, const uint64_t * poly, int length) {
+    static const char digits[] = "0123456789abcdef";
+    int i;
+
+    for (i = 0; i < (length + 3) / 4; i++) {
+        hex[i] = digits[(poly[i / 16] >> (4 * (i % 16))) & 0x0f];
+    }
+    hex[i] = '\0';
+}
+
+/**
+ * dest ^= src * x^shift
+ */
+static void poly_xor_shifted(uint64_t * dest, const uint64_t * src,
+                             int words, int shift) {
+    int ws = shift / 64;
+    int bs = shift % 64;
+    int i;
+
+    if (bs == 0) {
+        for (i = 0; i < words; i++) {
+            dest[i + ws] ^= src[i];
+        }
+        return;
+    }
+    for (i = 0; i < words; i++) {
+        dest[i + ws] ^= src[i] << bs;
+        dest[i + ws + 1] ^= src[i] >> (64 - bs);
+    }
+}
+
+/**
+ * poly = poly mod mod, poly having 2 * POLY_WORDS words.
+ */
+static void poly_reduce(uint64_t * poly, int degree,
+                        const uint64_t * mod, int mod_degree) {
+    int words = mod_degree / 64 + 1;
+    int i;
+
+    for (i = degree; i >= mod_degree; i--) {
+        if ((poly[i / 64] >> (i % 64)) & 1) {
+            poly_xor_shifted(poly, mod, words, i - mod_degree);
+        }
+    }
+}
+
+/**
+ * interleaves the bits of x with zeros, squaring it as a polynomial.
+ */
+inline static uint64_t spread32(uint32_t x) {
+    uint64_t r = x;
+
+    r = (r | (r << 16)) & 0x0000ffff0000ffffULL;
+    r = (r | (r << 8)) & 0x00ff00ff00ff00ffULL;
+    r = (r | (r << 4)) & 0x0f0f0f0f0f0f0f0fULL;
+    r = (r | (r << 2)) & 0x3333333333333333ULL;
+    r = (r | (r << 1)) & 0x5555555555555555ULL;
+    return r;
+}
+
+/**
+ * poly = poly^2 mod mod
+ */
+static void poly_sqrmod(uint64_t * poly, const uint64_t * mod, int mod_degree) {
+    uint64_t work[POLY_WORDS * 2];
+    int i;
+
+    for (i = 0; i < POLY_WORDS; i++) {
+        work[2 * i] = spread32((uint32_t)poly[i]);
+        work[2 * i + 1] = spread32((uint32_t)(poly[i] >> 32));
+    }
+    poly_reduce(work, 2 * mod_degree - 2, mod, mod_degree);
+    memcpy(poly, work, sizeof(uint64_t) * POLY_WORDS);
+}
+
+/**
+ * poly = poly * x mod mod
+ */
+static void poly_mulxmod(uint64_t * poly, const uint64_t * mod, int mod_degree) {
+    int i;
+
+    for (i = POLY_WORDS - 1; i > 0; i--) {
+        poly[i] = (poly[i] << 1) | (poly[i - 1] >> 63);
+    }
+    poly[0] <<= 1;
+    if ((poly[mod_degree / 64] >> (mod_degree % 64)) & 1) {
+        poly_xor_shifted(poly, mod, mod_degree / 64 + 1, 0);
+    }
+}
+
+/*----------------
+  PUBLIC FUNCTIONS
+  ----------------*/
+/**
+ * This function returns the minimal polynomial of the state transition
+ * of the configured SFMT_MEXP as a hexadecimal string, lowest degree
+ * coefficient first.
+ * @return the minimal polynomial, or NULL if it is not available
+ */
+const char * sfmt_get_minpoly_string(void) {
+#if defined(SFMT_JUMP_NO_PARAMS)
+    return NULL;
+#else
+    return sfmt_jump_minpoly;
+#endif
+}
+
+/**
+ * This function computes the jump polynomial x^(steps * 2^k) mod
+ * minpoly, that is, the polynomial that advances a state by steps * 2^k
+ * 128-bit words.
+ *
+ * @param jump_string output buffer, SFMT_JUMP_STRING_SIZE bytes is always
+ * enough
+ * @param size size of the output buffer
+ * @param minpoly minimal polynomial as returned by
+ * sfmt_get_minpoly_string(), NULL selects the built-in one
+ * @param steps number of steps, before scaling
+ * @param k the number of steps is multiplied by 2^k
+ * @return 0 on success, -1 on invalid arguments or a short buffer
+ */
+int sfmt_calc_jump_string(char * jump_string, int size, const char * minpoly,
+                          uint64_t steps, int k) {
+    uint64_t mod[POLY_WORDS];
+    uint64_t poly[POLY_WORDS];
+    int mod_degree;
+    int i;
+
+    if (minpoly == NULL) {
+        minpoly = sfmt_get_minpoly_string();
+    }
+    if (minpoly == NULL || poly_from_hex(mod, minpoly) < 0 || k < 0) {
+        return -1;
+    }
+    for (mod_degree = POLY_WORDS * 64 - 1; mod_degree > 0; mod_degree--) {
+        if ((mod[mod_degree / 64] >> (mod_degree % 64)) & 1) {
+            break;
+        }
+    }
+    if (mod_degree == 0 || size < mod_degree / 4 + 2) {
+        return -1;
+    }
+
+    /* square and multiply, from the most significant bit of steps */
+    memset(poly, 0, sizeof(poly));
+    poly[0] = 1;
+    for (i = 63; i >= 0; i--) {
+        poly_sqrmod(poly, mod, mod_degree);
+        if ((steps >> i) & 1) {
+            poly_mulxmod(poly, mod, mod_degree);
+        }
+    }
+    for (i = 0; i < k; i++) {
+        poly_sqrmod(poly, mod, mod_degree);
+    }
+    poly_to_hex(jump_string, poly, mod_degree);
+    return 0;
+}
+
+/**
+ * This function jumps the state by the polynomial given as a
+ * hexadecimal string. The index of the next output is preserved, so
+ * outputs still buffered in the state array are skipped too.
+ *
+ * @param sfmt SFMT internal state
+ * @param jump_string jump polynomial, see sfmt_calc_jump_string()
+ */
+void sfmt_jump(sfmt_t * sfmt, const char * jump_string) {
+    sfmt_t work;
+    int index = sfmt->idx;
+    int bits;
+    int i, j;
+
+    memset(&work, 0, sizeof(sfmt_t));
+    sfmt->idx = SFMT_N32;
+
+    for (i = 0; jump_string[i] != '\0'; i++) {
+        bits = tolower((unsigned char)jump_string[i]);
+        assert(isxdigit(bits));
+        if (bits >= 'a' && bits <= 'f') {
+            bits = bits - 'a' + 10;
+        } else {
+            bits = bits - '0';
+        }
+        for (j = 0; j < 4; j++) {
+            if ((bits & 1) != 0) {
+                add(&work, sfmt);
+            }
+            next_state(sfmt);
+            bits = bits >> 1;
+        }
+    }
+    *sfmt = work;
+    sfmt->idx = index;
+}
+
+/**
+ * This function jumps the state by 2^k steps. Precomputed polynomials
+ * are used for SFMT_JUMP_POW2_MIN <= k <= SFMT_JUMP_POW2_MAX; any other
+ * k is handled by sfmt_jump_steps() or by computing the polynomial.
+ *
+ * @param sfmt SFMT internal state
+ * @param k log2 of the number of steps
+ */
+void sfmt_jump_pow2(sfmt_t * sfmt, int k) {
+    char jump_string[SFMT_JUMP_STRING_SIZE];
+    int res;
+
+    assert(k >= 0);
+#if !defined(SFMT_JUMP_NO_PARAMS)
+    if (k >= SFMT_JUMP_POW2_MIN && k <= SFMT_JUMP_POW2_MAX) {
+        sfmt_jump(sfmt, sfmt_jump_pow2_table[k - SFMT_JUMP_POW2_MIN]);
+        return;
+    }
+#endif
+    if (k < 64) {
+        sfmt_jump_steps(sfmt, (uint64_t)1 << k);
+        return;
+    }
+    res = sfmt_calc_jump_string(jump_string, sizeof(jump_string), NULL, 1, k);
+    assert(res == 0);
+    (void)res;
+    sfmt_jump(sfmt, jump_string);
+}
+
+/**
+ * This function jumps the state by an arbitrary number of steps.
+ * Short jumps are done by generating the numbers, long ones need the
+ * jump polynomial to be computed, which is slow; when the same jump
+ * is applied many times, compute it once with sfmt_calc_jump_string()
+ * and use sfmt_jump().
+ *
+ * @param sfmt SFMT internal state
+ * @param steps number of 128-bit words to skip
+ */
+void sfmt_jump_steps(sfmt_t * sfmt, uint64_t steps) {
+    char jump_string[SFMT_JUMP_STRING_SIZE];
+    int res;
+
+    if (steps < DIRECT_STEPS_LIMIT) {
+        step_directly(sfmt, steps);
+        return;
+    }
+    res = sfmt_calc_jump_string(jump_string, sizeof(jump_string), NULL, steps, 0);
+    assert(res == 0);
+    (void)res;
+    sfmt_jump(sfmt, jump_string);
+}
+
+/**
+ * This function jumps the state by count substreams, that is, by
+ * count * 2^SFMT_JUMP_STREAM_LOG2 steps, using one precomputed jump
+ * per bit set in count.
+ *
+ * @param sfmt SFMT internal state
+ * @param count number of substreams to skip
+ */
+void sfmt_jump_streams(sfmt_t * sfmt, uint64_t count) {
+    int i;
+
+    for (i = 0; count != 0; i++, count >>= 1) {
+        if (count & 1) {
+            sfmt_jump_pow2(sfmt, SFMT_JUMP_STREAM_LOG2 + i);
+        }
+    }
+}
+
+/**
+ * This function initializes the state to the beginning of a substream
+ * of the sequence generated by a seed. Substreams of the same seed do
+ * not overlap as long as each one draws less than
+ * 2^SFMT_JUMP_STREAM_LOG2 128-bit words.
+ *
+ * @param sfmt SFMT internal state
+ * @param seed a 32-bit integer used as the seed.
+ * @param stream substream number
+ */
+void sfmt_init_substream(sfmt_t * sfmt, uint32_t seed, uint64_t stream) {
+    sfmt_init_gen_rand(sfmt, seed);
+    sfmt_jump_streams(sfmt, stream);
+}
+
+#if defined(__cplusplus)
+}
+#endif
@@ -27,6 +27,12 @@ extern "C" {
 #include "sfmt/SFMT-params.h"
 #include "sfmt/SFMT-common.h"
 
+#if defined(__AVX2__)
+  #include <immintrin.h>
+#elif defined(__SSE2__)
+  #include <emmintrin.h>
+#endif
+
 #if defined(__BIG_ENDIAN__) && !defined(__amd64) && !defined(BIG_ENDIAN64)
 #define BIG_ENDIAN64 1
 #endif
@@ -48,12 +54,17 @@ inline static void gen_rand_array(sfmt_t * sfmt, w128_t *array, int size);
 inline static uint32_t func1(uint32_t x);
 inline static uint32_t func2(uint32_t x);
 static void period_certification(sfmt_t * sfmt);
+#ifndef ONLY64
+static void convert_real(double * array, int size, double offset,
+                         double scale);
+#endif
+static void convert_res53(double * array, int size);
 #if defined(BIG_ENDIAN64) && !defined(ONLY64)
 inline static void swap(w128_t *array, int size);
 #endif
 
 #if defined(HAVE_ALTIVEC)
-  #include "SFMT-alti.h"
+  #include "sfmt/SFMT-alti.h"
 #elif defined(HAVE_SSE2)
 /**
  * parameters used by sse2.
@@ -61,12 +72,16 @@ inline static void swap(w128_t *array, int size);
   static const w128_t sse2_param_mask = {{SFMT_MSK1, SFMT_MSK2,
                                           SFMT_MSK3, SFMT_MSK4}};
   #if defined(_MSC_VER)
-    #include "SFMT-sse2-msc.h"
+    #include "sfmt/SFMT-sse2-msc.h"
+  #elif defined(HAVE_AVX512)
+    #include "sfmt/SFMT-avx512.h"
+  #elif defined(HAVE_AVX2)
+    #include "sfmt/SFMT-avx2.h"
   #else
-    #include "SFMT-sse2.h"
+    #include "sfmt/SFMT-sse2.h"
   #endif
 #elif defined(HAVE_NEON)
-  #include "SFMT-neon.h"
+  #include "sfmt/SFMT-neon.h"
 #endif
 
 /**
@@ -339,6 +354,194 @@ void sfmt_fill_array64(sfmt_t * sfmt, uint64_t *array, int size) {
 #endif
 }
 
+#ifndef ONLY64
+/**
+ * This function converts, in place, the 32-bit integers stored at the
+ * beginning of array into doubles computed as (v + offset) * scale,
+ * which is bit-identical to the sfmt_to_real* functions.
+ *
+ * It runs backwards: array[i] overwrites the integers 2i and 2i+1,
+ * which have already been read.
+ * @param array the integers on input, the doubles on output
+ * @param size number of integers
+ * @param offset value added to each integer
+ * @param scale value each sum is multiplied by
+ */
+static void convert_real(double * array, int size, double offset,
+                         double scale) {
+    const uint32_t * psrc = (const uint32_t *)array;
+    int i = size;
+
+#if defined(__AVX512F__)
+    const __m512d voffset = _mm512_set1_pd(offset);
+    const __m512d vscale = _mm512_set1_pd(scale);
+
+    for (; i % 8 != 0; i--) {
+        array[i - 1] = (psrc[i - 1] + offset) * scale;
+    }
+    for (i -= 8; i >= 0; i -= 8) {
+        __m512d x = _mm512_cvtepu32_pd(
+            _mm256_loadu_si256((const __m256i *)(psrc + i)));
+        _mm512_storeu_pd(array + i,
+                         _mm512_mul_pd(_mm512_add_pd(x, voffset), vscale));
+    }
+#elif defined(__AVX2__)
+    const __m128i vsign = _mm_set1_epi32((int)0x80000000U);
+    const __m256d vbias = _mm256_set1_pd(2147483648.0);
+    const __m256d voffset = _mm256_set1_pd(offset);
+    const __m256d vscale = _mm256_set1_pd(scale);
+
+    for (i -= 4; i >= 0; i -= 4) {
+        /* there is no unsigned conversion, flip the sign bit and add it back */
+        __m128i v = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(psrc + i)),
+                                  vsign);
+        __m256d x = _mm256_add_pd(_mm256_cvtepi32_pd(v), vbias);
+        _mm256_storeu_pd(array + i,
+                         _mm256_mul_pd(_mm256_add_pd(x, voffset), vscale));
+    }
+#elif defined(__SSE2__)
+    const __m128i vsign = _mm_set1_epi32((int)0x80000000U);
+    const __m128d vbias = _mm_set1_pd(2147483648.0);
+    const __m128d voffset = _mm_set1_pd(offset);
+    const __m128d vscale = _mm_set1_pd(scale);
+
+    for (i -= 2; i >= 0; i -= 2) {
+        __m128i v = _mm_xor_si128(_mm_loadl_epi64((const __m128i *)(psrc + i)),
+                                  vsign);
+        __m128d x = _mm_add_pd(_mm_cvtepi32_pd(v), vbias);
+        _mm_storeu_pd(array + i, _mm_mul_pd(_mm_add_pd(x, voffset), vscale));
+    }
+#else
+    for (i -= 1; i >= 0; i--) {
+        array[i] = (psrc[i] + offset) * scale;
+    }
+#endif
+}
+#endif
+
+/**
+ * This function converts, in place, 64-bit integers into doubles on
+ * [0,1) with 53-bit resolution, bit-identical to sfmt_to_res53().
+ *
+ * The top 53 bits are split in a high and a low part which are turned
+ * into doubles by or-ing them into the mantissa of 2^84 and 2^52.
+ * Every step is exact, so is the sum.
+ * @param array the integers on input, the doubles on output
+ * @param size number of integers
+ */
+static void convert_res53(double * array, int size) {
+    uint64_t * psrc = (uint64_t *)array;
+    int i = 0;
+
+#if defined(__AVX512DQ__)
+    const __m512d vscale = _mm512_set1_pd(1.0/9007199254740992.0);
+
+    for (; i + 8 <= size; i += 8) {
+        __m512i v = _mm512_srli_epi64(
+            _mm512_loadu_si512((const void *)(psrc + i)), 11);
+        _mm512_storeu_pd(array + i, _mm512_mul_pd(_mm512_cvtepu64_pd(v), vscale));
+    }
+#elif defined(__AVX2__)
+    const __m256i vlow = _mm256_set1_epi64x(0x00000000ffffffffLL);
+    const __m256i vexp52 = _mm256_set1_epi64x(0x4330000000000000LL);
+    const __m256i vexp84 = _mm256_set1_epi64x(0x4530000000000000LL);
+    const __m256d vbias = _mm256_set1_pd(19342813118337666422669312.0); /* 2^84 + 2^52 */
+    const __m256d vscale = _mm256_set1_pd(1.0/9007199254740992.0);
+
+    for (; i + 4 <= size; i += 4) {
+        __m256i v = _mm256_srli_epi64(
+            _mm256_loadu_si256((const __m256i *)(psrc + i)), 11);
+        __m256d hi = _mm256_castsi256_pd(
+            _mm256_or_si256(_mm256_srli_epi64(v, 32), vexp84));
+        __m256d lo = _mm256_castsi256_pd(
+            _mm256_or_si256(_mm256_and_si256(v, vlow), vexp52));
+        __m256d x = _mm256_add_pd(_mm256_sub_pd(hi, vbias), lo);
+        _mm256_storeu_pd(array + i, _mm256_mul_pd(x, vscale));
+    }
+#elif defined(__SSE2__)
+    const __m128i vlow = _mm_set1_epi64x(0x00000000ffffffffLL);
+    const __m128i vexp52 = _mm_set1_epi64x(0x4330000000000000LL);
+    const __m128i vexp84 = _mm_set1_epi64x(0x4530000000000000LL);
+    const __m128d vbias = _mm_set1_pd(19342813118337666422669312.0); /* 2^84 + 2^52 */
+    const __m128d vscale = _mm_set1_pd(1.0/9007199254740992.0);
+
+    for (; i + 2 <= size; i += 2) {
+        __m128i v = _mm_srli_epi64(_mm_loadu_si128((const __m128i *)(psrc + i)), 11);
+        __m128d hi = _mm_castsi128_pd(_mm_or_si128(_mm_srli_epi64(v, 32), vexp84));
+        __m128d lo = _mm_castsi128_pd(_mm_or_si128(_mm_and_si128(v, vlow), vexp52));
+        __m128d x = _mm_add_pd(_mm_sub_pd(hi, vbias), lo);
+        _mm_storeu_pd(array + i, _mm_mul_pd(x, vscale));
+    }
+#endif
+    for (; i < size; i++) {
+        array[i] = sfmt_to_res53(psrc[i]);
+    }
+}
+
+#ifndef ONLY64
+/**
+ * This function generates pseudorandom doubles on [0,1]-real-interval
+ * in the specified array[] by one call. The numbers are the same, in
+ * the same order, that sfmt_genrand_real1 would return.
+ *
+ * The requirements on the state, the alignment of array and on size
+ * are those of sfmt_fill_array32(): size must be a multiple of 4 and
+ * at least (MEXP / 128 + 1) * 4.
+ *
+ * @param sfmt SFMT internal state
+ * @param array an array where pseudorandom doubles are filled
+ * @param size the number of doubles to be generated.
+ */
+void sfmt_fill_array_real1(sfmt_t * sfmt, double *array, int size) {
+    sfmt_fill_array32(sfmt, (uint32_t *)array, size);
+    convert_real(array, size, 0.0, 1.0/4294967295.0);
+}
+
+/**
+ * This function generates pseudorandom doubles on [0,1)-real-interval
+ * in the specified array[] by one call, see sfmt_fill_array_real1().
+ *
+ * @param sfmt SFMT internal state
+ * @param array an array where pseudorandom doubles are filled
+ * @param size the number of doubles to be generated.
+ */
+void sfmt_fill_array_real2(sfmt_t * sfmt, double *array, int size) {
+    sfmt_fill_array32(sfmt, (uint32_t *)array, size);
+    convert_real(array, size, 0.0, 1.0/4294967296.0);
+}
+
+/**
+ * This function generates pseudorandom doubles on (0,1)-real-interval
+ * in the specified array[] by one call, see sfmt_fill_array_real1().
+ *
+ * @param sfmt SFMT internal state
+ * @param array an array where pseudorandom doubles are filled
+ * @param size the number of doubles to be generated.
+ */
+void sfmt_fill_array_real3(sfmt_t * sfmt, double *array, int size) {
+    sfmt_fill_array32(sfmt, (uint32_t *)array, size);
+    convert_real(array, size, 0.5, 1.0/4294967296.0);
+}
+#endif
+
+/**
+ * This function generates pseudorandom doubles on [0,1) with 53-bit
+ * resolution in the specified array[] by one call. The numbers are the
+ * same, in the same order, that sfmt_genrand_res53 would return.
+ *
+ * The requirements on the state, the alignment of array and on size
+ * are those of sfmt_fill_array64(): size must be a multiple of 2 and
+ * at least (MEXP / 128 + 1) * 2.
+ *
+ * @param sfmt SFMT internal state
+ * @param array an array where pseudorandom doubles are filled
+ * @param size the number of doubles to be generated.
+ */
+void sfmt_fill_array_res53(sfmt_t * sfmt, double *array, int size) {
+    sfmt_fill_array64(sfmt, (uint64_t *)array, size);
+    convert_res53(array, size);
+}
+
 /**
  * This function initializes the internal state array with a 32-bit
  * integer seed.
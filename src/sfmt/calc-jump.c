@@ -0,0 +1,171 @@
+/**
+ * @file calc-jump.c
+ *
+ * @brief computes the minimal polynomial of SFMT and the jump
+ * polynomials shipped in SFMT-jump-paramsXXXX.h.
+ *
+ * The minimal polynomial is obtained with the Berlekamp-Massey
+ * algorithm from the sequence of the lowest bit of the 128-bit outputs,
+ * and checked against other seeds and bits. The output is the parameter
+ * header for the SFMT_MEXP the program is built with:
+ *
+ * @verbatim
+ cc -O3 -std=c11 -DSFMT_MEXP=19937 -DSFMT_JUMP_NO_PARAMS -Iincludes \
+    src/sfmt/calc-jump.c src/sfmt/SFMT.c src/sfmt/SFMT-jump.c -o calc-jump
+ ./calc-jump > includes/sfmt/SFMT-jump-params19937.h
+@endverbatim
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sfmt/SFMT.h"
+#include "sfmt/SFMT-jump.h"
+
+/** the degree of the minimal polynomial is at most the state size */
+#define MAX_DEGREE (SFMT_N * 128)
+#define SEQUENCE_LENGTH (2 * MAX_DEGREE + 128)
+
+/**
+ * Berlekamp-Massey algorithm over GF(2).
+ * @param s the sequence, one bit per byte
+ * @param n length of the sequence
+ * @param poly output, minimal polynomial coefficients, highest degree
+ * coefficient first (the connection polynomial)
+ * @return the linear complexity of the sequence
+ */
+static int berlekamp_massey(const unsigned char * s, int n, unsigned char * poly) {
+    unsigned char * b = calloc(n + 1, 1);
+    unsigned char * t = calloc(n + 1, 1);
+    int l = 0;
+    int m = 1;
+    int i, j;
+    unsigned char d;
+
+    memset(poly, 0, n + 1);
+    poly[0] = 1;
+    b[0] = 1;
+    for (i = 0; i < n; i++) {
+        d = s[i];
+        for (j = 1; j <= l; j++) {
+            d ^= poly[j] & s[i - j];
+        }
+        if (d == 0) {
+            m++;
+        } else if (2 * l <= i) {
+            memcpy(t, poly, n + 1);
+            for (j = 0; j + m <= n; j++) {
+                poly[j + m] ^= b[j];
+            }
+            l = i + 1 - l;
+            memcpy(b, t, n + 1);
+            m = 1;
+        } else {
+            for (j = 0; j + m <= n; j++) {
+                poly[j + m] ^= b[j];
+            }
+            m++;
+        }
+    }
+    free(b);
+    free(t);
+    return l;
+}
+
+/**
+ * Computes the minimal polynomial of the sequence of one bit of the
+ * 128-bit outputs of the generator, as a jump string.
+ */
+static int calc_minpoly(char * hex, uint32_t seed, int bit) {
+    static const char digits[] = "0123456789abcdef";
+    unsigned char * s = malloc(SEQUENCE_LENGTH);
+    unsigned char * conn = malloc(SEQUENCE_LENGTH + 1);
+    sfmt_t sfmt;
+    int degree;
+    int i, j;
+    uint32_t x;
+
+    sfmt_init_gen_rand(&sfmt, seed);
+    for (i = 0; i < SEQUENCE_LENGTH; i++) {
+        for (j = 0; j < 4; j++) {
+            x = sfmt_genrand_uint32(&sfmt);
+            if (j == bit / 32) {
+                s[i] = (x >> (bit % 32)) & 1;
+            }
+        }
+    }
+    degree = berlekamp_massey(s, SEQUENCE_LENGTH, conn);
+
+    /* the coefficient of x^i of the minimal polynomial is conn[degree - i] */
+    for (i = 0; i <= degree / 4; i++) {
+        x = 0;
+        for (j = 0; j < 4 && 4 * i + j <= degree; j++) {
+            x |= (uint32_t)conn[degree - (4 * i + j)] << j;
+        }
+        hex[i] = digits[x];
+    }
+    hex[i] = '\0';
+    free(s);
+    free(conn);
+    return degree;
+}
+
+static void print_string(const char * name, const char * hex) {
+    size_t len = strlen(hex);
+    size_t i;
+
+    printf("%s", name);
+    for (i = 0; i < len; i += 64) {
+        printf("\n    \"%.64s\"", hex + i);
+    }
+}
+
+int main(void) {
+    static const uint32_t seeds[] = {1234, 4321, 10000, 35141};
+    static const int bits[] = {0, 0, 37, 127};
+    char * minpoly = malloc(MAX_DEGREE / 4 + 2);
+    char * other = malloc(MAX_DEGREE / 4 + 2);
+    char * jump_string = malloc(SFMT_JUMP_STRING_SIZE);
+    sfmt_t sfmt;
+    int degree;
+    int i, k;
+
+    sfmt_init_gen_rand(&sfmt, 0);
+    degree = calc_minpoly(minpoly, seeds[0], bits[0]);
+    for (i = 1; i < (int)(sizeof(seeds) / sizeof(seeds[0])); i++) {
+        if (calc_minpoly(other, seeds[i], bits[i]) != degree
+            || strcmp(minpoly, other) != 0) {
+            fprintf(stderr, "minimal polynomials differ for seed %u\n", seeds[i]);
+            return 1;
+        }
+    }
+    fprintf(stderr, "%s: minimal polynomial of degree %d\n",
+            sfmt_get_idstring(&sfmt), degree);
+
+    printf("#pragma once\n");
+    printf("#ifndef SFMT_JUMP_PARAMS%d_H\n", SFMT_MEXP);
+    printf("#define SFMT_JUMP_PARAMS%d_H\n\n", SFMT_MEXP);
+    printf("/* generated by calc-jump, do not edit */\n\n");
+    printf("/* minimal polynomial of degree %d, lowest degree coefficient first */\n", degree);
+    print_string("static const char sfmt_jump_minpoly[] =", minpoly);
+    printf(";\n\n");
+    printf("/* x^(2^k) mod minpoly, for SFMT_JUMP_POW2_MIN <= k <= SFMT_JUMP_POW2_MAX */\n");
+    printf("static const char * const sfmt_jump_pow2_table[] = {");
+    for (k = SFMT_JUMP_POW2_MIN; k <= SFMT_JUMP_POW2_MAX; k++) {
+        if (sfmt_calc_jump_string(jump_string, SFMT_JUMP_STRING_SIZE, minpoly, 1, k) != 0) {
+            fprintf(stderr, "cannot compute the jump polynomial for 2^%d\n", k);
+            return 1;
+        }
+        printf("\n    /* 2^%d */", k);
+        print_string("", jump_string);
+        printf(",");
+        fprintf(stderr, "2^%d done\n", k);
+    }
+    printf("\n};\n\n");
+    printf("#endif /* SFMT_JUMP_PARAMS%d_H */\n", SFMT_MEXP);
+
+    free(minpoly);
+    free(other);
+    free(jump_string);
+    return 0;
+}
@@ -0,0 +1,92 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <functional>
+#include "sfmt/SFMT.h"
+
+namespace chrono = std::chrono;
+
+// raw output speed of the SFMT recursion backend this binary was built with,
+// run `make bench-sfmt` to build and run it for every backend
+#if defined(HAVE_AVX512)
+static const char* backend = "avx512";
+#elif defined(HAVE_AVX2)
+static const char* backend = "avx2";
+#elif defined(HAVE_SSE2)
+static const char* backend = "sse2";
+#elif defined(HAVE_NEON)
+static const char* backend = "neon";
+#elif defined(HAVE_ALTIVEC)
+static const char* backend = "altivec";
+#else
+static const char* backend = "c";
+#endif
+
+static const auto min_duration = chrono::milliseconds(200);
+static const int repetitions = 5;
+
+// calls fn until min_duration has elapsed, best of several repetitions, in GB/s
+static double measure(size_t bytes_per_call, const std::function<void()>& fn) {
+    typedef chrono::duration<double> float_seconds;
+
+    double best = 0.0;
+    for (int rep = 0; rep < repetitions; ++rep) {
+        size_t calls = 0;
+        auto begin_tp = chrono::steady_clock::now();
+        auto elapsed = float_seconds::zero();
+        do {
+            fn();
+            ++calls;
+            elapsed = chrono::steady_clock::now() - begin_tp;
+        } while (elapsed < min_duration);
+        best = std::max(best, calls * bytes_per_call / elapsed.count() / 1e9);
+    }
+    return best;
+}
+
+static void report(const std::string& name, double gbps) {
+    std::cout << std::left << std::setw(28) << name << ": "
+              << std::right << std::fixed << std::setprecision(3) << std::setw(8) << gbps << " GB/s" << std::endl;
+}
+
+int main() {
+    sfmt_t rnd_state;
+    sfmt_init_gen_rand(&rnd_state, 1234);
+
+    std::cout << "backend: " << backend << " (" << sfmt_get_idstring(&rnd_state) << ")" << std::endl;
+
+    report("gen_rand_all", measure(sizeof(rnd_state.state), [&] {
+        sfmt_gen_rand_all(&rnd_state);
+    }));
+
+    // vector memory is 16-byte aligned, as required by the SIMD backends
+    for (size_t size : {size_t(16) << 10, size_t(1) << 20}) {
+        std::vector<uint64_t> block(size);
+        auto label = std::to_string(size * sizeof(uint64_t) >> 10) + " KiB";
+
+        sfmt_init_gen_rand(&rnd_state, 1234);
+        report("fill_array64 (" + label + ")", measure(size * sizeof(uint64_t), [&] {
+            sfmt_fill_array64(&rnd_state, block.data(), block.size());
+        }));
+
+        std::vector<double> doubles(size);
+        report("fill_array_res53 (" + label + ")", measure(size * sizeof(double), [&] {
+            sfmt_fill_array_res53(&rnd_state, doubles.data(), doubles.size());
+        }));
+    }
+
+    const size_t scalar_calls = 1 << 16;
+    uint64_t sink = 0;
+    sfmt_init_gen_rand(&rnd_state, 1234);
+    report("genrand_uint64", measure(scalar_calls * sizeof(uint64_t), [&] {
+        for (size_t j = 0; j < scalar_calls; ++j) {
+            sink ^= sfmt_genrand_uint64(&rnd_state);
+        }
+    }));
+
+    // keeps the scalar loop from being optimized away
+    return sink == 42;
+}
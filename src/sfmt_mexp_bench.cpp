@@ -0,0 +1,108 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <algorithm>
+#include "sfmt_engine.hpp"
+
+namespace chrono = std::chrono;
+
+// throughput of sfmt_engine<MEXP> per thread, for every period and from 1
+// thread up to the hardware concurrency, to choose the period for a host:
+// make run CURRENT=sfmt_mexp_bench
+static const auto min_duration = chrono::milliseconds(300);
+static const size_t buffer_size = 2048; // 16 KiB, fits in L1 next to the state
+
+struct thread_result {
+    double fill_gbps = 0.0;
+    double call_gbps = 0.0;
+};
+
+// calls fn until min_duration has elapsed, in GB/s
+template <class Function>
+static double measure(size_t bytes_per_call, Function fn) {
+    typedef chrono::duration<double> float_seconds;
+
+    size_t calls = 0;
+    auto begin_tp = chrono::steady_clock::now();
+    auto elapsed = float_seconds::zero();
+    do {
+        fn();
+        ++calls;
+        elapsed = chrono::steady_clock::now() - begin_tp;
+    } while (elapsed < min_duration);
+    return calls * bytes_per_call / elapsed.count() / 1e9;
+}
+
+template <int MEXP>
+static void run_threads(size_t num_threads) {
+    std::vector<std::thread> threads;
+    std::vector<thread_result> results(num_threads);
+    std::atomic<size_t> ready(0);
+
+    for (size_t i = 0; i < num_threads; ++i) {
+        threads.emplace_back([&, i] {
+            sfmt_engine<MEXP> engine((i+1)*10000);
+            std::vector<uint64_t> buffer(buffer_size);
+            uint64_t sink = 0;
+
+            // all threads measure at the same time
+            ready++;
+            while (ready < num_threads) {
+                std::this_thread::yield();
+            }
+
+            results[i].fill_gbps = measure(buffer_size * sizeof(uint64_t), [&] {
+                engine.fill(buffer.data(), buffer.size());
+            });
+            results[i].call_gbps = measure(buffer_size * sizeof(uint64_t), [&] {
+                for (size_t j = 0; j < buffer_size; ++j) {
+                    sink ^= engine();
+                }
+            });
+            buffer[0] ^= sink; // keeps the loop from being optimized away
+        });
+    }
+
+    for (auto &t : threads) {
+        t.join();
+    }
+
+    double fill_total = 0.0;
+    double call_total = 0.0;
+    for (auto &r : results) {
+        fill_total += r.fill_gbps;
+        call_total += r.call_gbps;
+    }
+    std::cout << std::setw(7) << MEXP
+              << std::setw(8) << sfmt_engine<MEXP>::state_size()
+              << std::setw(8) << num_threads
+              << std::fixed << std::setprecision(3)
+              << std::setw(12) << fill_total / num_threads
+              << std::setw(12) << fill_total
+              << std::setw(12) << call_total / num_threads
+              << std::setw(12) << call_total << std::endl;
+}
+
+template <int... MEXPS>
+static void run_all(const std::vector<size_t>& thread_counts) {
+    for (auto num_threads : thread_counts) {
+        (run_threads<MEXPS>(num_threads), ...);
+    }
+}
+
+int main() {
+    size_t hwc = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<size_t> thread_counts;
+    for (size_t n = 1; n < hwc; n *= 2) {
+        thread_counts.push_back(n);
+    }
+    thread_counts.push_back(hwc);
+
+    std::cout << hwc << " concurrent threads are supported." << std::endl;
+    std::cout << "GB/s of fill() and of operator(), per thread and in total" << std::endl;
+    std::cout << "   MEXP   state threads    fill/thr  fill total    call/thr  call total" << std::endl;
+    run_all<607, 1279, 2281, 4253, 11213, 19937, 44497, 86243, 132049, 216091>(thread_counts);
+}
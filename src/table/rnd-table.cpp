@@ -0,0 +1,74 @@
+/**
+ * @file rnd-table.cpp
+ *
+ * @brief converts a text file of random numbers, one double in [0,1) per
+ * line as randomgen_481 used to read them, to the binary table format of
+ * random_table.hpp
+ *
+ * @verbatim
+ make rnd-table
+ build/bin/release/rnd-table qrng.txt qrng.tbl "ANU QRNG 2023-05"
+ build/bin/release/rnd-table --verify qrng.tbl
+@endverbatim
+ */
+
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include "random_table.hpp"
+
+static int convert(const char* text_path, const char* table_path, const std::string& source) {
+    std::ifstream in(text_path);
+    if (!in.is_open()) {
+        std::cerr << "Could not open file: " << text_path << std::endl;
+        return 1;
+    }
+
+    std::vector<double> values;
+    double x;
+    size_t out_of_range = 0;
+    while (in >> x) {
+        out_of_range += !(x >= 0.0 && x < 1.0);
+        values.push_back(x);
+    }
+    if (!in.eof()) {
+        std::cerr << text_path << ": not a number after " << values.size() << " values" << std::endl;
+        return 1;
+    }
+    if (out_of_range) {
+        std::cerr << "warning: " << out_of_range << " values out of [0,1)" << std::endl;
+    }
+
+    random_table::write(table_path, values.data(), values.size(), source);
+    std::cout << table_path << ": " << values.size() << " values, checksum "
+              << std::hex << std::setw(16) << std::setfill('0')
+              << random_table_checksum(values.data(), values.size()) << std::endl;
+    return 0;
+}
+
+static int verify(const char* table_path) {
+    random_table table(table_path);
+    bool ok = table.verify();
+    std::cout << table_path << ": " << table.size() << " values from \"" << table.source() << "\", checksum "
+              << (ok ? "ok" : "MISMATCH") << std::endl;
+    return ok ? 0 : 1;
+}
+
+int main(int argc, char* argv[]) {
+    try {
+        if (argc == 3 && std::string(argv[1]) == "--verify") {
+            return verify(argv[2]);
+        }
+        if (argc == 3 || argc == 4) {
+            return convert(argv[1], argv[2], argc == 4 ? argv[3] : argv[1]);
+        }
+    } catch (std::runtime_error& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    std::cerr << "Usage: " << argv[0] << " <text_file> <table_file> [source]" << std::endl;
+    std::cerr << "       " << argv[0] << " --verify <table_file>" << std::endl;
+    return 1;
+}
@@ -7,21 +7,48 @@
 #include <algorithm>
 #include <numeric>
 #include <functional>
+#include <memory>
+#include <string>
+#include "monte_carlo.hpp"
+#include "work_time.hpp"
+#include "running_moments.hpp"
+#include "checkpoint.hpp"
+#include "perf_counters.hpp"
+#include "progress.hpp"
 
 namespace chrono = std::chrono;
 
-// disabled because it is too slow compared to mt19937.h
 #ifdef USE_STD_RANDOM
-#pragma message "Using std random"
 #include <random>
+#ifdef USE_SFMT
+// <random> distributions at SFMT block speed
+#pragma message "Using std random with SFMT"
+#include "sfmt_buffered_engine.hpp"
+thread_local sfmt_buffered_engine rnd_engine;
+static const char* rng_name = "std-sfmt";
+#else
+// disabled because it is too slow compared to mt19937.h
+#pragma message "Using std random"
 thread_local std::mt19937 rnd_engine;
+static const char* rng_name = "std-mt19937";
+#endif
+#elif defined(USE_PHILOX)
+// counter-based, sample j takes the blocks 3j ... 3j+2, whatever thread computes it
+#pragma message "Using Philox"
+#include "philox.hpp"
+static const char* rng_name = "philox";
+#define RANDOM_IN_BLOCKS
 #elif defined(USE_SFMT)
 #pragma message "Using SFMT"
 #include "sfmt/SFMT.h"
 thread_local sfmt_t rnd_engine;
+static const char* rng_name = "sfmt";
+#define RANDOM_IN_BLOCKS
 #else
 #pragma message "Using mt19937.h"
+#include <random> // std::seed_seq
 #include "mt19937.h" // modified to be thread safe
+static const char* rng_name = "mt19937";
 #endif
 
 template <size_t a, size_t b>
@@ -33,8 +60,18 @@ struct unif_generator {
     size_t range = b - a;
 #endif
 
+#ifdef RANDOM_IN_BLOCKS
+    // maps a number drawn in bulk on [0,1]
+    double operator()(double u) const {
+        return a + u * range;
+    }
+#endif
+
+#ifndef USE_PHILOX
     double operator()() {
-#ifdef USE_STD_RANDOM
+#if defined(USE_STD_RANDOM) && defined(USE_SFMT)
+        return rnd_engine.draw(dist);
+#elif defined(USE_STD_RANDOM)
         return dist(rnd_engine);
 #elif defined(USE_SFMT)
         return a + sfmt_genrand_real1(&rnd_engine) * range;
@@ -42,96 +79,169 @@ struct unif_generator {
         return a + (genrand() * range);
 #endif
     }
+#endif
 };
 
-struct acumulator {
-    double simple = 0.0;
-    double squared = 0.0;
-};
+// mean and variance of the samples, plain sums of t10f and t10f^2 lose
+// most of the digits of the variance to cancellation at 10^10 samples
+typedef running_moments acumulator;
+
+// samples added to the accumulator at once, one per lane
+static const size_t acumulator_lanes = 8;
+
+auto T1 = unif_generator<task_durations[0][0], task_durations[0][1]>{};
+auto T2 = unif_generator<task_durations[1][0], task_durations[1][1]>{};
+auto T3 = unif_generator<task_durations[2][0], task_durations[2][1]>{};
+auto T4 = unif_generator<task_durations[3][0], task_durations[3][1]>{};
+auto T5 = unif_generator<task_durations[4][0], task_durations[4][1]>{};
+auto T6 = unif_generator<task_durations[5][0], task_durations[5][1]>{};
+auto T7 = unif_generator<task_durations[6][0], task_durations[6][1]>{};
+auto T8 = unif_generator<task_durations[7][0], task_durations[7][1]>{};
+auto T9 = unif_generator<task_durations[8][0], task_durations[8][1]>{};
+auto T10 = unif_generator<task_durations[9][0], task_durations[9][1]>{};
+
+#if defined(USE_PHILOX)
+// samples per call to philox4x32_fill_real1
+static const size_t block_samples = 512;
+static const size_t blocks_per_sample = 3; // 12 numbers, the last 2 are not used
+static const uint64_t philox_seed = 10000;
 
-auto T1 = unif_generator<40, 56>{};
-auto T2 = unif_generator<24, 32>{};
-auto T3 = unif_generator<20, 40>{};
-auto T4 = unif_generator<16, 48>{};
-auto T5 = unif_generator<10, 30>{};
-auto T6 = unif_generator<15, 30>{};
-auto T7 = unif_generator<20, 25>{};
-auto T8 = unif_generator<30, 50>{};
-auto T9 = unif_generator<40, 60>{};
-auto T10 = unif_generator<8, 16>{};
-
-static void estimate_range(std::vector<acumulator> &mem, size_t i, size_t begin_index, size_t end_index) {
-    acumulator acc; // faster than updating mem[i] on each iteration
-    for (size_t j = begin_index; j < end_index; ++j) {
-        auto x1 = T1();
-        auto x2 = T2();
-        auto x3 = T3();
-        auto x4 = T4();
-        auto x5 = T5();
-        auto x6 = T6();
-        auto x7 = T7();
-        auto x8 = T8();
-        auto x9 = T9();
-        auto x10 = T10();
-
-        auto t2f = x1 + x2;
-        auto t3f = x1 + x3;
-        auto t4f = std::max(t2f, t3f) + x4;
-        auto t5f = std::max(t2f, t3f) + x5;
-        auto t6f = t3f + x6;
-        auto t7f = t3f + x7;
-        auto t8f = std::max({t4f, t5f, t6f, t7f}) + x8;
-        auto t9f = t5f + x9;
-        auto t10f = std::max({t7f, t8f, t9f}) + x10;
-
-        acc.simple += t10f;
-        acc.squared += (t10f*t10f);
-    }
-    mem[i] = acc;
+static void estimate_range(acumulator &result, size_t begin_index, size_t end_index) {
+    running_moments_lanes<acumulator_lanes> acc;
+    std::vector<double> block(4 * blocks_per_sample * block_samples);
+    double t10f[block_samples];
+    for (size_t j = begin_index; j < end_index; j += block_samples) {
+        auto count = std::min(block_samples, end_index - j);
+        philox4x32_fill_real1(philox_seed, 0, j * blocks_per_sample, block.data(), count * blocks_per_sample);
+        for (size_t k = 0; k < count; ++k) {
+            const double* u = &block[4 * blocks_per_sample * k];
+            t10f[k] = total_work_time(T1(u[0]), T2(u[1]), T3(u[2]), T4(u[3]), T5(u[4]),
+                                      T6(u[5]), T7(u[6]), T8(u[7]), T9(u[8]), T10(u[9]));
+        }
+        acc.add(t10f, count);
+    }
+    result.merge(acc.moments());
 }
+#elif defined(RANDOM_IN_BLOCKS)
+// samples per call to sfmt_fill_array_real1, 10 * block_samples must be a multiple of 4
+static const size_t block_samples = 512;
 
-static chrono::microseconds run_simulation(size_t N, size_t num_threads) {
-    typedef chrono::duration<long double, std::milli> float_milliseconds;
+static void estimate_range(acumulator &result, size_t begin_index, size_t end_index) {
+    running_moments_lanes<acumulator_lanes> acc;
+    // same numbers, in the same order, as calling sfmt_genrand_real1 from T1()...T10()
+    std::vector<double> block(10 * block_samples);
+    double t10f[block_samples];
+    for (size_t j = begin_index; j < end_index; j += block_samples) {
+        sfmt_fill_array_real1(&rnd_engine, block.data(), block.size());
+        auto count = std::min(block_samples, end_index - j);
+        for (size_t k = 0; k < count; ++k) {
+            const double* u = &block[10 * k];
+            t10f[k] = total_work_time(T1(u[0]), T2(u[1]), T3(u[2]), T4(u[3]), T5(u[4]),
+                                      T6(u[5]), T7(u[6]), T8(u[7]), T9(u[8]), T10(u[9]));
+        }
+        acc.add(t10f, count);
+    }
+    result.merge(acc.moments());
+}
+#else
+// samples added to the accumulator at once
+static const size_t block_samples = 512;
 
-    chrono::steady_clock::time_point begin = chrono::steady_clock::now();
+static void estimate_range(acumulator &result, size_t begin_index, size_t end_index) {
+    running_moments_lanes<acumulator_lanes> acc;
+    double t10f[block_samples];
+    for (size_t j = begin_index; j < end_index; j += block_samples) {
+        auto count = std::min(block_samples, end_index - j);
+        for (size_t k = 0; k < count; ++k) {
+            // the order of evaluation of function arguments is unspecified
+            auto x1 = T1();
+            auto x2 = T2();
+            auto x3 = T3();
+            auto x4 = T4();
+            auto x5 = T5();
+            auto x6 = T6();
+            auto x7 = T7();
+            auto x8 = T8();
+            auto x9 = T9();
+            auto x10 = T10();
 
-    std::vector<std::thread> threads;
-    std::vector<acumulator> partial_results(num_threads);
-    for (size_t i = 0; i < num_threads; ++i) {
-        // this will construct the thread IN the vector
-        threads.emplace_back([&, i] {
-#ifdef USE_STD_RANDOM
-            rnd_engine.seed((i+1)*10000);
+            t10f[k] = total_work_time(x1, x2, x3, x4, x5, x6, x7, x8, x9, x10);
+        }
+        acc.add(t10f, count);
+    }
+    result.merge(acc.moments());
+}
+#endif
+
+// the random numbers of a chunk come from the engine of its thread, seeded
+// with (seed, chunk), so the result does not depend on the number of threads
+struct work_time_kernel {
+    struct state_type {};
+
+    static const uint32_t seed = 10000;
+
+    state_type make_state(size_t) const {
+        return state_type{};
+    }
+
+    void seed_chunk(state_type&, [[maybe_unused]] size_t chunk) const {
+#if defined(USE_STD_RANDOM)
+        std::seed_seq seq{ seed, uint32_t(chunk), uint32_t(uint64_t(chunk) >> 32) };
+        rnd_engine.seed(seq);
+#elif defined(USE_PHILOX)
+        // nothing to seed, estimate_range computes the blocks of its samples
 #elif defined(USE_SFMT)
-            sfmt_init_gen_rand(&rnd_engine, (i+1)*10000);
+        uint32_t key[] = { seed, 0, uint32_t(chunk), uint32_t(uint64_t(chunk) >> 32) };
+        sfmt_init_by_array(&rnd_engine, key, 4);
 #else
-            sgenrand((i+1)*10000); // different seed for each thread
+        std::seed_seq seq{ seed, uint32_t(chunk), uint32_t(uint64_t(chunk) >> 32) };
+        uint32_t value;
+        seq.generate(&value, &value + 1);
+        sgenrand(value);
 #endif
-            estimate_range(partial_results, i, i * N / num_threads, (i + 1) * N / num_threads);
-        });
     }
 
-    for (auto &t : threads) {
-        t.join();
+    void operator()(state_type&, size_t begin_index, size_t end_index, acumulator& acc) const {
+        estimate_range(acc, begin_index, end_index);
     }
+};
+
+typedef monte_carlo_runner<work_time_kernel, acumulator> work_time_runner;
+
+struct checkpoint_options {
+    std::string path; // no checkpoints if empty
+    bool resume = false;
+    chrono::seconds interval{60};
+};
+
+struct progress_options {
+    bool enabled = false;
+    std::string path; // stderr if empty
+    chrono::seconds interval{10};
+};
+
+// extends the run of the previous call to N samples, only the new ones
+// are computed, and counted if count_perf
+static chrono::microseconds run_simulation(size_t N, work_time_runner& runner,
+                                           const std::string& tag, checkpoint_writer* writer,
+                                           const chrono::seconds interval, const bool count_perf) {
+    typedef chrono::duration<long double, std::milli> float_milliseconds;
+
+    std::unique_ptr<perf_counters> counters;
+    if (count_perf) {
+        counters.reset(new perf_counters(runner.num_workers()));
+    }
+    runner.set_perf_counters(counters.get());
+
+    chrono::steady_clock::time_point begin = chrono::steady_clock::now();
 
-    double x_hat = std::accumulate(partial_results.begin(),
-                                   partial_results.end(),
-                                   0.0,
-                                   std::bind(std::plus<double>(),
-                                             std::placeholders::_1,
-                                             std::bind(&acumulator::simple,
-                                                       std::placeholders::_2)));
-    x_hat = x_hat / N;
+    auto result = run_checkpointed(runner, N, tag, writer, interval);
+    runner.set_perf_counters(nullptr);
 
-    double v_hat = std::accumulate(partial_results.begin(),
-                                   partial_results.end(),
-                                   0.0,
-                                   std::bind(std::plus<double>(),
-                                             std::placeholders::_1,
-                                             std::bind(&acumulator::squared,
-                                                       std::placeholders::_2)));
-    v_hat = v_hat / (N * (N - 1)) - (x_hat * x_hat) / (N -1);
+    double x_hat = result.mean();
+
+    // variance of x_hat
+    double v_hat = result.variance() / N;
 
     auto duration = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - begin);
 
@@ -140,22 +250,92 @@ static chrono::microseconds run_simulation(size_t N, size_t num_threads) {
     std::cout << "v_hat:   " << v_hat << std::endl;
     std::cout << "stddev:  " << std::sqrt(v_hat) << " (as sqrt of v_hat)" << std::endl;
     std::cout << "time:    " << chrono::duration_cast<float_milliseconds>(duration).count() << " ms" << std::endl;
+    if (counters) {
+        counters->print(std::cout);
+    }
 
     return duration;
 }
 
-int main() {
+int main(int argc, char* argv[]) {
+    checkpoint_options checkpoints;
+    progress_options progress;
+    bool count_perf = false;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg{ argv[i] };
+        try {
+            if (arg.rfind("--checkpoint=", 0) == 0) {
+                checkpoints.path = arg.substr(13);
+            } else if (arg.rfind("--checkpoint-interval=", 0) == 0) {
+                checkpoints.interval = chrono::seconds(std::stoll(arg.substr(22)));
+            } else if (arg == "--resume") {
+                checkpoints.resume = true;
+            } else if (arg == "--progress" || arg.rfind("--progress=", 0) == 0) {
+                progress.enabled = true;
+                progress.path = arg.size() > 10 ? arg.substr(11) : "";
+            } else if (arg.rfind("--progress-interval=", 0) == 0) {
+                progress.interval = chrono::seconds(std::stoll(arg.substr(20)));
+                if (progress.interval.count() < 1) {
+                    throw std::invalid_argument(arg);
+                }
+            } else if (arg == "--perf-counters") {
+                count_perf = true;
+            } else {
+                throw std::invalid_argument(arg);
+            }
+        } catch (std::invalid_argument& e) {
+            std::cerr << "Usage: " << argv[0] << " [--checkpoint=<file>] [--checkpoint-interval=<s>] [--resume]"
+                      << " [--progress[=<file>]] [--progress-interval=<s>] [--perf-counters]" << std::endl;
+            return 1;
+        }
+    }
+    if (checkpoints.resume && checkpoints.path.empty()) {
+        std::cerr << "--resume needs --checkpoint=<file>" << std::endl;
+        return 1;
+    }
+
     auto max_duration = chrono::seconds(60);
-    auto hwc = std::thread::hardware_concurrency();
-    std::cout << hwc << " concurrent threads are supported." << std::endl;
+    // the threads of the pool are started once, before the measurements
+    work_time_runner runner(work_time_kernel{});
+    std::cout << runner.num_workers() << " concurrent threads are supported." << std::endl;
     std::cout << "--------------------------" << std::endl;
 
-    chrono::steady_clock::time_point begin = chrono::steady_clock::now();
+    std::unique_ptr<progress_monitor> monitor;
+    if (progress.enabled) {
+        monitor.reset(new progress_monitor(runner.num_workers(), progress.path, progress.interval));
+        runner.set_progress(monitor.get(), [](const acumulator& acc, size_t) { return acc; });
+    }
 
+    const std::string tag = std::string("total_work_time_estimation/") + rng_name;
     size_t N = 1;
+    if (checkpoints.resume) {
+        try {
+            auto saved = checkpoint_resume(runner, checkpoints.path, tag);
+            std::cout << "resumed: " << saved.samples() << " samples of " << saved.target
+                      << " from " << checkpoints.path << std::endl;
+            std::cout << "--------------------------" << std::endl;
+            N = std::max<size_t>(saved.target / 10, 1);
+            if (monitor) {
+                monitor->set_base(saved.samples(), saved.result);
+            }
+        } catch (std::runtime_error& e) {
+            std::cerr << e.what() << std::endl;
+            return 1;
+        }
+    }
+    std::unique_ptr<checkpoint_writer> writer;
+    if (!checkpoints.path.empty()) {
+        writer.reset(new checkpoint_writer(checkpoints.path));
+    }
+
+    chrono::steady_clock::time_point begin = chrono::steady_clock::now();
+
     while (true) {
         N *= 10;
-        auto dur = run_simulation(N, hwc);
+        if (monitor) {
+            monitor->set_target(N);
+        }
+        auto dur = run_simulation(N, runner, tag, writer.get(), checkpoints.interval, count_perf);
         std::cout << "--------------------------" << std::endl;
         if (dur > max_duration) {
             break;